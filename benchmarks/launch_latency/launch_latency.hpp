@@ -0,0 +1,299 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <Kokkos_Core.hpp>
+#include <impl/Kokkos_Timer.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Time individual launches of empty and near-empty kernels.  Empty kernels
+// have a null 'touch' view and do nothing per iteration, near-empty kernels
+// write one entry per iteration.  Every functor carries a payload of
+// 'Bytes' bytes to expose the cost of copying the functor at launch.
+
+namespace LaunchLatency {
+
+template <int Bytes>
+struct Payload {
+  char data[Bytes];
+  Payload() : data{} {}
+};
+
+template <class ExecSpace, int Bytes>
+struct ForFunctor {
+  Kokkos::View<long*, ExecSpace> touch;
+  Payload<Bytes> payload;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const {
+    if (touch.data()) touch(i) = i;
+  }
+};
+
+template <class ExecSpace, int Bytes>
+struct ReduceFunctor {
+  using value_type = long;
+
+  Kokkos::View<long*, ExecSpace> touch;
+  Payload<Bytes> payload;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, value_type& update) const {
+    if (touch.data()) update += touch(i);
+  }
+};
+
+template <class ExecSpace, int Bytes>
+struct ScanFunctor {
+  using value_type = long;
+
+  Kokkos::View<long*, ExecSpace> touch;
+  Payload<Bytes> payload;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, value_type& update, const bool final) const {
+    if (touch.data()) {
+      if (final) touch(i) = update;
+      update += 1;
+    }
+  }
+};
+
+template <class ExecSpace, int Bytes>
+struct TeamFunctor {
+  using member_type = typename Kokkos::TeamPolicy<ExecSpace>::member_type;
+
+  Kokkos::View<long*, ExecSpace> touch;
+  Payload<Bytes> payload;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_type& team) const {
+    if (touch.data() && 0 == team.team_rank()) {
+      touch(team.league_rank()) = team.league_rank();
+    }
+  }
+};
+
+template <class ExecSpace, int Bytes>
+struct MDRangeFunctor {
+  Kokkos::View<long*, ExecSpace> touch;
+  Payload<Bytes> payload;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, const int j) const {
+    if (touch.data()) touch(i) = i + j;
+  }
+};
+
+struct Statistics {
+  double min, p50, p90, p99, max, mean;
+};
+
+inline Statistics statistics(std::vector<double>& samples) {
+  std::sort(samples.begin(), samples.end());
+
+  const size_t n = samples.size();
+  auto percentile = [&](const double q) {
+    return samples[std::min(n - 1, size_t(q * (n - 1) + 0.5))];
+  };
+
+  double sum = 0;
+  for (const double s : samples) sum += s;
+
+  return Statistics{samples.front(), percentile(0.5), percentile(0.9),
+                    percentile(0.99), samples.back(), sum / n};
+}
+
+struct Options {
+  int samples;
+  int warmup;
+  int length;  // Iterations per launch, 0 for one per thread
+};
+
+// Writes the results as a JSON document with one record per configuration.
+// Records carry the dispatch strategy of the backend, "default" unless the
+// backend offers several, see 'set_dispatch'.
+class Report {
+ public:
+  Report(FILE* const out, const Options& options)
+      : m_out(out), m_dispatch("default"), m_count(0) {
+    fprintf(m_out,
+            "{\"benchmark\": \"launch_latency\", \"samples\": %d, "
+            "\"warmup\": %d, \"results\": [",
+            options.samples, options.warmup);
+  }
+
+  ~Report() { fprintf(m_out, "\n]}\n"); }
+
+  void set_dispatch(const char* const dispatch) { m_dispatch = dispatch; }
+
+  void add(const char* const space, const int threads,
+           const char* const pattern, const char* const body,
+           const int functor_bytes, const int length,
+           std::vector<double>& samples) {
+    const Statistics s = statistics(samples);
+    fprintf(m_out,
+            "%s\n  {\"space\": \"%s\", \"threads\": %d, "
+            "\"dispatch\": \"%s\", \"pattern\": \"%s\", \"body\": \"%s\", "
+            "\"functor_bytes\": %d, \"length\": %d, \"samples\": %d, "
+            "\"unit\": \"us\", \"min\": %.3f, \"p50\": %.3f, "
+            "\"p90\": %.3f, \"p99\": %.3f, \"max\": %.3f, \"mean\": %.3f}",
+            m_count ? "," : "", space, threads, m_dispatch, pattern, body,
+            functor_bytes, length, int(samples.size()), 1.0e6 * s.min, 1.0e6 * s.p50,
+            1.0e6 * s.p90, 1.0e6 * s.p99, 1.0e6 * s.max, 1.0e6 * s.mean);
+    fflush(m_out);
+    ++m_count;
+  }
+
+ private:
+  FILE* const m_out;
+  const char* m_dispatch;
+  int m_count;
+};
+
+template <class Launch>
+void time_launch(const Launch& launch, const Options& options,
+                 std::vector<double>& samples) {
+  for (int i = 0; i < options.warmup; ++i) launch();
+
+  samples.resize(options.samples);
+
+  Kokkos::Impl::Timer timer;
+  for (int i = 0; i < options.samples; ++i) {
+    timer.reset();
+    launch();
+    samples[i] = timer.seconds();
+  }
+}
+
+template <class ExecSpace, int Bytes>
+void run_patterns(const char* const space_name, const int threads,
+                  const Options& options, Report& report) {
+  const int length = options.length ? options.length : threads;
+
+  Kokkos::View<long*, ExecSpace> view("touch", length);
+  std::vector<double> samples;
+
+  for (int near_empty = 0; near_empty < 2; ++near_empty) {
+    const char* const body = near_empty ? "near_empty" : "empty";
+    const Kokkos::View<long*, ExecSpace> touch =
+        near_empty ? view : Kokkos::View<long*, ExecSpace>();
+
+    {
+      ForFunctor<ExecSpace, Bytes> f;
+      f.touch = touch;
+      time_launch(
+          [&]() {
+            Kokkos::parallel_for(Kokkos::RangePolicy<ExecSpace>(0, length), f);
+            ExecSpace().fence();
+          },
+          options, samples);
+      report.add(space_name, threads, "parallel_for", body, Bytes, length,
+                 samples);
+    }
+    {
+      ReduceFunctor<ExecSpace, Bytes> f;
+      f.touch = touch;
+      long result;
+      time_launch(
+          [&]() {
+            Kokkos::parallel_reduce(Kokkos::RangePolicy<ExecSpace>(0, length),
+                                    f, result);
+          },
+          options, samples);
+      report.add(space_name, threads, "parallel_reduce", body, Bytes, length,
+                 samples);
+    }
+    {
+      ScanFunctor<ExecSpace, Bytes> f;
+      f.touch = touch;
+      time_launch(
+          [&]() {
+            Kokkos::parallel_scan(Kokkos::RangePolicy<ExecSpace>(0, length), f);
+            ExecSpace().fence();
+          },
+          options, samples);
+      report.add(space_name, threads, "parallel_scan", body, Bytes, length,
+                 samples);
+    }
+    {
+      TeamFunctor<ExecSpace, Bytes> f;
+      f.touch = touch;
+      time_launch(
+          [&]() {
+            Kokkos::parallel_for(Kokkos::TeamPolicy<ExecSpace>(length, 1), f);
+            ExecSpace().fence();
+          },
+          options, samples);
+      report.add(space_name, threads, "team_parallel_for", body, Bytes, length,
+                 samples);
+    }
+    {
+      MDRangeFunctor<ExecSpace, Bytes> f;
+      f.touch = touch;
+      using policy = Kokkos::MDRangePolicy<ExecSpace, Kokkos::Rank<2>>;
+      time_launch(
+          [&]() {
+            Kokkos::parallel_for(policy({0, 0}, {length, 1}), f);
+            ExecSpace().fence();
+          },
+          options, samples);
+      report.add(space_name, threads, "mdrange_parallel_for", body, Bytes,
+                 length, samples);
+    }
+  }
+}
+
+template <class ExecSpace>
+void run_functor_sizes(const char* const space_name, const int threads,
+                       const Options& options, Report& report) {
+  run_patterns<ExecSpace, 8>(space_name, threads, options, report);
+  run_patterns<ExecSpace, 256>(space_name, threads, options, report);
+  run_patterns<ExecSpace, 4096>(space_name, threads, options, report);
+}
+
+}  // namespace LaunchLatency
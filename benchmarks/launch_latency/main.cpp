@@ -0,0 +1,182 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+#include "launch_latency.hpp"
+
+// Re-initializes the host execution space with 'threads' threads and
+// times each of its dispatch strategies.
+template <class ExecSpace>
+struct Reinitialize;
+
+#if defined(KOKKOS_ENABLE_OPENMP)
+template <>
+struct Reinitialize<Kokkos::OpenMP> {
+  static void apply(const int threads) {
+    Kokkos::OpenMP::impl_finalize();
+    Kokkos::OpenMP::impl_initialize(threads);
+  }
+
+  static int num_dispatch() { return 1; }
+  static const char* set_dispatch(const int) { return "default"; }
+};
+#endif
+
+#if defined(KOKKOS_ENABLE_THREADS)
+template <>
+struct Reinitialize<Kokkos::Threads> {
+  static void apply(const int threads) {
+    Kokkos::Threads::impl_finalize();
+    Kokkos::Threads::impl_initialize(threads);
+  }
+
+  // Activation of the pool through the fan-in tree or by the master alone
+  static int num_dispatch() { return 2; }
+  static const char* set_dispatch(const int i) {
+    Kokkos::Impl::ThreadsExec::set_dispatch_tree(0 == i);
+    return 0 == i ? "tree" : "flat";
+  }
+};
+#endif
+
+template <class ExecSpace>
+void run_thread_counts(const char* const space_name, const int max_threads,
+                       const LaunchLatency::Options& options,
+                       LaunchLatency::Report& report) {
+  for (int threads = 1; threads <= max_threads;
+       threads = threads < max_threads ? std::min(2 * threads, max_threads)
+                                       : threads + 1) {
+    Reinitialize<ExecSpace>::apply(threads);
+    for (int i = 0; i < Reinitialize<ExecSpace>::num_dispatch(); ++i) {
+      report.set_dispatch(Reinitialize<ExecSpace>::set_dispatch(i));
+      LaunchLatency::run_functor_sizes<ExecSpace>(space_name, threads, options,
+                                                  report);
+    }
+    // Leave the default dispatch in place
+    Reinitialize<ExecSpace>::set_dispatch(0);
+    report.set_dispatch("default");
+  }
+}
+
+int main(int argc, char* argv[]) {
+  static const char help_flag[]        = "--help";
+  static const char max_threads_flag[] = "--max_threads=";
+  static const char samples_flag[]     = "--samples=";
+  static const char warmup_flag[]      = "--warmup=";
+  static const char length_flag[]      = "--length=";
+  static const char output_flag[]      = "--output=";
+
+  int max_threads = std::max(1u, std::thread::hardware_concurrency());
+  std::string output;
+
+  LaunchLatency::Options options;
+  options.samples = 1000;
+  options.warmup  = 100;
+  options.length  = 0;
+
+  int ask_help = 0;
+
+  for (int i = 1; i < argc; i++) {
+    const char* const a = argv[i];
+
+    if (!strncmp(a, help_flag, strlen(help_flag))) ask_help = 1;
+
+    if (!strncmp(a, max_threads_flag, strlen(max_threads_flag)))
+      max_threads = std::stoi(a + strlen(max_threads_flag));
+
+    if (!strncmp(a, samples_flag, strlen(samples_flag)))
+      options.samples = std::stoi(a + strlen(samples_flag));
+
+    if (!strncmp(a, warmup_flag, strlen(warmup_flag)))
+      options.warmup = std::stoi(a + strlen(warmup_flag));
+
+    if (!strncmp(a, length_flag, strlen(length_flag)))
+      options.length = std::stoi(a + strlen(length_flag));
+
+    if (!strncmp(a, output_flag, strlen(output_flag)))
+      output = a + strlen(output_flag);
+  }
+
+  if (ask_help || max_threads < 1 || options.samples < 1 ||
+      options.warmup < 0 || options.length < 0) {
+    std::cout << "command line options:"
+              << " " << help_flag << " " << max_threads_flag << "##"
+              << " " << samples_flag << "##"
+              << " " << warmup_flag << "##"
+              << " " << length_flag << "## (0 = one iteration per thread)"
+              << " " << output_flag << "file (default stdout)" << std::endl;
+    return ask_help ? 0 : -1;
+  }
+
+  FILE* const out = output.empty() ? stdout : fopen(output.c_str(), "w");
+  if (!out) {
+    std::cerr << "launch_latency: cannot open " << output << std::endl;
+    return -1;
+  }
+
+  Kokkos::initialize(argc, argv);
+  {
+    LaunchLatency::Report report(out, options);
+
+#if defined(KOKKOS_ENABLE_SERIAL)
+    LaunchLatency::run_functor_sizes<Kokkos::Serial>("Serial", 1, options,
+                                                     report);
+#endif
+#if defined(KOKKOS_ENABLE_OPENMP)
+    run_thread_counts<Kokkos::OpenMP>("OpenMP", max_threads, options, report);
+#endif
+#if defined(KOKKOS_ENABLE_THREADS)
+    run_thread_counts<Kokkos::Threads>("Threads", max_threads, options,
+                                       report);
+#endif
+  }
+  Kokkos::finalize();
+
+  if (out != stdout) fclose(out);
+
+  return 0;
+}
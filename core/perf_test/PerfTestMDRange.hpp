@@ -623,4 +623,95 @@ struct RangePolicyCollapseAll {
   }
 };
 
+template <class DeviceType, typename ScalarType = double,
+          typename TestLayout = Kokkos::LayoutRight>
+struct MultiDimRangeBandwidth {
+  using execution_space = DeviceType;
+
+  // Iterate in the order that is contiguous for the layout under test
+  static constexpr Kokkos::Iterate iterate =
+      std::is_same<TestLayout, Kokkos::LayoutRight>::value
+          ? Kokkos::Iterate::Right
+          : Kokkos::Iterate::Left;
+
+  using view_type = Kokkos::View<ScalarType ***, TestLayout, DeviceType>;
+  using policy_type =
+      Kokkos::MDRangePolicy<Kokkos::Rank<3, iterate, iterate>,
+                            execution_space>;
+  using range_type = Kokkos::RangePolicy<execution_space>;
+
+  // Scale kernel: A = s * B
+  struct MDScale {
+    view_type A;
+    view_type B;
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const long i, const long j, const long k) const {
+      A(i, j, k) = ScalarType(2) * B(i, j, k);
+    }
+  };
+
+  // Same kernel over the flattened allocation
+  struct FlatScale {
+    ScalarType *A;
+    const ScalarType *B;
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const long n) const { A[n] = ScalarType(2) * B[n]; }
+  };
+
+  template <class Policy, class Functor>
+  static double time_min(const Policy &policy, const Functor &f,
+                         const int repeat) {
+    double dt_min = 0;
+    for (int r = 0; r < repeat; ++r) {
+      Kokkos::Timer timer;
+      Kokkos::parallel_for(policy, f);
+      Kokkos::fence();
+      const double dt = timer.seconds();
+      if (0 == r || dt < dt_min) dt_min = dt;
+    }
+    return dt_min;
+  }
+
+  // Prints the bandwidth achieved by the MDRange scale kernel, with the
+  // default tiling and with tiles spanning the contiguous dimension, against
+  // the same kernel as a flattened RangePolicy loop. Returns the ratio of the
+  // best MDRange time to the RangePolicy time.
+  static double test_bandwidth(const long icount, const long jcount,
+                               const long kcount, const int repeat) {
+    view_type A("A", icount, jcount, kcount);
+    view_type B("B", icount, jcount, kcount);
+    Kokkos::deep_copy(B, ScalarType(1));
+
+    const long n       = icount * jcount * kcount;
+    const double bytes = 2.0 * n * sizeof(ScalarType);
+
+    const double dt_range = time_min(range_type(0, n),
+                                     FlatScale{A.data(), B.data()}, repeat);
+
+    const double dt_tiled =
+        time_min(policy_type({{0, 0, 0}}, {{icount, jcount, kcount}}),
+                 MDScale{A, B}, repeat);
+
+    const long tile_fast = iterate == Kokkos::Iterate::Right ? kcount : icount;
+    const double dt_span =
+        time_min(iterate == Kokkos::Iterate::Right
+                     ? policy_type({{0, 0, 0}}, {{icount, jcount, kcount}},
+                                   {{1, 4, tile_fast}})
+                     : policy_type({{0, 0, 0}}, {{icount, jcount, kcount}},
+                                   {{tile_fast, 4, 1}}),
+                 MDScale{A, B}, repeat);
+
+    printf("   Range:             %lf s   %lf GB/s\n", dt_range,
+           bytes / dt_range * 1.0e-9);
+    printf("   MDRange tiled:     %lf s   %lf GB/s\n", dt_tiled,
+           bytes / dt_tiled * 1.0e-9);
+    printf("   MDRange fast span: %lf s   %lf GB/s\n", dt_span,
+           bytes / dt_span * 1.0e-9);
+
+    return std::min(dt_tiled, dt_span) / dt_range;
+  }
+};
+
 }  // end namespace Test
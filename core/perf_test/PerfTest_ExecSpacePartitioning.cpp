@@ -35,6 +35,25 @@ struct SpaceInstance<Kokkos::Cuda> {
   }
 };
 #endif
+#ifdef KOKKOS_ENABLE_OPENMP
+template <>
+struct SpaceInstance<Kokkos::OpenMP> {
+  // Partition once and hand out the instances one by one, so that the
+  // two instances created by a test are the two halves of one partition.
+  static Kokkos::OpenMP create() {
+    static std::vector<Kokkos::OpenMP> instances;
+    if (instances.empty()) instances = Kokkos::OpenMP::partition(2);
+    Kokkos::OpenMP instance = instances.back();
+    instances.pop_back();
+    return instance;
+  }
+  static void destroy(Kokkos::OpenMP& space) { space = Kokkos::OpenMP(); }
+  // Two partitions run on the cores of the default instance's thread pool,
+  // so they are not expected to beat the default instance on kernels which
+  // scale with the number of threads; see overlap_openmp_partition.
+  static bool overlap() { return false; }
+};
+#endif
 #endif
 }  // namespace
 
@@ -629,4 +648,80 @@ TEST(default_exec, overlap_team_policy) {
   SpaceInstance<TEST_EXECSPACE>::destroy(space1);
   SpaceInstance<TEST_EXECSPACE>::destroy(space2);
 }
+
+#if defined(KOKKOS_ENABLE_OPENMP) && !defined(KOKKOS_ENABLE_DEBUG)
+struct FunctorWork {
+  int M;
+  Kokkos::View<double*, Kokkos::OpenMP> a;
+  FunctorWork(int M_, Kokkos::View<double*, Kokkos::OpenMP> a_)
+      : M(M_), a(a_) {}
+  void operator()(const int i) const {
+    double tmp = a(i);
+    for (int j = 0; j < M; j++) tmp = tmp * 0.999999 + 1.0;
+    a(i) = tmp;
+  }
+};
+
+// A large "interior" kernel which scales with the number of threads and a
+// small "halo" kernel with limited parallelism: on the default instance the
+// two kernels execute one after the other, on two partitions they overlap.
+TEST(default_exec, overlap_openmp_partition) {
+  std::vector<Kokkos::OpenMP> instances = Kokkos::OpenMP::partition(2);
+  if (instances.size() < 2) return;
+
+  const int partition_size = Kokkos::OpenMP::impl_thread_pool_size() / 2;
+  const int M              = 100000;
+  const int N_interior     = 32 * partition_size;
+  const int N_halo         = partition_size;
+
+  Kokkos::View<double*, Kokkos::OpenMP> interior("interior", N_interior);
+  Kokkos::View<double*, Kokkos::OpenMP> halo("halo", N_halo);
+
+  FunctorWork f_interior(M, interior);
+  FunctorWork f_halo(32 * M, halo);
+
+  Kokkos::OpenMP space;
+
+  Kokkos::parallel_for("default_exec::overlap_openmp_partition::warmup",
+                       Kokkos::RangePolicy<Kokkos::OpenMP>(space, 0, N_halo),
+                       f_halo);
+  Kokkos::fence();
+
+  Kokkos::Timer timer;
+  Kokkos::parallel_for(
+      "default_exec::overlap_openmp_partition::interior",
+      Kokkos::RangePolicy<Kokkos::OpenMP>(space, 0, N_interior), f_interior);
+  Kokkos::parallel_for("default_exec::overlap_openmp_partition::halo",
+                       Kokkos::RangePolicy<Kokkos::OpenMP>(space, 0, N_halo),
+                       f_halo);
+  space.fence();
+  double time_sequential = timer.seconds();
+
+  timer.reset();
+  Kokkos::parallel_for(
+      "default_exec::overlap_openmp_partition::interior",
+      Kokkos::RangePolicy<Kokkos::OpenMP>(instances[0], 0, N_interior),
+      f_interior);
+  Kokkos::parallel_for(
+      "default_exec::overlap_openmp_partition::halo",
+      Kokkos::RangePolicy<Kokkos::OpenMP>(instances[1], 0, N_halo), f_halo);
+  double time_launch = timer.seconds();
+  instances[0].fence();
+  instances[1].fence();
+  double time_overlap = timer.seconds();
+
+  ASSERT_TRUE(Kokkos::OpenMP::is_asynchronous(instances[0]));
+  ASSERT_FALSE(Kokkos::OpenMP::is_asynchronous(space));
+
+  // Each entry was updated the same number of times
+  for (int i = 1; i < N_interior; ++i) ASSERT_EQ(interior(i), interior(0));
+  for (int i = 1; i < N_halo; ++i) ASSERT_EQ(halo(i), halo(0));
+
+  printf(
+      "Time OpenMP partitions: Sequential: %lf Overlap: %lf Launch: %lf "
+      "Speedup: %lf\n",
+      time_sequential, time_overlap, time_launch,
+      time_sequential / time_overlap);
+}
+#endif
 }  // namespace Test
@@ -54,6 +54,7 @@ using ExecSpace   = Kokkos::DefaultExecutionSpace;
 using MemorySpace = Kokkos::DefaultExecutionSpace::memory_space;
 
 using MemoryPool = Kokkos::MemoryPool<ExecSpace>;
+using UniqueToken = Kokkos::Experimental::UniqueToken<ExecSpace>;
 
 struct TestFunctor {
   using ptrs_type = Kokkos::View<uintptr_t*, ExecSpace>;
@@ -61,6 +62,7 @@ struct TestFunctor {
   enum : unsigned { chunk = 32 };
 
   MemoryPool pool;
+  UniqueToken token;
   ptrs_type ptrs;
   unsigned chunk_span;
   unsigned fill_stride;
@@ -69,14 +71,21 @@ struct TestFunctor {
 
   TestFunctor(size_t total_alloc_size, unsigned min_superblock_size,
               unsigned number_alloc, unsigned arg_stride_alloc,
-              unsigned arg_chunk_span, unsigned arg_repeat)
-      : pool(), ptrs(), chunk_span(0), fill_stride(0), repeat_inner(0) {
+              unsigned arg_chunk_span, unsigned arg_repeat,
+              unsigned magazine_capacity)
+      : pool(),
+        token(),
+        ptrs(),
+        chunk_span(0),
+        fill_stride(0),
+        repeat_inner(0) {
     MemorySpace m;
 
     const unsigned min_block_size = chunk;
     const unsigned max_block_size = chunk * arg_chunk_span;
+    const unsigned magazine_count = magazine_capacity ? token.size() : 0;
     pool = MemoryPool(m, total_alloc_size, min_block_size, max_block_size,
-                      min_superblock_size);
+                      min_superblock_size, magazine_count, magazine_capacity);
 
     ptrs         = ptrs_type(Kokkos::view_alloc(m, "ptrs"), number_alloc);
     fill_stride  = arg_stride_alloc;
@@ -150,15 +159,21 @@ struct TestFunctor {
       const int j = i / fill_stride;
 
       if (0 == j % 3) {
+        // Without magazines the pool ignores the id, so don't bother
+        // acquiring one
+        const int id = pool.magazine_count() ? int(token.acquire()) : -1;
+
         for (unsigned k = 0; k < repeat_inner; ++k) {
           const unsigned size_alloc = chunk * (1 + (j % chunk_span));
 
-          pool.deallocate((void*)ptrs(j), size_alloc);
+          pool.deallocate_cached(id, (void*)ptrs(j), size_alloc);
 
-          ptrs(j) = (uintptr_t)pool.allocate(size_alloc);
+          ptrs(j) = (uintptr_t)pool.allocate_cached(id, size_alloc);
 
           if (0 == ptrs(j)) update++;
         }
+
+        if (0 <= id) token.release(id);
       }
     }
   }
@@ -183,6 +198,7 @@ int main(int argc, char* argv[]) {
   static const char fill_level_flag[]   = "--fill_level=";
   static const char repeat_outer_flag[] = "--repeat_outer=";
   static const char repeat_inner_flag[] = "--repeat_inner=";
+  static const char magazine_flag[]      = "--magazine=";
 
   long total_alloc_size   = 1000000;
   int min_superblock_size = 10000;
@@ -191,6 +207,7 @@ int main(int argc, char* argv[]) {
   int fill_level          = 70;
   int repeat_outer        = 1;
   int repeat_inner        = 1;
+  int magazine            = 0;
 
   int ask_help = 0;
 
@@ -219,6 +236,9 @@ int main(int argc, char* argv[]) {
 
     if (!strncmp(a, repeat_inner_flag, strlen(repeat_inner_flag)))
       repeat_inner = std::stoi(a + strlen(repeat_inner_flag));
+
+    if (!strncmp(a, magazine_flag, strlen(magazine_flag)))
+      magazine = std::stoi(a + strlen(magazine_flag));
   }
 
   int chunk_span_bytes = 0;
@@ -249,7 +269,8 @@ int main(int argc, char* argv[]) {
               << " " << fill_level_flag << "##"
               << " " << chunk_span_flag << "##"
               << " " << repeat_outer_flag << "##"
-              << " " << repeat_inner_flag << "##" << std::endl;
+              << " " << repeat_inner_flag << "##"
+              << " " << magazine_flag << "##" << std::endl;
     return 0;
   }
 
@@ -264,7 +285,7 @@ int main(int argc, char* argv[]) {
   // one alloc in fill, alloc/dealloc pair in repeat_inner
   for (int i = 0; i < repeat_outer; ++i) {
     TestFunctor functor(total_alloc_size, min_superblock_size, number_alloc,
-                        fill_stride, chunk_span, repeat_inner);
+                        fill_stride, chunk_span, repeat_inner, magazine);
 
     Kokkos::Impl::Timer timer;
 
@@ -293,10 +314,10 @@ int main(int argc, char* argv[]) {
   Kokkos::finalize();
 
   printf(
-      "\"mempool: alloc super stride level span inner outer number\" %ld %d %d "
-      "%d %d %d %d %d\n",
+      "\"mempool: alloc super stride level span inner outer number magazine\" "
+      "%ld %d %d %d %d %d %d %d %d\n",
       total_alloc_size, min_superblock_size, fill_stride, fill_level,
-      chunk_span, repeat_inner, repeat_outer, number_alloc);
+      chunk_span, repeat_inner, repeat_outer, number_alloc, magazine);
 
   auto avg_fill_time  = sum_fill_time / repeat_outer;
   auto avg_cycle_time = sum_cycle_time / repeat_outer;
@@ -0,0 +1,199 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <thread>
+
+#include <Kokkos_Core.hpp>
+#include <impl/Kokkos_Timer.hpp>
+
+// Compare the flat pool reduction of the OpenMP backend, where the master
+// joins the contributions of all threads, with the two level reduction
+// through locality domains on 1, 2, 4, ... max_threads threads.
+// The domain size is detected from the topology unless given with
+// '--domain_size=##', which allows to exercise the two level reduction
+// on a single socket.
+
+#if defined(KOKKOS_ENABLE_OPENMP)
+
+template <int N>
+struct SmallReduce {
+  using value_type = double[];
+
+  const unsigned value_count = N;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, value_type update) const {
+    for (int j = 0; j < N; ++j) update[j] += i;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void init(value_type update) const {
+    for (int j = 0; j < N; ++j) update[j] = 0;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void join(volatile value_type update,
+            const volatile value_type input) const {
+    for (int j = 0; j < N; ++j) update[j] += input[j];
+  }
+};
+
+template <int N>
+void time_reduce(const int nthreads, const int repeat_outer,
+                 const int repeat_inner, double& min_time, double& avg_time) {
+  using policy = Kokkos::RangePolicy<Kokkos::OpenMP>;
+
+  double result[N];
+  double sum_time = 0;
+  min_time        = std::numeric_limits<double>::max();
+
+  for (int i = 0; i < repeat_outer; ++i) {
+    Kokkos::Impl::Timer timer;
+    for (int j = 0; j < repeat_inner; ++j) {
+      Kokkos::parallel_reduce(policy(0, nthreads), SmallReduce<N>(), result);
+    }
+    const double t = timer.seconds() / repeat_inner;
+    sum_time += t;
+    min_time = std::min(min_time, t);
+  }
+  avg_time = sum_time / repeat_outer;
+
+  if (result[N - 1] != 0.5 * nthreads * (nthreads - 1)) {
+    printf("reduction latency: ERROR wrong result %g\n", result[N - 1]);
+  }
+}
+
+template <int N>
+void run(const int nthreads, const char* const reduction,
+         const int repeat_outer, const int repeat_inner) {
+  double min_time, avg_time;
+
+  time_reduce<N>(nthreads, repeat_outer, repeat_inner, min_time, avg_time);
+
+  printf(
+      "\"reduction latency: parallel_reduce openmp us (min, avg)\" "
+      "%d %s %d %.3f %.3f\n",
+      nthreads, reduction, N, 1.0e6 * min_time, 1.0e6 * avg_time);
+}
+
+int main(int argc, char* argv[]) {
+  static const char help_flag[]         = "--help";
+  static const char max_threads_flag[]  = "--max_threads=";
+  static const char domain_size_flag[]  = "--domain_size=";
+  static const char repeat_outer_flag[] = "--repeat_outer=";
+  static const char repeat_inner_flag[] = "--repeat_inner=";
+
+  int max_threads  = std::max(1u, std::thread::hardware_concurrency());
+  int domain_size  = 0;
+  int repeat_outer = 10;
+  int repeat_inner = 1000;
+
+  int ask_help = 0;
+
+  for (int i = 1; i < argc; i++) {
+    const char* const a = argv[i];
+
+    if (!strncmp(a, help_flag, strlen(help_flag))) ask_help = 1;
+
+    if (!strncmp(a, max_threads_flag, strlen(max_threads_flag)))
+      max_threads = std::stoi(a + strlen(max_threads_flag));
+
+    if (!strncmp(a, domain_size_flag, strlen(domain_size_flag)))
+      domain_size = std::stoi(a + strlen(domain_size_flag));
+
+    if (!strncmp(a, repeat_outer_flag, strlen(repeat_outer_flag)))
+      repeat_outer = std::stoi(a + strlen(repeat_outer_flag));
+
+    if (!strncmp(a, repeat_inner_flag, strlen(repeat_inner_flag)))
+      repeat_inner = std::stoi(a + strlen(repeat_inner_flag));
+  }
+
+  if (ask_help) {
+    std::cout << "command line options:"
+              << " " << help_flag << " " << max_threads_flag << "##"
+              << " " << domain_size_flag << "##"
+              << " " << repeat_outer_flag << "##"
+              << " " << repeat_inner_flag << "##" << std::endl;
+    return 0;
+  }
+
+  Kokkos::initialize(argc, argv);
+
+  for (int nthreads = 1; nthreads <= max_threads; nthreads *= 2) {
+    for (int two_level = 0; two_level < 2; ++two_level) {
+      // Pools organized within a single domain are joined flat.
+      Kokkos::Impl::HostThreadTeamData::set_pool_domain_size(
+          two_level ? domain_size : std::numeric_limits<int>::max());
+
+      Kokkos::OpenMP::impl_finalize();
+      Kokkos::OpenMP::impl_initialize(nthreads);
+
+      const char* const reduction = two_level ? "two_level" : "flat";
+
+      run<1>(nthreads, reduction, repeat_outer, repeat_inner);
+      run<16>(nthreads, reduction, repeat_outer, repeat_inner);
+      run<128>(nthreads, reduction, repeat_outer, repeat_inner);
+    }
+  }
+
+  Kokkos::Impl::HostThreadTeamData::set_pool_domain_size(0);
+
+  Kokkos::finalize();
+
+  return 0;
+}
+
+#else
+
+int main() {
+  printf("reduction latency: requires the OpenMP backend\n");
+  return 0;
+}
+
+#endif
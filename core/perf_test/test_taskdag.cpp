@@ -242,6 +242,13 @@ int main(int argc, char* argv[]) {
     printf("\"taskdag: time (min, avg)\" %g %g\n", min_time, avg_time);
     printf("\"taskdag: tasks per second (max, avg)\" %g %g\n",
            number_alloc / min_time, number_alloc / avg_time);
+
+    // Steals from teams in the same package versus other packages,
+    // accumulated over all runs
+    const auto steals = sched.queue().steal_counts();
+    printf("\"taskdag: steals (local, remote)\" %llu %llu\n",
+           static_cast<unsigned long long>(steals.local),
+           static_cast<unsigned long long>(steals.remote));
   }  // end scope to destroy scheduler prior to finalize
 
   Kokkos::finalize();
@@ -0,0 +1,344 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_StaticCrsGraph.hpp>
+#include <impl/Kokkos_Timer.hpp>
+
+// Sparse lower triangular solve L x = b scheduled two ways:
+//
+//   level set:  rows are grouped by their depth in the dependence graph
+//               and each level is a parallel_for over its rows;
+//   DAG:        a single parallel_for over a WorkGraphPolicy whose graph
+//               is the transpose of the dependence graph, so a row runs
+//               as soon as the rows it depends on are solved.
+//
+// The strictly lower part of L is held in a StaticCrsGraph.  Two matrices
+// are generated: the lower part of a 2D five point stencil, whose levels
+// are the anti-diagonals of the grid, and a banded matrix with random
+// dependences, whose levels are narrow and numerous.
+
+using execution_space = Kokkos::DefaultExecutionSpace;
+using graph_type      = Kokkos::StaticCrsGraph<int, execution_space>;
+using values_type     = Kokkos::View<double*, execution_space>;
+using workgraph_type  = Kokkos::WorkGraphPolicy<int, execution_space>;
+
+struct LowerTriangular {
+  graph_type graph;    // strictly lower part
+  values_type values;  // entries of the strictly lower part
+  values_type diagonal;
+
+  std::vector<int> row_map;
+  std::vector<int> entries;
+};
+
+void form_matrix(LowerTriangular& L, std::vector<int> const& row_map,
+                 std::vector<int> const& entries) {
+  const int n = int(row_map.size()) - 1;
+
+  std::vector<std::vector<int> > rows(n);
+  for (int i = 0; i < n; ++i) {
+    rows[i].assign(entries.begin() + row_map[i],
+                   entries.begin() + row_map[i + 1]);
+  }
+
+  L.graph    = Kokkos::create_staticcrsgraph<graph_type>("L", rows);
+  L.values   = values_type("values", entries.size());
+  L.diagonal = values_type("diagonal", n);
+  L.row_map  = row_map;
+  L.entries  = entries;
+
+  Kokkos::deep_copy(L.values, -1.0 / 8);
+  Kokkos::deep_copy(L.diagonal, 1.0);
+}
+
+// Lower part of the five point stencil on an m x m grid
+void form_grid(LowerTriangular& L, const int m) {
+  std::vector<int> row_map(1, 0), entries;
+  for (int y = 0; y < m; ++y) {
+    for (int x = 0; x < m; ++x) {
+      const int i = y * m + x;
+      if (y) entries.push_back(i - m);
+      if (x) entries.push_back(i - 1);
+      row_map.push_back(int(entries.size()));
+    }
+  }
+  form_matrix(L, row_map, entries);
+}
+
+// Each row depends on up to 'k' random rows within 'band' rows above it
+void form_random(LowerTriangular& L, const int n, const int k,
+                 const int band) {
+  std::mt19937 gen(5489u);
+  std::vector<int> row_map(1, 0), entries;
+  for (int i = 0; i < n; ++i) {
+    std::vector<int> deps;
+    for (int j = 0; j < k && 0 < i; ++j) {
+      const int lo = std::max(0, i - band);
+      deps.push_back(lo + int(gen() % unsigned(i - lo)));
+    }
+    std::sort(deps.begin(), deps.end());
+    deps.erase(std::unique(deps.begin(), deps.end()), deps.end());
+    entries.insert(entries.end(), deps.begin(), deps.end());
+    row_map.push_back(int(entries.size()));
+  }
+  form_matrix(L, row_map, entries);
+}
+
+struct SolveRow {
+  graph_type graph;
+  values_type values;
+  values_type diagonal;
+  values_type b;
+  values_type x;
+  Kokkos::View<const int*, execution_space> rows;
+
+  KOKKOS_INLINE_FUNCTION
+  void solve(const int i) const {
+    double sum = b(i);
+    for (int k = graph.row_map(i); k < int(graph.row_map(i + 1)); ++k) {
+      sum -= values(k) * x(graph.entries(k));
+    }
+    x(i) = sum / diagonal(i);
+  }
+
+  // Level set: the i-th row of the current level
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const { solve(rows(i)); }
+};
+
+struct SolveRowDAG : SolveRow {
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const { solve(i); }
+};
+
+double run_level_set(LowerTriangular const& L, SolveRow f, int& num_levels) {
+  const int n = int(L.row_map.size()) - 1;
+
+  // Level of a row is one more than the deepest row it depends on
+  std::vector<int> level(n, 0);
+  num_levels = 0;
+  for (int i = 0; i < n; ++i) {
+    for (int k = L.row_map[i]; k < L.row_map[i + 1]; ++k) {
+      level[i] = std::max(level[i], level[L.entries[k]] + 1);
+    }
+    num_levels = std::max(num_levels, level[i] + 1);
+  }
+
+  std::vector<int> level_ptr(num_levels + 1, 0);
+  for (int i = 0; i < n; ++i) ++level_ptr[level[i] + 1];
+  for (int l = 0; l < num_levels; ++l) level_ptr[l + 1] += level_ptr[l];
+
+  Kokkos::View<int*, execution_space> rows("rows", n);
+  {
+    auto h_rows           = Kokkos::create_mirror_view(rows);
+    std::vector<int> fill = level_ptr;
+    for (int i = 0; i < n; ++i) h_rows(fill[level[i]]++) = i;
+    Kokkos::deep_copy(rows, h_rows);
+  }
+  f.rows = rows;
+
+  Kokkos::Impl::Timer timer;
+  for (int l = 0; l < num_levels; ++l) {
+    Kokkos::parallel_for(
+        "sptrsv_level",
+        Kokkos::RangePolicy<execution_space>(level_ptr[l], level_ptr[l + 1]),
+        f);
+  }
+  Kokkos::fence();
+  return timer.seconds();
+}
+
+double run_dag(LowerTriangular const& L, SolveRowDAG const& f) {
+  const int n = int(L.row_map.size()) - 1;
+
+  // The work graph lists for each row the rows that depend on it
+  std::vector<int> count(n + 1, 0);
+  for (int e : L.entries) ++count[e + 1];
+  for (int i = 0; i < n; ++i) count[i + 1] += count[i];
+
+  workgraph_type::graph_type dag;
+  dag.row_map = decltype(dag.row_map)("row_map", n + 1);
+  dag.entries = decltype(dag.entries)("entries", L.entries.size());
+  {
+    auto h_row_map = Kokkos::create_mirror_view(dag.row_map);
+    auto h_entries = Kokkos::create_mirror_view(dag.entries);
+    for (int i = 0; i <= n; ++i) h_row_map(i) = count[i];
+    for (int i = 0; i < n; ++i) {
+      for (int k = L.row_map[i]; k < L.row_map[i + 1]; ++k) {
+        h_entries(count[L.entries[k]]++) = i;
+      }
+    }
+    Kokkos::deep_copy(dag.row_map, h_row_map);
+    Kokkos::deep_copy(dag.entries, h_entries);
+  }
+
+  // Constructing the policy computes the dependence counts,
+  // which is part of the cost of every solve
+  Kokkos::Impl::Timer timer;
+  Kokkos::parallel_for("sptrsv_dag", workgraph_type(dag), f);
+  Kokkos::fence();
+  return timer.seconds();
+}
+
+double max_error(values_type const& x, std::vector<double> const& expected) {
+  auto h_x   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x);
+  double err = 0;
+  for (size_t i = 0; i < expected.size(); ++i) {
+    err = std::max(err, std::abs(h_x(i) - expected[i]));
+  }
+  return err;
+}
+
+void run(const char* const name, LowerTriangular const& L, const int repeat) {
+  const int n = int(L.row_map.size()) - 1;
+
+  // Serial reference solution
+  std::vector<double> expected(n);
+  for (int i = 0; i < n; ++i) {
+    double sum = 1.0;
+    for (int k = L.row_map[i]; k < L.row_map[i + 1]; ++k) {
+      sum += expected[L.entries[k]] / 8;
+    }
+    expected[i] = sum;
+  }
+
+  SolveRowDAG f;
+  f.graph    = L.graph;
+  f.values   = L.values;
+  f.diagonal = L.diagonal;
+  f.b        = values_type("b", n);
+  f.x        = values_type("x", n);
+  Kokkos::deep_copy(f.b, 1.0);
+
+  double t_level = std::numeric_limits<double>::max();
+  double t_dag   = std::numeric_limits<double>::max();
+  int num_levels = 0;
+
+  for (int r = 0; r < repeat; ++r) {
+    Kokkos::deep_copy(f.x, 0.0);
+    t_level = std::min(t_level, run_level_set(L, f, num_levels));
+    if (1.0e-8 < max_error(f.x, expected)) {
+      printf("workgraph sptrsv: ERROR level set solution of %s\n", name);
+    }
+
+    Kokkos::deep_copy(f.x, 0.0);
+    t_dag = std::min(t_dag, run_dag(L, f));
+    if (1.0e-8 < max_error(f.x, expected)) {
+      printf("workgraph sptrsv: ERROR DAG solution of %s\n", name);
+    }
+  }
+
+  printf(
+      "\"workgraph sptrsv: matrix rows nnz levels level_set_ms dag_ms\" "
+      "%s %d %d %d %.3f %.3f\n",
+      name, n, int(L.entries.size()), num_levels, 1.0e3 * t_level,
+      1.0e3 * t_dag);
+}
+
+int main(int argc, char* argv[]) {
+  static const char help_flag[]   = "--help";
+  static const char grid_flag[]   = "--grid=";
+  static const char rows_flag[]   = "--rows=";
+  static const char band_flag[]   = "--band=";
+  static const char repeat_flag[] = "--repeat=";
+
+  int grid   = 512;
+  int rows   = 1 << 18;
+  int band   = 64;
+  int repeat = 5;
+
+  int ask_help = 0;
+
+  for (int i = 1; i < argc; i++) {
+    const char* const a = argv[i];
+
+    if (!strncmp(a, help_flag, strlen(help_flag))) ask_help = 1;
+
+    if (!strncmp(a, grid_flag, strlen(grid_flag)))
+      grid = std::stoi(a + strlen(grid_flag));
+
+    if (!strncmp(a, rows_flag, strlen(rows_flag)))
+      rows = std::stoi(a + strlen(rows_flag));
+
+    if (!strncmp(a, band_flag, strlen(band_flag)))
+      band = std::stoi(a + strlen(band_flag));
+
+    if (!strncmp(a, repeat_flag, strlen(repeat_flag)))
+      repeat = std::stoi(a + strlen(repeat_flag));
+  }
+
+  if (ask_help) {
+    std::cout << "command line options:"
+              << " " << help_flag << " " << grid_flag << "##"
+              << " " << rows_flag << "##"
+              << " " << band_flag << "##"
+              << " " << repeat_flag << "##" << std::endl;
+    return 0;
+  }
+
+  Kokkos::initialize(argc, argv);
+  {
+    LowerTriangular grid_matrix;
+    form_grid(grid_matrix, grid);
+    run("grid", grid_matrix, repeat);
+
+    LowerTriangular random_matrix;
+    form_random(random_matrix, rows, 4, band);
+    run("random", random_matrix, repeat);
+  }
+  Kokkos::finalize();
+
+  return 0;
+}
@@ -438,17 +438,17 @@ std::string SharedAllocationRecord<Kokkos::CudaSpace, void>::get_label() const {
   Kokkos::Impl::DeepCopy<Kokkos::HostSpace, Kokkos::CudaSpace>(
       &header, RecordBase::head(), sizeof(SharedAllocationHeader));
 
-  return std::string(header.m_label);
+  return std::string(header.label());
 }
 
 std::string SharedAllocationRecord<Kokkos::CudaUVMSpace, void>::get_label()
     const {
-  return std::string(RecordBase::head()->m_label);
+  return std::string(RecordBase::head()->label());
 }
 
 std::string
 SharedAllocationRecord<Kokkos::CudaHostPinnedSpace, void>::get_label() const {
-  return std::string(RecordBase::head()->m_label);
+  return std::string(RecordBase::head()->label());
 }
 
 // </editor-fold> end SharedAllocationRecord::get_label() }}}1
@@ -521,7 +521,7 @@ SharedAllocationRecord<Kokkos::CudaSpace, void>::~SharedAllocationRecord() {
 SharedAllocationRecord<Kokkos::CudaUVMSpace, void>::~SharedAllocationRecord() {
   const char *label = nullptr;
   if (Kokkos::Profiling::profileLibraryLoaded()) {
-    label = RecordBase::m_alloc_ptr->m_label;
+    label = RecordBase::m_alloc_ptr->label();
   }
   m_space.deallocate(label, SharedAllocationRecord<void, void>::m_alloc_ptr,
                      SharedAllocationRecord<void, void>::m_alloc_size,
@@ -531,7 +531,7 @@ SharedAllocationRecord<Kokkos::CudaUVMSpace, void>::~SharedAllocationRecord() {
 
 SharedAllocationRecord<Kokkos::CudaHostPinnedSpace,
                        void>::~SharedAllocationRecord() {
-  m_space.deallocate(RecordBase::m_alloc_ptr->m_label,
+  m_space.deallocate(RecordBase::m_alloc_ptr->label(),
                      SharedAllocationRecord<void, void>::m_alloc_ptr,
                      SharedAllocationRecord<void, void>::m_alloc_size,
                      (SharedAllocationRecord<void, void>::m_alloc_size -
@@ -565,10 +565,7 @@ SharedAllocationRecord<Kokkos::CudaSpace, void>::SharedAllocationRecord(
   // Fill in the Header information
   header.m_record = static_cast<SharedAllocationRecord<void, void> *>(this);
 
-  strncpy(header.m_label, arg_label.c_str(),
-          SharedAllocationHeader::maximum_label_length);
-  // Set last element zero, in case c_str is too long
-  header.m_label[SharedAllocationHeader::maximum_label_length - 1] = (char)0;
+  header.set_label(arg_label);
 
   // Copy to device memory
   Kokkos::Impl::DeepCopy<CudaSpace, HostSpace>(RecordBase::m_alloc_ptr, &header,
@@ -594,12 +591,7 @@ SharedAllocationRecord<Kokkos::CudaUVMSpace, void>::SharedAllocationRecord(
 
   RecordBase::m_alloc_ptr->m_record = this;
 
-  strncpy(RecordBase::m_alloc_ptr->m_label, arg_label.c_str(),
-          SharedAllocationHeader::maximum_label_length);
-
-  // Set last element zero, in case c_str is too long
-  RecordBase::m_alloc_ptr
-      ->m_label[SharedAllocationHeader::maximum_label_length - 1] = (char)0;
+  RecordBase::m_alloc_ptr->set_label(arg_label);
 }
 
 SharedAllocationRecord<Kokkos::CudaHostPinnedSpace, void>::
@@ -622,11 +614,7 @@ SharedAllocationRecord<Kokkos::CudaHostPinnedSpace, void>::
 
   RecordBase::m_alloc_ptr->m_record = this;
 
-  strncpy(RecordBase::m_alloc_ptr->m_label, arg_label.c_str(),
-          SharedAllocationHeader::maximum_label_length);
-  // Set last element zero, in case c_str is too long
-  RecordBase::m_alloc_ptr
-      ->m_label[SharedAllocationHeader::maximum_label_length - 1] = (char)0;
+  RecordBase::m_alloc_ptr->set_label(arg_label);
 }
 
 // </editor-fold> end SharedAllocationRecord constructors }}}1
@@ -843,7 +831,7 @@ void SharedAllocationRecord<Kokkos::CudaSpace, void>::print_records(
         Kokkos::Impl::DeepCopy<HostSpace, CudaSpace>(
             &head, r->m_alloc_ptr, sizeof(SharedAllocationHeader));
       } else {
-        head.m_label[0] = 0;
+        head.set_label("");
       }
 
       // Formatting dependent on sizeof(uintptr_t)
@@ -864,7 +852,7 @@ void SharedAllocationRecord<Kokkos::CudaSpace, void>::print_records(
                reinterpret_cast<uintptr_t>(r->m_next),
                reinterpret_cast<uintptr_t>(r->m_alloc_ptr), r->m_alloc_size,
                r->m_count, reinterpret_cast<uintptr_t>(r->m_dealloc),
-               head.m_label);
+               head.label());
       s << buffer;
       r = r->m_next;
     } while (r != &s_root_record);
@@ -885,7 +873,7 @@ void SharedAllocationRecord<Kokkos::CudaSpace, void>::print_records(
 
         snprintf(buffer, 256, format_string,
                  reinterpret_cast<uintptr_t>(r->data()), r->size(),
-                 head.m_label);
+                 head.label());
       } else {
         snprintf(buffer, 256, "Cuda [ 0 + 0 ]\n");
       }
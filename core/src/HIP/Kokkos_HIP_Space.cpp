@@ -314,12 +314,12 @@ std::string SharedAllocationRecord<Kokkos::Experimental::HIPSpace,
   Kokkos::Impl::DeepCopy<Kokkos::HostSpace, Kokkos::Experimental::HIPSpace>(
       &header, RecordBase::head(), sizeof(SharedAllocationHeader));
 
-  return std::string(header.m_label);
+  return std::string(header.label());
 }
 
 std::string SharedAllocationRecord<Kokkos::Experimental::HIPHostPinnedSpace,
                                    void>::get_label() const {
-  return std::string(RecordBase::head()->m_label);
+  return std::string(RecordBase::head()->label());
 }
 
 SharedAllocationRecord<Kokkos::Experimental::HIPSpace, void>*
@@ -362,7 +362,7 @@ SharedAllocationRecord<Kokkos::Experimental::HIPSpace,
 
 SharedAllocationRecord<Kokkos::Experimental::HIPHostPinnedSpace,
                        void>::~SharedAllocationRecord() {
-  m_space.deallocate(RecordBase::m_alloc_ptr->m_label,
+  m_space.deallocate(RecordBase::m_alloc_ptr->label(),
                      SharedAllocationRecord<void, void>::m_alloc_ptr,
                      SharedAllocationRecord<void, void>::m_alloc_size);
 }
@@ -389,10 +389,7 @@ SharedAllocationRecord<Kokkos::Experimental::HIPSpace, void>::
   // Fill in the Header information
   header.m_record = static_cast<SharedAllocationRecord<void, void>*>(this);
 
-  strncpy(header.m_label, arg_label.c_str(),
-          SharedAllocationHeader::maximum_label_length);
-  // Set last element zero, in case c_str is too long
-  header.m_label[SharedAllocationHeader::maximum_label_length - 1] = (char)0;
+  header.set_label(arg_label);
 
   // Copy to device memory
   Kokkos::Impl::DeepCopy<Kokkos::Experimental::HIPSpace, HostSpace>(
@@ -419,11 +416,7 @@ SharedAllocationRecord<Kokkos::Experimental::HIPHostPinnedSpace, void>::
 
   RecordBase::m_alloc_ptr->m_record = this;
 
-  strncpy(RecordBase::m_alloc_ptr->m_label, arg_label.c_str(),
-          SharedAllocationHeader::maximum_label_length);
-  // Set last element zero, in case c_str is too long
-  RecordBase::m_alloc_ptr
-      ->m_label[SharedAllocationHeader::maximum_label_length - 1] = (char)0;
+  RecordBase::m_alloc_ptr->set_label(arg_label);
 }
 
 //----------------------------------------------------------------------------
@@ -576,7 +569,7 @@ void SharedAllocationRecord<Kokkos::Experimental::HIPSpace, void>::
         Kokkos::Impl::DeepCopy<HostSpace, Kokkos::Experimental::HIPSpace>(
             &head, r->m_alloc_ptr, sizeof(SharedAllocationHeader));
       } else {
-        head.m_label[0] = 0;
+        head.set_label("");
       }
 
       // Formatting dependent on sizeof(uintptr_t)
@@ -597,7 +590,7 @@ void SharedAllocationRecord<Kokkos::Experimental::HIPSpace, void>::
                reinterpret_cast<uintptr_t>(r->m_next),
                reinterpret_cast<uintptr_t>(r->m_alloc_ptr), r->m_alloc_size,
                r->m_count, reinterpret_cast<uintptr_t>(r->m_dealloc),
-               head.m_label);
+               head.label());
       std::cout << buffer;
       r = r->m_next;
     } while (r != &s_root_record);
@@ -618,7 +611,7 @@ void SharedAllocationRecord<Kokkos::Experimental::HIPSpace, void>::
 
         snprintf(buffer, 256, format_string,
                  reinterpret_cast<uintptr_t>(r->data()), r->size(),
-                 head.m_label);
+                 head.label());
       } else {
         snprintf(buffer, 256, "HIP [ 0 + 0 ]\n");
       }
@@ -50,6 +50,7 @@
 #include <Kokkos_Layout.hpp>
 
 #include <impl/KokkosExp_Host_IterateTile.hpp>
+#include <impl/KokkosExp_MDRangeTiling.hpp>
 #include <Kokkos_ExecPolicy.hpp>
 #include <Kokkos_Parallel.hpp>
 
@@ -168,6 +169,8 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
   point_type m_tile_end;
   index_type m_num_tiles;
   index_type m_prod_tile_dims;
+  // Host tile sizes were chosen automatically and may be tuned per kernel
+  bool m_tune_tile;
 
   /*
     // NDE enum impl definition alternative - replace static constexpr int ?
@@ -207,7 +210,7 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
   MDRangePolicy(std::initializer_list<LT> const& lower,
                 std::initializer_list<UT> const& upper,
                 std::initializer_list<TT> const& tile = {})
-      : m_space() {
+      : m_space(), m_tune_tile(false) {
     init(lower, upper, tile);
   }
 
@@ -216,7 +219,7 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
                 std::initializer_list<LT> const& lower,
                 std::initializer_list<UT> const& upper,
                 std::initializer_list<TT> const& tile = {})
-      : m_space(work_space) {
+      : m_space(work_space), m_tune_tile(false) {
     init(lower, upper, tile);
   }
 
@@ -227,7 +230,8 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
         m_upper(upper),
         m_tile(tile),
         m_num_tiles(1),
-        m_prod_tile_dims(1) {
+        m_prod_tile_dims(1),
+        m_tune_tile(false) {
     init();
   }
 
@@ -239,7 +243,8 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
         m_upper(upper),
         m_tile(tile),
         m_num_tiles(1),
-        m_prod_tile_dims(1) {
+        m_prod_tile_dims(1),
+        m_tune_tile(false) {
     init();
   }
 
@@ -251,7 +256,8 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
         m_tile(p.m_tile),
         m_tile_end(p.m_tile_end),
         m_num_tiles(p.m_num_tiles),
-        m_prod_tile_dims(p.m_prod_tile_dims) {}
+        m_prod_tile_dims(p.m_prod_tile_dims),
+        m_tune_tile(p.m_tune_tile) {}
 
  private:
   void init() {
@@ -269,22 +275,7 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
                          Kokkos::Experimental::HIP>::value
 #endif
     ) {
-      index_type span;
-      for (int i = 0; i < rank; ++i) {
-        span = m_upper[i] - m_lower[i];
-        if (m_tile[i] <= 0) {
-          if (((int)inner_direction == (int)Right && (i < rank - 1)) ||
-              ((int)inner_direction == (int)Left && (i > 0))) {
-            m_tile[i] = 2;
-          } else {
-            m_tile[i] = (span == 0 ? 1 : span);
-          }
-        }
-        m_tile_end[i] =
-            static_cast<index_type>((span + m_tile[i] - 1) / m_tile[i]);
-        m_num_tiles *= m_tile_end[i];
-        m_prod_tile_dims *= m_tile[i];
-      }
+      init_host_tile();
     }
 #if defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_HIP)
     else  // Cuda
@@ -389,6 +380,29 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
 #endif
   }
 
+  // Tile sizes not given are chosen from the host cache hierarchy.
+  void init_host_tile() {
+    static_assert(std::is_same<array_index_type, long>::value,
+                  "mdrange_host_tile takes extents and tiles of type long");
+    point_type span;
+    m_tune_tile = true;
+    for (int i = 0; i < rank; ++i) {
+      span[i] = m_upper[i] - m_lower[i];
+      if (0 < m_tile[i]) m_tune_tile = false;
+    }
+
+    Kokkos::Impl::mdrange_host_tile(rank, (int)inner_direction == (int)Right,
+                                    span.data(), m_tile.data(),
+                                    m_space.concurrency());
+
+    for (int i = 0; i < rank; ++i) {
+      m_tile_end[i] =
+          static_cast<index_type>((span[i] + m_tile[i] - 1) / m_tile[i]);
+      m_num_tiles *= m_tile_end[i];
+      m_prod_tile_dims *= m_tile[i];
+    }
+  }
+
   template <typename LT, typename UT, typename TT = array_index_type>
   void init(std::initializer_list<LT> const& lower,
             std::initializer_list<UT> const& upper,
@@ -424,22 +438,7 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
                          Kokkos::Experimental::HIP>::value
 #endif
     ) {
-      index_type span;
-      for (int i = 0; i < rank; ++i) {
-        span = m_upper[i] - m_lower[i];
-        if (m_tile[i] <= 0) {
-          if (((int)inner_direction == (int)Right && (i < rank - 1)) ||
-              ((int)inner_direction == (int)Left && (i > 0))) {
-            m_tile[i] = 2;
-          } else {
-            m_tile[i] = (span == 0 ? 1 : span);
-          }
-        }
-        m_tile_end[i] =
-            static_cast<index_type>((span + m_tile[i] - 1) / m_tile[i]);
-        m_num_tiles *= m_tile_end[i];
-        m_prod_tile_dims *= m_tile[i];
-      }
+      init_host_tile();
     }
 #if defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_HIP)
     else  // Cuda or HIP
@@ -552,6 +551,54 @@ using Kokkos::Rank;
 }  // namespace Kokkos
 // ------------------------------------------------------------------ //
 
+namespace Kokkos {
+namespace Impl {
+
+/** \brief  Tile sizes chosen by 'mdrange_host_tile' are handed to a tuning
+ *          tool, if one is loaded, for the duration of the kernel.
+ */
+template <class FunctorType, class... Properties>
+class PolicyTuning<Kokkos::MDRangePolicy<Properties...>, FunctorType> {
+ public:
+  using policy_type = Kokkos::MDRangePolicy<Properties...>;
+
+  PolicyTuning(const policy_type& policy, const std::string& label)
+      : m_policy(policy), m_context(0) {
+    static_assert(
+        std::is_same<typename policy_type::array_index_type, long>::value,
+        "mdrange_begin_tuning takes extents and tiles of type long");
+    if (policy.m_tune_tile && Kokkos::Tools::Experimental::have_tuning_tool()) {
+      ParallelConstructName<FunctorType, typename policy_type::work_tag> name(
+          label);
+      typename policy_type::point_type span;
+      typename policy_type::tile_type tile = policy.m_tile;
+      for (int i = 0; i < policy_type::rank; ++i) {
+        span[i] = policy.m_upper[i] - policy.m_lower[i];
+      }
+      m_context = mdrange_begin_tuning(name.get(), policy_type::rank,
+                                       span.data(), tile.data());
+      if (m_context) {
+        m_policy = policy_type(policy.space(), policy.m_lower, policy.m_upper,
+                               tile);
+      }
+    }
+  }
+
+  ~PolicyTuning() { mdrange_end_tuning(m_context); }
+
+  PolicyTuning(const PolicyTuning&) = delete;
+  PolicyTuning& operator=(const PolicyTuning&) = delete;
+
+  const policy_type& policy() const { return m_policy; }
+
+ private:
+  policy_type m_policy;
+  size_t m_context;
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
 namespace Kokkos {
 namespace Experimental {
 namespace Impl {
@@ -83,6 +83,7 @@
 #endif
 
 #include <Kokkos_AnonymousSpace.hpp>
+#include <Kokkos_MmapSpace.hpp>
 #include <Kokkos_Pair.hpp>
 #include <Kokkos_MemoryPool.hpp>
 #include <Kokkos_Array.hpp>
@@ -96,6 +97,7 @@
 #include <Kokkos_CopyViews.hpp>
 #include <functional>
 #include <iosfwd>
+#include <string>
 
 //----------------------------------------------------------------------------
 
@@ -108,6 +110,13 @@ struct InitArguments {
   int ndevices;
   int skip_device;
   bool disable_warnings;
+  std::string wait_policy;
+  bool first_touch;
+  std::string bind_policy;
+  bool huge_pages;
+  size_t huge_page_threshold;
+  size_t host_cache_size;
+  bool memory_usage;
 
   InitArguments(int nt = -1, int nn = -1, int dv = -1, bool dw = false)
       : num_threads{nt},
@@ -115,7 +124,14 @@ struct InitArguments {
         device_id{dv},
         ndevices{-1},
         skip_device{9999},
-        disable_warnings{dw} {}
+        disable_warnings{dw},
+        wait_policy{},
+        first_touch{false},
+        bind_policy{},
+        huge_pages{false},
+        huge_page_threshold{0},
+        host_cache_size{0},
+        memory_usage{false} {}
 };
 
 void initialize(int& narg, char* arg[]);
@@ -169,6 +185,56 @@ void print_configuration(std::ostream&, const bool detail = false);
 
 }  // namespace Kokkos
 
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Memory usage of the Views, and other allocations made with a
+ *          destroy functor, in a memory space.
+ *
+ *  The counters are maintained with atomic operations when allocations
+ *  are made and released, without a tool library.  Every memory space
+ *  counts all of its allocations and, separately, the allocations whose
+ *  label begins with a prefix registered with 'track_memory_usage'.
+ *  A MemoryPool counts its initial allocation and each slab it grows by
+ *  under the label "MemoryPool".  Allocations of kokkos_malloc are not
+ *  counted.
+ */
+struct MemoryUsage {
+  size_t live_bytes;        ///< Bytes of the live allocations
+  size_t peak_bytes;        ///< Maximum of live_bytes since the last reset
+  size_t live_count;        ///< Number of live allocations
+  size_t allocation_count;  ///< Allocations made since the last reset
+};
+
+/** \brief  Usage of the memory space named 'space_name' by the allocations
+ *          whose label begins with 'label_prefix', which must be empty or
+ *          tracked.  All zero if the space has not allocated.
+ */
+MemoryUsage memory_usage(const std::string& space_name,
+                         const std::string& label_prefix = std::string());
+
+template <class Space>
+MemoryUsage memory_usage(const std::string& label_prefix = std::string()) {
+  return memory_usage(Space::memory_space::name(), label_prefix);
+}
+
+/** \brief  Count the allocations whose label begins with 'label_prefix'
+ *          from now on.  At most 31 prefixes can be tracked.
+ */
+void track_memory_usage(const std::string& label_prefix);
+
+/** \brief  Begin a new phase: set the peak of every counter to its live
+ *          bytes and its allocation count to zero.  Allocations concurrent
+ *          with the reset may or may not be counted in the new phase.
+ */
+void reset_memory_usage();
+
+/** \brief  Print the usage of every memory space and tracked prefix */
+void print_memory_usage(std::ostream&);
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
 
@@ -255,6 +321,7 @@ class ScopeGuard {
 
 #include <Kokkos_Crs.hpp>
 #include <Kokkos_WorkGraphPolicy.hpp>
+#include <Kokkos_HostGraph.hpp>
 // Including this in Kokkos_Parallel_Reduce.hpp led to a circular dependency
 // because Kokkos::Sum is used in Kokkos_Combined_Reducer.hpp and the default.
 // The real answer is to finally break up Kokkos_Parallel_Reduce.hpp into
@@ -94,6 +94,12 @@ class HBWSpace;  /// Memory space for hbw_malloc from memkind (e.g. for KNL
 }
 #endif
 
+#ifdef KOKKOS_ENABLE_MMAPSPACE
+namespace Experimental {
+class MmapSpace;  /// Memory space backed by memory mapped files
+}
+#endif
+
 #if defined(KOKKOS_ENABLE_SERIAL)
 class Serial;  ///< Execution space main process on CPU.
 #endif
@@ -858,6 +858,22 @@ struct ParallelConstructName<FunctorType, TagType, false> {
   std::string default_name;
 };
 
+/** \brief  Policy a kernel is launched with, possibly refined by a tuning
+ *          tool for the kernel's label.  Policies without tuning
+ *          parameters are passed through unchanged.
+ */
+template <class ExecPolicy, class FunctorType>
+class PolicyTuning {
+ public:
+  PolicyTuning(const ExecPolicy& policy, const std::string&)
+      : m_policy(policy) {}
+
+  const ExecPolicy& policy() const { return m_policy; }
+
+ private:
+  const ExecPolicy& m_policy;
+};
+
 }  // namespace Impl
 
 }  // namespace Kokkos
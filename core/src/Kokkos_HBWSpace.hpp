@@ -208,7 +208,7 @@ class SharedAllocationRecord<Kokkos::Experimental::HBWSpace, void>
 
  public:
   inline std::string get_label() const {
-    return std::string(RecordBase::head()->m_label);
+    return std::string(RecordBase::head()->label());
   }
 
   KOKKOS_INLINE_FUNCTION static SharedAllocationRecord* allocate(
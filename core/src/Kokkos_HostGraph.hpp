@@ -0,0 +1,422 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_HOSTGRAPH_HPP
+#define KOKKOS_HOSTGRAPH_HPP
+
+#include <Kokkos_Core_fwd.hpp>
+#include <Kokkos_ExecPolicy.hpp>
+#include <Kokkos_Parallel.hpp>
+#include <impl/Kokkos_Error.hpp>
+#include <impl/Kokkos_HostBarrier.hpp>
+#include <impl/Kokkos_Profiling_Interface.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Kokkos {
+namespace Experimental {
+
+template <class ExecutionSpace>
+class HostGraph;
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Impl {
+
+/** \brief  A kernel recorded in a HostGraph */
+class HostGraphNode {
+ public:
+  virtual ~HostGraphNode() = default;
+
+  /** \brief  Label the kernel was recorded with */
+  virtual const std::string& label() const = 0;
+
+  /** \brief  Prepare the kernel for a new submission of the graph */
+  virtual void reset() const = 0;
+
+  /** \brief  Execute the part of the kernel assigned to 'rank'
+   *          out of 'size' threads of execution.
+   */
+  virtual void execute(const int rank, const int size) const = 0;
+
+  /** \brief  Launch the kernel as an independent parallel_for */
+  virtual void launch() const = 0;
+};
+
+template <class Policy, class FunctorType>
+class HostGraphParallelFor final : public HostGraphNode {
+ private:
+  using WorkTag = typename Policy::work_tag;
+  using Member  = typename Policy::member_type;
+
+  enum : bool {
+    is_dynamic = std::is_same<typename Policy::schedule_type::type,
+                              Kokkos::Dynamic>::value
+  };
+
+  std::string m_label;
+  Policy m_policy;
+  FunctorType m_functor;
+  mutable int64_t m_next_chunk;  // next chunk claimed by a dynamic schedule
+
+  template <class TagType>
+  typename std::enable_if<std::is_same<TagType, void>::value>::type exec_range(
+      const Member ibeg, const Member iend) const {
+    for (Member iwork = ibeg; iwork < iend; ++iwork) {
+      m_functor(iwork);
+    }
+  }
+
+  template <class TagType>
+  typename std::enable_if<!std::is_same<TagType, void>::value>::type
+  exec_range(const Member ibeg, const Member iend) const {
+    const TagType t{};
+    for (Member iwork = ibeg; iwork < iend; ++iwork) {
+      m_functor(t, iwork);
+    }
+  }
+
+  void exec_chunks(const int64_t cbeg, const int64_t cend, const int64_t chunk,
+                   const int64_t length) const {
+    const int64_t ibeg = cbeg * chunk;
+    const int64_t iend = cend * chunk < length ? cend * chunk : length;
+
+    exec_range<WorkTag>(Member(m_policy.begin() + ibeg),
+                        Member(m_policy.begin() + iend));
+  }
+
+ public:
+  const std::string& label() const override { return m_label; }
+
+  void reset() const override { m_next_chunk = 0; }
+
+  void execute(const int rank, const int size) const override {
+    const int64_t length = int64_t(m_policy.end()) - int64_t(m_policy.begin());
+    const int64_t chunk =
+        0 < m_policy.chunk_size() ? int64_t(m_policy.chunk_size()) : 1;
+    const int64_t num = (length + chunk - 1) / chunk;
+
+    if (is_dynamic) {
+      // Claim one chunk at a time from the counter shared by all threads:
+      for (int64_t c = Kokkos::atomic_fetch_add(&m_next_chunk, int64_t(1));
+           c < num; c = Kokkos::atomic_fetch_add(&m_next_chunk, int64_t(1))) {
+        exec_chunks(c, c + 1, chunk, length);
+      }
+    } else {
+      // Static, contiguous partition of the chunks:
+      const int64_t part = (num + size - 1) / size;
+      const int64_t cbeg = part * rank < num ? part * rank : num;
+      const int64_t cend = cbeg + part < num ? cbeg + part : num;
+
+      if (cbeg < cend) exec_chunks(cbeg, cend, chunk, length);
+    }
+  }
+
+  void launch() const override {
+    Kokkos::parallel_for(m_label, m_policy, m_functor);
+  }
+
+  HostGraphParallelFor(const std::string& arg_label, const Policy& arg_policy,
+                       const FunctorType& arg_functor)
+      : m_label(arg_label),
+        m_policy(arg_policy),
+        m_functor(arg_functor),
+        m_next_chunk(0) {}
+};
+
+/** \brief  Execute a HostGraph on the given execution space instance.
+ *
+ *  The default implementation launches the recorded kernels one after the
+ *  other.  Host execution spaces specialize this class to execute the whole
+ *  graph within a single parallel region.
+ */
+template <class ExecutionSpace>
+class HostGraphExec {
+ private:
+  using Graph = Kokkos::Experimental::HostGraph<ExecutionSpace>;
+
+  const Graph* m_graph;
+
+ public:
+  enum : bool { single_region = false };
+
+  inline void execute() const { m_graph->impl_launch_each(); }
+
+  HostGraphExec(const Graph& arg_graph, const ExecutionSpace&)
+      : m_graph(&arg_graph) {}
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  A sequence of parallel_for kernels and their dependencies
+ *          recorded once and executed many times.
+ *
+ *  The functors and policies are copied when the kernel is added to the
+ *  graph.  Each kernel is assigned to a level one above the highest level of
+ *  its predecessors.  On host execution spaces 'submit' executes the whole
+ *  graph within a single parallel region: kernels of the same level are
+ *  executed back to back and consecutive levels are separated by a
+ *  HostBarrier instead of joining back to the master thread.
+ *
+ *  A graph must not be submitted again before its previous submission has
+ *  been fenced.
+ */
+template <class ExecutionSpace = Kokkos::DefaultExecutionSpace>
+class HostGraph {
+ public:
+  using execution_space = ExecutionSpace;
+  using node_type       = int;
+
+  static_assert(Kokkos::Impl::MemorySpaceAccess<
+                    Kokkos::HostSpace,
+                    typename execution_space::memory_space>::accessible,
+                "Kokkos::HostGraph requires a host execution space");
+
+ private:
+  using node_pointer = std::unique_ptr<Kokkos::Impl::HostGraphNode>;
+
+  execution_space m_space;
+  std::string m_label;
+  std::vector<node_pointer> m_nodes;
+  std::vector<int> m_node_level;
+  std::vector<std::vector<const Kokkos::Impl::HostGraphNode*> > m_levels;
+
+  mutable Kokkos::Impl::HostBarrier::buffer_type
+      m_barrier[Kokkos::Impl::HostBarrier::required_buffer_length];
+
+  // Profiling state of the current submission, only used by rank 0
+  mutable bool m_profile;
+  mutable std::vector<uint64_t> m_kpID;
+
+  void impl_begin_level(const size_t level) const {
+    const auto& nodes = m_levels[level];
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      Kokkos::Profiling::beginParallelFor(
+          nodes[i]->label(),
+          Kokkos::Profiling::Experimental::device_id(m_space), &m_kpID[i]);
+    }
+  }
+
+  void impl_end_level(const size_t level) const {
+    for (size_t i = 0; i < m_levels[level].size(); ++i) {
+      Kokkos::Profiling::endParallelFor(m_kpID[i]);
+    }
+  }
+
+  // Wait for all threads to complete 'level', rank 0 reporting the end of
+  // its kernels and the beginning of those of 'level + 1' in between.
+  void impl_rendezvous(const int rank, const int size, int& step,
+                       const size_t level) const {
+    using Kokkos::Impl::HostBarrier;
+    if (!m_profile) {
+      HostBarrier::arrive(m_barrier, size, step);
+      HostBarrier::wait(m_barrier, size, step);
+      return;
+    }
+    HostBarrier::split_arrive(m_barrier, size, step);
+    if (rank != 0) {
+      HostBarrier::wait(m_barrier, size, step);
+    } else {
+      HostBarrier::split_master_wait(m_barrier, size, step);
+      impl_end_level(level);
+      if (level + 1 < m_levels.size()) impl_begin_level(level + 1);
+      HostBarrier::split_release(m_barrier, size, step);
+    }
+  }
+
+ public:
+  HostGraph(const HostGraph&) = delete;
+  HostGraph& operator=(const HostGraph&) = delete;
+
+  explicit HostGraph(const execution_space& arg_space = execution_space(),
+                     const std::string& arg_label = "Kokkos::HostGraph")
+      : m_space(arg_space),
+        m_label(arg_label),
+        m_nodes(),
+        m_node_level(),
+        m_levels(),
+        m_barrier(),
+        m_profile(false),
+        m_kpID() {}
+
+  const execution_space& space() const { return m_space; }
+
+  /** \brief  Number of recorded kernels */
+  int size() const { return m_nodes.size(); }
+
+  /** \brief  Number of barrier separated levels */
+  int num_levels() const { return m_levels.size(); }
+
+  /** \brief  Record 'parallel_for(label, policy, functor)' which must not
+   *          begin before the given predecessors have completed.
+   */
+  template <class... Traits, class FunctorType>
+  node_type add_parallel_for(
+      const std::string& label, const Kokkos::RangePolicy<Traits...>& policy,
+      const FunctorType& functor,
+      const std::vector<node_type>& predecessors = std::vector<node_type>()) {
+    using Policy = Kokkos::RangePolicy<Traits...>;
+
+    static_assert(
+        std::is_same<typename Policy::execution_space, execution_space>::value,
+        "Kokkos::HostGraph: policy execution space must match the graph");
+
+    int level = 0;
+    for (const node_type p : predecessors) {
+      if (p < 0 || size() <= p) {
+        Kokkos::Impl::throw_runtime_exception(
+            "Kokkos::HostGraph::add_parallel_for ERROR: invalid predecessor");
+      }
+      if (level <= m_node_level[p]) level = m_node_level[p] + 1;
+    }
+
+    m_nodes.emplace_back(
+        new Kokkos::Impl::HostGraphParallelFor<Policy, FunctorType>(
+            label, policy, functor));
+    m_node_level.push_back(level);
+
+    if (int(m_levels.size()) <= level) m_levels.resize(level + 1);
+    m_levels[level].push_back(m_nodes.back().get());
+
+    return size() - 1;
+  }
+
+  template <class FunctorType>
+  node_type add_parallel_for(
+      const std::string& label, const size_t work_count,
+      const FunctorType& functor,
+      const std::vector<node_type>& predecessors = std::vector<node_type>()) {
+    return add_parallel_for(
+        label, Kokkos::RangePolicy<execution_space>(m_space, 0, work_count),
+        functor, predecessors);
+  }
+
+  /** \brief  Execute the recorded kernels
+   *
+   *  Each kernel is reported to the profiling tools as its own parallel_for.
+   *  Within a single parallel region the kernels of a level begin once the
+   *  previous level has completed and end once all threads have completed
+   *  the level.
+   */
+  void submit() const {
+    using Exec = Kokkos::Impl::HostGraphExec<execution_space>;
+
+    Exec closure(*this, m_space);
+    closure.execute();
+  }
+
+  //----------------------------------------
+  // Interface for the HostGraphExec implementations
+
+  /** \brief  Prepare the barrier and the kernels for a new submission */
+  void impl_reset() const {
+    for (int i = 0; i < Kokkos::Impl::HostBarrier::required_buffer_length;
+         ++i) {
+      m_barrier[i] = 0;
+    }
+    for (const node_pointer& node : m_nodes) {
+      node->reset();
+    }
+    m_profile = Kokkos::Profiling::profileLibraryLoaded();
+    if (m_profile) {
+      size_t width = 0;
+      for (const auto& nodes : m_levels) {
+        if (width < nodes.size()) width = nodes.size();
+      }
+      m_kpID.resize(width);
+    }
+  }
+
+  /** \brief  Execute the part of the graph assigned to 'rank' out of 'size'
+   *          threads of execution which all call this function.
+   */
+  void impl_execute(const int rank, const int size) const {
+    int step = 0;
+    if (m_profile && rank == 0 && !m_levels.empty()) impl_begin_level(0);
+    for (size_t level = 0; level < m_levels.size(); ++level) {
+      if (0 < level) impl_rendezvous(rank, size, step, level - 1);
+      for (const Kokkos::Impl::HostGraphNode* node : m_levels[level]) {
+        node->execute(rank, size);
+      }
+    }
+    // Report the end of the last level once all threads have completed it
+    if (m_profile && !m_levels.empty()) {
+      impl_rendezvous(rank, size, step, m_levels.size() - 1);
+    }
+  }
+
+  /** \brief  Launch the recorded kernels one after the other */
+  void impl_launch_each() const {
+    for (const node_pointer& node : m_nodes) {
+      node->launch();
+    }
+  }
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#ifdef KOKKOS_ENABLE_SERIAL
+#include "impl/Kokkos_Serial_HostGraph.hpp"
+#endif
+
+#ifdef KOKKOS_ENABLE_OPENMP
+#include "OpenMP/Kokkos_OpenMP_HostGraph.hpp"
+#endif
+
+#ifdef KOKKOS_ENABLE_THREADS
+#include "Threads/Kokkos_Threads_HostGraph.hpp"
+#endif
+
+#endif /* #define KOKKOS_HOSTGRAPH_HPP */
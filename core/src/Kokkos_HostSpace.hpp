@@ -89,6 +89,90 @@ bool lock_address_host_space(void* ptr);
 /// lock_address.
 void unlock_address_host_space(void* ptr);
 
+/// \brief Whether HostSpace View allocations which are not initialized
+///        have their pages touched in parallel by the View's execution
+///        space, so that the pages are placed in the NUMA region of the
+///        threads which later work on them with a RangePolicy.
+///
+/// Enabled by '--kokkos-first-touch', the KOKKOS_FIRST_TOUCH environment
+/// variable or per allocation with the Kokkos::FirstTouch property.
+bool host_first_touch() noexcept;
+
+void set_host_first_touch(const bool) noexcept;
+
+/// \brief Whether HostSpace allocations of at least the huge page threshold
+///        are aligned and padded to 2 MiB and advised with
+///        madvise(MADV_HUGEPAGE), so that the kernel backs them with
+///        transparent huge pages.  Unlike the MAP_HUGETLB used by
+///        POSIX_MMAP this does not need reserved hugetlbfs pages.
+///
+/// Enabled by '--kokkos-huge-pages' or the KOKKOS_HUGE_PAGES environment
+/// variable, and the threshold in bytes (default 2 MiB) is set by
+/// '--kokkos-huge-page-threshold' or KOKKOS_HUGE_PAGE_THRESHOLD.
+/// Has no effect where madvise(MADV_HUGEPAGE) is not available.
+bool host_huge_pages() noexcept;
+
+void set_host_huge_pages(const bool) noexcept;
+
+size_t host_huge_page_threshold() noexcept;
+
+/// Set the threshold in bytes, zero restores the default.
+void set_host_huge_page_threshold(const size_t) noexcept;
+
+/// \brief Counts of the HostSpace allocations which were advised to use
+///        transparent huge pages since the start of the program.
+struct HostHugePageStatistics {
+  size_t allocation_count;  ///< number of advised allocations
+  size_t allocation_bytes;  ///< requested bytes of advised allocations
+  size_t advise_failures;   ///< advised allocations the kernel rejected
+};
+
+HostHugePageStatistics host_huge_page_statistics() noexcept;
+
+/// \brief Byte capacity of the cache of freed HostSpace allocations.
+///
+/// While enabled, allocations of up to 64 MiB by the default allocation
+/// mechanism are rounded up to one of four size classes per power of two,
+/// and freed blocks are kept until the cached bytes would exceed the
+/// capacity.  Blocks up to 1 MiB first go to one of 64 front caches,
+/// chosen by a hash of the thread id and so shared by the threads which
+/// hash to it; a thread that fails to take the front cache's try-lock, and
+/// larger blocks, use the shared bins per size class.  Allocations are
+/// served from the cache without system calls; the Tools allocate and
+/// deallocate callbacks still fire for every allocation.
+///
+/// Enabled by '--kokkos-host-cache=BYTES' or the KOKKOS_HOST_CACHE
+/// environment variable.  Setting the capacity to zero, which
+/// Kokkos::finalize does, disables the cache and releases the cached
+/// blocks; new allocations are no longer rounded.  The blocks handed out
+/// are recorded until they are freed, so they are freed by their class
+/// size and allocations made while the cache is disabled by their own
+/// size, whenever the cache is enabled or disabled.
+size_t host_cache_capacity() noexcept;
+
+void set_host_cache_capacity(const size_t);
+
+/// Release all cached blocks to the allocation mechanism.
+void host_cache_release();
+
+struct HostCacheStatistics {
+  size_t hit_count;     ///< allocations served from the cache
+  size_t miss_count;    ///< cacheable allocations the cache could not serve
+  size_t cached_bytes;  ///< bytes currently held by the cache
+};
+
+HostCacheStatistics host_cache_statistics() noexcept;
+
+/// \brief Counts of the HostSpace allocations placed by a NUMA policy,
+///        see HostSpace::NumaPolicy, since the start of the program.
+struct HostNumaStatistics {
+  size_t allocation_count;  ///< number of placed allocations
+  size_t allocation_bytes;  ///< requested bytes of placed allocations
+  size_t policy_failures;   ///< placed allocations the kernel rejected
+};
+
+HostNumaStatistics host_numa_statistics() noexcept;
+
 }  // namespace Impl
 
 }  // namespace Kokkos
@@ -154,6 +238,27 @@ class HostSpace {
 
   explicit HostSpace(const AllocationMechanism&);
 
+  /**\brief  Placement of the pages of allocations on the NUMA nodes
+   *         [ 0 , Kokkos::hwloc::get_memory_numa_count() ).
+   *
+   *  DEFAULT    : placed by the operating system, usually on the node of
+   *               the thread which first touches the page
+   *  BIND       : placed on the given node only
+   *  PREFERRED  : placed on the given node while it has free memory
+   *  INTERLEAVE : placed page by page round robin on all nodes, e.g. for
+   *               shared tables read by the threads of every node
+   *
+   *  Placed allocations are mapped with mmap and their policy is set with
+   *  the mbind system call before the pages are touched; they are not
+   *  served by the cache of freed allocations.  Only available on Linux.
+   */
+  enum class NumaPolicy : int { DEFAULT, BIND, PREFERRED, INTERLEAVE };
+
+  explicit HostSpace(const NumaPolicy&, const unsigned numa_node = 0);
+
+  NumaPolicy numa_policy() const { return m_numa_policy; }
+  unsigned numa_node() const { return m_numa_node; }
+
   /**\brief  Allocate untracked memory in the space */
   void* allocate(const size_t arg_alloc_size) const;
   void* allocate(const char* arg_label, const size_t arg_alloc_size,
@@ -165,11 +270,20 @@ class HostSpace {
                   const size_t arg_alloc_size,
                   const size_t arg_logical_size = 0) const;
 
+  /**\brief  Allocate and deallocate with the allocation mechanism only,
+   *         bypassing the cache of freed allocations and the profiling
+   *         hooks */
+  void* impl_allocate_raw(const size_t arg_alloc_size) const;
+  void impl_deallocate_raw(void* const arg_alloc_ptr,
+                           const size_t arg_alloc_size) const;
+
   /**\brief Return Name of the MemorySpace */
   static constexpr const char* name() { return m_name; }
 
  private:
   AllocationMechanism m_alloc_mech;
+  NumaPolicy m_numa_policy;
+  unsigned m_numa_node;
   static constexpr const char* m_name = "Host";
   friend class Kokkos::Impl::SharedAllocationRecord<Kokkos::HostSpace, void>;
 };
@@ -261,7 +375,7 @@ class SharedAllocationRecord<Kokkos::HostSpace, void>
 
  public:
   inline std::string get_label() const {
-    return std::string(RecordBase::head()->m_label);
+    return std::string(RecordBase::head()->label());
   }
 
   KOKKOS_INLINE_FUNCTION static SharedAllocationRecord* allocate(
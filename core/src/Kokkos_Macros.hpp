@@ -608,6 +608,11 @@
 #endif
 #endif
 
+// The file backed memory space needs POSIX mmap.
+#if !defined(KOKKOS_ENABLE_MMAPSPACE) && !defined(_WIN32)
+#define KOKKOS_ENABLE_MMAPSPACE 1
+#endif
+
 //----------------------------------------------------------------------------
 // If compiling with CUDA, we must use relocateable device code
 // to enable the task policy.
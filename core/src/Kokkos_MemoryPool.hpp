@@ -48,11 +48,14 @@
 #include <Kokkos_Core_fwd.hpp>
 #include <Kokkos_Parallel.hpp>
 #include <Kokkos_Atomic.hpp>
+#include <impl/Kokkos_BitOps.hpp>
 #include <impl/Kokkos_ConcurrentBitset.hpp>
 #include <impl/Kokkos_Error.hpp>
 #include <impl/Kokkos_SharedAlloc.hpp>
+#include <impl/Kokkos_Spinwait.hpp>
 
 #include <iostream>
+#include <limits>
 
 namespace Kokkos {
 namespace Impl {
@@ -82,6 +85,34 @@ void _print_memory_pool_state(std::ostream &s, uint32_t const *sb_state_ptr,
                               uint32_t sb_state_size, uint32_t state_shift,
                               uint32_t state_used_mask);
 
+/* Deallocate the slabs a growable memory pool added to its
+ * initial allocation when the pool's state is deallocated.
+ * Slab 'k' holds superblocks [ sb_count << k , sb_count << (k+1) )
+ * limited to the pool's maximum number of superblocks.
+ * The slabs are counted in the memory usage with the pool's tag.
+ */
+template <class MemorySpace>
+struct MemoryPoolSlabDestroy {
+  MemorySpace m_space;
+  uintptr_t const *m_slabs = nullptr;
+  int32_t m_sb_count       = 0;
+  int32_t m_sb_max_count   = 0;
+  uint32_t m_sb_size_lg2   = 0;
+  MemoryUsageTag m_usage   = {-1, 0u};
+
+  void destroy_shared_allocation() {
+    for (int32_t k = 0; (int64_t(m_sb_count) << k) < m_sb_max_count; ++k) {
+      if (m_slabs[k]) {
+        const int64_t sb_begin = int64_t(m_sb_count) << k;
+        const int64_t sb_end   = std::min(2 * sb_begin, int64_t(m_sb_max_count));
+        const size_t size      = size_t(sb_end - sb_begin) << m_sb_size_lg2;
+        m_space.deallocate((void *)m_slabs[k], size);
+        memory_usage_deallocate(m_usage, size);
+      }
+    }
+  }
+};
+
 }  // end namespace Impl
 
 template <typename DeviceType>
@@ -110,6 +141,28 @@ class MemoryPool {
    *  is concurrently updated.
    */
 
+  /*  If requested, magazines follow the superblock hints.
+   *  Each of the 'm_magazine_count' magazines caches up to
+   *  'm_magazine_capacity' deallocated blocks of each block size
+   *  for reuse by the thread holding the magazine:
+   *    [ [ { cached_block_count , { block_index }* } per block size ]
+   *      per magazine ]
+   *  where a block index is the superblock id and block within the
+   *  superblock in units of the minimum block size.  Cached blocks
+   *  remain claimed in their superblock's bitset until flushed.
+   */
+
+  /*  A growable pool has states for up to 'm_sb_max_count' superblocks
+   *  of which the first 'm_sb_count' are in the initial allocation.
+   *  Superblocks beyond those are added in slabs, each slab doubling
+   *  the number of superblocks, and their states start out empty.
+   *  The growth state follows the magazines:
+   *    [ current_sb_count , growth_lock , padding* ,
+   *      { slab_address : uintptr_t }* max_slab_count ]
+   */
+  enum : int32_t { max_slab_count = 32 };
+  enum : int32_t { slab_table_offset = 8 };
+
   /*  Mapping between block_size <-> block_state
    *
    *  block_state = ( m_sb_size_lg2 - block_size_lg2 ) << state_shift
@@ -126,7 +179,8 @@ class MemoryPool {
   };
 
   using Tracker = Kokkos::Impl::SharedAllocationTracker;
-  using Record  = Kokkos::Impl::SharedAllocationRecord<base_memory_space>;
+  using Record  = Kokkos::Impl::SharedAllocationRecord<
+      base_memory_space, Kokkos::Impl::MemoryPoolSlabDestroy<base_memory_space>>;
 
   Tracker m_tracker;
   uint32_t *m_sb_state_array;
@@ -134,10 +188,14 @@ class MemoryPool {
   uint32_t m_sb_size_lg2;
   uint32_t m_max_block_size_lg2;
   uint32_t m_min_block_size_lg2;
-  int32_t m_sb_count;
-  int32_t m_hint_offset;  // Offset to K * #block_size array of hints
-  int32_t m_data_offset;  // Offset to 0th superblock data
-  int32_t m_unused_padding;
+  int32_t m_sb_count;         // Superblocks in the initial allocation
+  int32_t m_sb_max_count;     // Superblocks the pool may grow to
+  int32_t m_hint_offset;      // Offset to K * #block_size array of hints
+  int32_t m_magazine_offset;  // Offset to 0th magazine
+  int32_t m_slab_offset;      // Offset to growth state
+  int32_t m_data_offset;      // Offset to 0th superblock data
+  int32_t m_magazine_count;
+  int32_t m_magazine_capacity;
 
  public:
   using memory_space = typename DeviceType::memory_space;
@@ -155,7 +213,12 @@ class MemoryPool {
 
   KOKKOS_INLINE_FUNCTION
   size_t capacity() const noexcept {
-    return size_t(m_sb_count) << m_sb_size_lg2;
+    return size_t(get_sb_count()) << m_sb_size_lg2;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  size_t max_capacity() const noexcept {
+    return size_t(m_sb_max_count) << m_sb_size_lg2;
   }
 
   KOKKOS_INLINE_FUNCTION
@@ -168,6 +231,9 @@ class MemoryPool {
     return (1LU << m_max_block_size_lg2);
   }
 
+  KOKKOS_INLINE_FUNCTION
+  int32_t magazine_count() const noexcept { return m_magazine_count; }
+
   struct usage_statistics {
     size_t capacity_bytes;        ///<  Capacity in bytes
     size_t superblock_bytes;      ///<  Superblock size in bytes
@@ -179,12 +245,15 @@ class MemoryPool {
     size_t consumed_bytes;        ///<  Bytes allocated
     size_t reserved_blocks;  ///<  Unallocated blocks in assigned superblocks
     size_t reserved_bytes;   ///<  Unallocated bytes in assigned superblocks
+    size_t cached_blocks;    ///<  Consumed blocks cached in magazines
+    size_t cached_bytes;     ///<  Consumed bytes cached in magazines
+    size_t slab_count;       ///<  Slabs of superblocks added by growth
   };
 
   void get_usage_statistics(usage_statistics &stats) const {
     Kokkos::HostSpace host;
 
-    const size_t alloc_size = m_hint_offset * sizeof(uint32_t);
+    const size_t alloc_size = m_data_offset * sizeof(uint32_t);
 
     uint32_t *const sb_state_array =
         accessible ? m_sb_state_array : (uint32_t *)host.allocate(alloc_size);
@@ -197,17 +266,29 @@ class MemoryPool {
     stats.superblock_bytes     = (1LU << m_sb_size_lg2);
     stats.max_block_bytes      = (1LU << m_max_block_size_lg2);
     stats.min_block_bytes      = (1LU << m_min_block_size_lg2);
-    stats.capacity_bytes       = stats.superblock_bytes * m_sb_count;
-    stats.capacity_superblocks = m_sb_count;
+    const int32_t sb_count =
+        m_sb_max_count == m_sb_count
+            ? m_sb_count
+            : int32_t(sb_state_array[m_slab_offset] /* current_sb_count */);
+
+    stats.capacity_bytes       = stats.superblock_bytes * sb_count;
+    stats.capacity_superblocks = sb_count;
     stats.consumed_superblocks = 0;
     stats.consumed_blocks      = 0;
     stats.consumed_bytes       = 0;
     stats.reserved_blocks      = 0;
     stats.reserved_bytes       = 0;
+    stats.cached_blocks        = 0;
+    stats.cached_bytes         = 0;
+    stats.slab_count           = 0;
+
+    while ((int64_t(m_sb_count) << stats.slab_count) < sb_count) {
+      ++stats.slab_count;
+    }
 
     const uint32_t *sb_state_ptr = sb_state_array;
 
-    for (int32_t i = 0; i < m_sb_count; ++i, sb_state_ptr += m_sb_state_size) {
+    for (int32_t i = 0; i < sb_count; ++i, sb_state_ptr += m_sb_state_size) {
       const uint32_t block_count_lg2 = (*sb_state_ptr) >> state_shift;
 
       if (block_count_lg2) {
@@ -224,6 +305,17 @@ class MemoryPool {
       }
     }
 
+    const uint32_t *magazine_ptr = sb_state_array + m_magazine_offset;
+
+    for (int32_t i = 0; i < m_magazine_count; ++i) {
+      for (uint32_t block_size_lg2 = m_min_block_size_lg2;
+           block_size_lg2 <= m_max_block_size_lg2; ++block_size_lg2) {
+        stats.cached_blocks += *magazine_ptr;
+        stats.cached_bytes += size_t(*magazine_ptr) << block_size_lg2;
+        magazine_ptr += 1 + m_magazine_capacity;
+      }
+    }
+
     if (!accessible) {
       host.deallocate(sb_state_array, alloc_size);
     }
@@ -242,8 +334,8 @@ class MemoryPool {
           sb_state_array, m_sb_state_array, alloc_size);
     }
 
-    Impl::_print_memory_pool_state(s, sb_state_array, m_sb_count, m_sb_size_lg2,
-                                   m_sb_state_size, state_shift,
+    Impl::_print_memory_pool_state(s, sb_state_array, get_sb_count(),
+                                   m_sb_size_lg2, m_sb_state_size, state_shift,
                                    state_used_mask);
 
     if (!accessible) {
@@ -266,9 +358,13 @@ class MemoryPool {
         m_max_block_size_lg2(0),
         m_min_block_size_lg2(0),
         m_sb_count(0),
+        m_sb_max_count(0),
         m_hint_offset(0),
+        m_magazine_offset(0),
+        m_slab_offset(0),
         m_data_offset(0),
-        m_unused_padding(0) {}
+        m_magazine_count(0),
+        m_magazine_capacity(0) {}
 
   /**\brief  Allocate a memory pool from 'memspace'.
    *
@@ -283,10 +379,23 @@ class MemoryPool {
    *  Individual allocations will always consume a block of memory that
    *  is also a power-of-two.  These roundings are made to enable
    *  significant runtime performance improvements.
+   *
+   *  If 'magazine_count' is nonzero the pool also has that many
+   *  magazines, each caching up to 'magazine_capacity' deallocated
+   *  blocks per block size; see 'allocate_cached'.
+   *
+   *  If 'max_total_alloc_size' is larger than 'min_total_alloc_size'
+   *  the pool is growable: when an allocation called from the host
+   *  finds no room the pool allocates another slab of superblocks from
+   *  'memspace', doubling its capacity up to 'max_total_alloc_size'.
+   *  Requires that 'memspace' is accessible from the host.
    */
   MemoryPool(const base_memory_space &memspace,
              const size_t min_total_alloc_size, size_t min_block_alloc_size = 0,
-             size_t max_block_alloc_size = 0, size_t min_superblock_size = 0)
+             size_t max_block_alloc_size = 0, size_t min_superblock_size = 0,
+             const size_t magazine_count       = 0,
+             const size_t magazine_capacity    = 16,
+             const size_t max_total_alloc_size = 0)
       : m_tracker(),
         m_sb_state_array(nullptr),
         m_sb_state_size(0),
@@ -294,9 +403,13 @@ class MemoryPool {
         m_max_block_size_lg2(0),
         m_min_block_size_lg2(0),
         m_sb_count(0),
+        m_sb_max_count(0),
         m_hint_offset(0),
+        m_magazine_offset(0),
+        m_slab_offset(0),
         m_data_offset(0),
-        m_unused_padding(0) {
+        m_magazine_count(0),
+        m_magazine_capacity(0) {
     const uint32_t int_align_lg2               = 3; /* align as int[8] */
     const uint32_t int_align_mask              = (1u << int_align_lg2) - 1;
     const uint32_t default_min_block_size      = 1u << 6;  /* 64 bytes */
@@ -370,6 +483,15 @@ class MemoryPool {
       const uint64_t sb_size_mask = (1LU << m_sb_size_lg2) - 1;
 
       m_sb_count = (min_total_alloc_size + sb_size_mask) >> m_sb_size_lg2;
+
+      m_sb_max_count = std::max(
+          int64_t(m_sb_count),
+          int64_t((max_total_alloc_size + sb_size_mask) >> m_sb_size_lg2));
+    }
+
+    if (m_sb_count < m_sb_max_count && !accessible) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::MemoryPool can only grow in host accessible memory");
     }
 
     {
@@ -386,7 +508,7 @@ class MemoryPool {
     // Array of all superblock states
 
     const size_t all_sb_state_size =
-        (m_sb_count * m_sb_state_size + int_align_mask) & ~int_align_mask;
+        (m_sb_max_count * m_sb_state_size + int_align_mask) & ~int_align_mask;
 
     // Number of block sizes
 
@@ -399,8 +521,50 @@ class MemoryPool {
     const int32_t block_size_array_size =
         (number_block_sizes + int_align_mask) & ~int_align_mask;
 
+    // Magazines hold block indices in units of the minimum block size
+
+    if (magazine_count &&
+        ((size_t(m_sb_max_count) << m_sb_size_lg2) >> m_min_block_size_lg2) >
+            size_t(~uint32_t(0))) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::MemoryPool magazines require fewer than 2^32 minimum "
+          "size blocks");
+    }
+
+    // Magazine counts and offsets into the header are 32 bit
+
+    const size_t int32_max = size_t(std::numeric_limits<int32_t>::max());
+
+    if (magazine_count &&
+        (int32_max <= magazine_capacity ||
+         int32_max / (number_block_sizes * (1 + magazine_capacity)) <
+             magazine_count)) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::MemoryPool magazines require fewer than 2^31 cached "
+          "block indices in total");
+    }
+
+    m_magazine_count    = magazine_count;
+    m_magazine_capacity = magazine_count ? magazine_capacity : 0;
+
+    const size_t all_magazine_size =
+        (m_magazine_count * number_block_sizes * (1 + m_magazine_capacity) +
+         int_align_mask) &
+        ~int_align_mask;
+
+    // Growth state, slab addresses are aligned as uintptr_t
+
+    const size_t all_slab_size =
+        m_sb_count < m_sb_max_count
+            ? slab_table_offset + max_slab_count * (sizeof(uintptr_t) /
+                                                    sizeof(uint32_t))
+            : 0;
+
     m_hint_offset = all_sb_state_size;
-    m_data_offset = m_hint_offset + block_size_array_size * HINT_PER_BLOCK_SIZE;
+    m_magazine_offset =
+        m_hint_offset + block_size_array_size * HINT_PER_BLOCK_SIZE;
+    m_slab_offset = m_magazine_offset + all_magazine_size;
+    m_data_offset = m_slab_offset + all_slab_size;
 
     // Allocation:
 
@@ -414,6 +578,15 @@ class MemoryPool {
 
     m_sb_state_array = (uint32_t *)rec->data();
 
+    if (m_sb_count < m_sb_max_count) {
+      rec->m_destroy.m_space        = memspace;
+      rec->m_destroy.m_slabs        = get_slab_table();
+      rec->m_destroy.m_sb_count     = m_sb_count;
+      rec->m_destroy.m_sb_max_count = m_sb_max_count;
+      rec->m_destroy.m_sb_size_lg2  = m_sb_size_lg2;
+      rec->m_destroy.m_usage        = rec->m_usage;
+    }
+
     Kokkos::HostSpace host;
 
     uint32_t *const sb_state_array =
@@ -421,6 +594,10 @@ class MemoryPool {
 
     for (int32_t i = 0; i < m_data_offset; ++i) sb_state_array[i] = 0;
 
+    if (m_sb_count < m_sb_max_count) {
+      sb_state_array[m_slab_offset] = uint32_t(m_sb_count);
+    }
+
     // Initial assignment of empty superblocks to block sizes:
 
     for (int32_t i = 0; i < number_block_sizes; ++i) {
@@ -469,6 +646,167 @@ class MemoryPool {
     return i < m_min_block_size_lg2 ? m_min_block_size_lg2 : i;
   }
 
+  /* Number of superblocks, which only changes if the pool is growable */
+  KOKKOS_FORCEINLINE_FUNCTION
+  int32_t get_sb_count() const noexcept {
+    return m_sb_max_count == m_sb_count
+               ? m_sb_count
+               : int32_t(((volatile uint32_t *)m_sb_state_array)[m_slab_offset]);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  uintptr_t *get_slab_table() const noexcept {
+    return (uintptr_t *)(m_sb_state_array + m_slab_offset + slab_table_offset);
+  }
+
+  /* Memory of superblock 'sb_id' < get_sb_count() */
+  KOKKOS_FORCEINLINE_FUNCTION
+  char *get_sb_data(int32_t sb_id) const noexcept {
+    if (sb_id < m_sb_count) {
+      return ((char *)(m_sb_state_array + m_data_offset)) +
+             (uint64_t(sb_id) << m_sb_size_lg2);
+    }
+
+    // Slab 'k' holds superblocks [ m_sb_count << k , m_sb_count << (k+1) )
+
+    const int k = Kokkos::log2(unsigned(sb_id / m_sb_count));
+
+    return ((char *)((volatile uintptr_t *)get_slab_table())[k]) +
+           (uint64_t(sb_id - (int64_t(m_sb_count) << k)) << m_sb_size_lg2);
+  }
+
+  /* Superblock containing 'p' and the offset of 'p' within it.
+   * Return -1 if 'p' is not within a superblock of this pool.
+   */
+  KOKKOS_INLINE_FUNCTION
+  int32_t get_sb_id(void const *p, ptrdiff_t &sb_offset) const noexcept {
+    const ptrdiff_t sb_mask = ptrdiff_t(1LU << m_sb_size_lg2) - 1;
+
+    ptrdiff_t d = ((char *)p) - ((char *)(m_sb_state_array + m_data_offset));
+
+    if ((0 <= d) && (size_t(d) < (size_t(m_sb_count) << m_sb_size_lg2))) {
+      sb_offset = d & sb_mask;
+      return d >> m_sb_size_lg2;
+    }
+
+    const int32_t sb_count = get_sb_count();
+
+    for (int32_t k = 0; (int64_t(m_sb_count) << k) < sb_count; ++k) {
+      const int64_t sb_begin = int64_t(m_sb_count) << k;
+      const int64_t sb_end =
+          2 * sb_begin < sb_count ? 2 * sb_begin : int64_t(sb_count);
+
+      d = ((char *)p) - ((char *)((volatile uintptr_t *)get_slab_table())[k]);
+
+      if ((0 <= d) &&
+          (size_t(d) < (size_t(sb_end - sb_begin) << m_sb_size_lg2))) {
+        sb_offset = d & sb_mask;
+        return int32_t(sb_begin + (d >> m_sb_size_lg2));
+      }
+    }
+
+    return -1;
+  }
+
+  /* Add the next slab of superblocks if the pool is growable, is below
+   * its maximum size, and still has 'sb_count' superblocks.
+   * Only the host can grow the pool, serialized by the growth lock.
+   * Return true if the pool now has more than 'sb_count' superblocks.
+   */
+  KOKKOS_INLINE_FUNCTION
+  bool grow(int32_t sb_count) const noexcept {
+#if defined(KOKKOS_ACTIVE_EXECUTION_MEMORY_SPACE_HOST)
+    if (m_sb_max_count <= sb_count) return false;
+
+    volatile uint32_t *const growth_state = m_sb_state_array + m_slab_offset;
+
+    // The holder of the growth lock may be in a system allocation,
+    // so yield rather than spin while waiting for it
+    for (uint32_t i = 0;
+         0u != Kokkos::atomic_compare_exchange(growth_state + 1, 0u, 1u);) {
+      Kokkos::Impl::host_thread_yield(++i, Kokkos::Impl::WaitMode::PASSIVE);
+    }
+
+    bool grown = int32_t(growth_state[0]) != sb_count;
+
+    if (!grown) {
+      const int k            = Kokkos::log2(unsigned(sb_count / m_sb_count));
+      const int64_t sb_begin = sb_count;
+      const int64_t sb_end =
+          2 * sb_begin < m_sb_max_count ? 2 * sb_begin : m_sb_max_count;
+
+      const size_t size = size_t(sb_end - sb_begin) << m_sb_size_lg2;
+
+      void *slab = nullptr;
+
+      // Allocate from the memory space instance the pool was created
+      // with, which also deallocates the slab
+      try {
+        Record *const rec = static_cast<Record *>(
+            Record::get_record((void *)m_sb_state_array));
+        slab = rec->m_destroy.m_space.allocate(size);
+        Kokkos::Impl::memory_usage_allocate(rec->m_destroy.m_usage, size);
+      } catch (...) {
+        slab = nullptr;
+      }
+
+      if (slab) {
+        ((volatile uintptr_t *)get_slab_table())[k] = uintptr_t(slab);
+
+        Kokkos::memory_fence();
+
+        growth_state[0] = uint32_t(sb_end);
+
+        grown = true;
+      }
+    }
+
+    Kokkos::memory_fence();
+
+    growth_state[1] = 0u;
+
+    return grown;
+#else
+    (void)sb_count;
+    return false;
+#endif
+  }
+
+  /* Block of memory at 'block_index' in units of the minimum block size */
+  KOKKOS_FORCEINLINE_FUNCTION
+  char *get_block(uint32_t block_index) const noexcept {
+    const uint32_t sb_block_lg2 = m_sb_size_lg2 - m_min_block_size_lg2;
+    const uint32_t sb_block_mask = (1u << sb_block_lg2) - 1;
+
+    return get_sb_data(int32_t(block_index >> sb_block_lg2)) +
+           (uint64_t(block_index & sb_block_mask) << m_min_block_size_lg2);
+  }
+
+  /* The magazine of 'magazine_id' for blocks of size ( 1 << block_size_lg2 ):
+   *   magazine[0] is the number of cached blocks
+   *   magazine[1..magazine[0]] are the cached block indices
+   */
+  KOKKOS_FORCEINLINE_FUNCTION
+  uint32_t *get_magazine(int32_t magazine_id, uint32_t block_size_lg2) const
+      noexcept {
+    const uint32_t number_block_sizes =
+        1 + m_max_block_size_lg2 - m_min_block_size_lg2;
+
+    return m_sb_state_array + m_magazine_offset +
+           (1 + m_magazine_capacity) *
+               (magazine_id * number_block_sizes + block_size_lg2 -
+                m_min_block_size_lg2);
+  }
+
+  struct FlushMagazines {
+    MemoryPool m_pool;
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(int32_t magazine_id) const noexcept {
+      m_pool.flush_magazine(magazine_id);
+    }
+  };
+
  public:
   /* Return 0 for invalid block size */
   KOKKOS_INLINE_FUNCTION
@@ -578,8 +916,7 @@ class MemoryPool {
 
           // Set the allocated block pointer
 
-          p = ((char *)(m_sb_state_array + m_data_offset)) +
-              (uint64_t(sb_id) << m_sb_size_lg2)       // superblock memory
+          p = get_sb_data(sb_id)                       // superblock memory
               + (uint64_t(result.first) << size_lg2);  // block memory
 
 #if 0
@@ -618,7 +955,9 @@ class MemoryPool {
 
       sb_state_array = m_sb_state_array + sb_id_begin * m_sb_state_size;
 
-      for (int32_t i = 0, id = sb_id_begin; i < m_sb_count; ++i) {
+      const int32_t sb_count = get_sb_count();
+
+      for (int32_t i = 0, id = sb_id_begin; i < sb_count; ++i) {
         //  Query state of the candidate superblock.
         //  Note that the state may change at any moment
         //  as concurrent allocations and deallocations occur.
@@ -666,7 +1005,7 @@ class MemoryPool {
 
         // Iterate around the superblock array:
 
-        if (++id < m_sb_count) {
+        if (++id < sb_count) {
           sb_state_array += m_sb_state_size;
         } else {
           id             = 0;
@@ -707,8 +1046,9 @@ class MemoryPool {
           sb_state = sb_state_large;
 
           sb_state_array = m_sb_state_array + (sb_id * m_sb_state_size);
-        } else {
+        } else if (!grow(sb_count)) {
           // Did not find a potentially usable superblock
+          // and could not add superblocks
           --attempt_limit;
         }
       }
@@ -736,19 +1076,17 @@ class MemoryPool {
     if (nullptr == p) return;
 
     // Determine which superblock and block
-    const ptrdiff_t d =
-        ((char *)p) - ((char *)(m_sb_state_array + m_data_offset));
+    ptrdiff_t d = 0;
+
+    const int sb_id = get_sb_id(p, d);
 
     // Verify contained within the memory pool's superblocks:
-    const int ok_contains =
-        (0 <= d) && (size_t(d) < (size_t(m_sb_count) << m_sb_size_lg2));
+    const int ok_contains = 0 <= sb_id;
 
     int ok_block_aligned = 0;
     int ok_dealloc_once  = 0;
 
     if (ok_contains) {
-      const int sb_id = d >> m_sb_size_lg2;
-
       // State array for the superblock.
       volatile uint32_t *const sb_state_array =
           m_sb_state_array + (sb_id * m_sb_state_size);
@@ -797,9 +1135,113 @@ class MemoryPool {
   }
   // end deallocate
   //--------------------------------------------------------------------------
+  /**\brief  Allocate a block of memory that is at least 'alloc_size',
+   *         preferring a block cached in magazine 'magazine_id'.
+   *
+   *  Blocks deallocated with 'deallocate_cached' are kept in the
+   *  magazine and reused without touching the shared superblock
+   *  state, avoiding contention among threads allocating the same
+   *  block size.  A magazine must only be used by one thread at a
+   *  time; e.g., with 'magazine_id' acquired from a UniqueToken.
+   *  Falls back to 'allocate' if the magazine has no block of the
+   *  requested size or 'magazine_id' is not a magazine of this pool.
+   */
+  KOKKOS_INLINE_FUNCTION
+  void *allocate_cached(int32_t magazine_id, size_t alloc_size,
+                        int32_t attempt_limit = 1) const noexcept {
+    if (0 <= magazine_id && magazine_id < m_magazine_count && 0 < alloc_size &&
+        alloc_size <= size_t(1LU << m_max_block_size_lg2)) {
+      uint32_t *const magazine =
+          get_magazine(magazine_id, get_block_size_lg2(alloc_size));
+
+      if (0 < magazine[0]) return get_block(magazine[magazine[0]--]);
+    }
+
+    return allocate(alloc_size, attempt_limit);
+  }
+
+  /**\brief  Return an allocated block of memory to magazine 'magazine_id'
+   *         or, if that magazine is full, to the pool.
+   *
+   *  Requires: p is return value from allocate( alloc_size )
+   *            or allocate_cached( any magazine_id , alloc_size ).
+   */
+  KOKKOS_INLINE_FUNCTION
+  void deallocate_cached(int32_t magazine_id, void *p,
+                         size_t alloc_size) const noexcept {
+    if (nullptr == p) return;
+
+    ptrdiff_t d = 0;
+
+    const int sb_id =
+        0 <= magazine_id && magazine_id < m_magazine_count ? get_sb_id(p, d)
+                                                           : -1;
+
+    if (0 <= sb_id) {
+      const uint32_t block_state =
+          ((volatile uint32_t *)m_sb_state_array)[sb_id * m_sb_state_size] &
+          state_header_mask;
+      const uint32_t block_size_lg2 =
+          m_sb_size_lg2 - (block_state >> state_shift);
+
+      if (block_size_lg2 <= m_max_block_size_lg2 &&
+          0 == (d & ((1UL << block_size_lg2) - 1))) {
+        uint32_t *const magazine = get_magazine(magazine_id, block_size_lg2);
+
+        if (magazine[0] < uint32_t(m_magazine_capacity)) {
+          magazine[++magazine[0]] =
+              (uint32_t(sb_id) << (m_sb_size_lg2 - m_min_block_size_lg2)) +
+              uint32_t(d >> m_min_block_size_lg2);
+          return;
+        }
+      }
+    }
+
+    // Full magazine or not a block of this pool:
+    deallocate(p, alloc_size);
+  }
+
+  /**\brief  Return all blocks cached in magazine 'magazine_id' to the pool.
+   *
+   *  Requires that no other thread is using the magazine.
+   */
+  KOKKOS_INLINE_FUNCTION
+  void flush_magazine(int32_t magazine_id) const noexcept {
+    if (magazine_id < 0 || m_magazine_count <= magazine_id) return;
+
+    for (uint32_t block_size_lg2 = m_min_block_size_lg2;
+         block_size_lg2 <= m_max_block_size_lg2; ++block_size_lg2) {
+      uint32_t *const magazine = get_magazine(magazine_id, block_size_lg2);
+
+      for (; 0 < magazine[0]; --magazine[0]) {
+        deallocate(get_block(magazine[magazine[0]]), 1LU << block_size_lg2);
+      }
+    }
+  }
+
+  /**\brief  Return all blocks cached in all magazines to the pool, so that
+   *         'get_usage_statistics' reports only blocks in use.
+   *
+   *  Requires that no thread is using the pool.
+   */
+  void flush_magazines() const {
+    if (0 == m_magazine_count) return;
+
+    if (accessible) {
+      for (int32_t i = 0; i < m_magazine_count; ++i) flush_magazine(i);
+    } else {
+      using execution_space = typename DeviceType::execution_space;
+
+      Kokkos::parallel_for(
+          "Kokkos::MemoryPool::flush_magazines",
+          Kokkos::RangePolicy<execution_space>(0, m_magazine_count),
+          FlushMagazines{*this});
+      execution_space().fence();
+    }
+  }
 
   KOKKOS_INLINE_FUNCTION
-  int number_of_superblocks() const noexcept { return m_sb_count; }
+  int number_of_superblocks() const noexcept { return get_sb_count(); }
 
   KOKKOS_INLINE_FUNCTION
   void superblock_state(int sb_id, int &block_size, int &block_count_capacity,
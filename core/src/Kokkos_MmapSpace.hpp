@@ -0,0 +1,332 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_MMAPSPACE_HPP
+#define KOKKOS_MMAPSPACE_HPP
+
+#include <Kokkos_Macros.hpp>
+#ifdef KOKKOS_ENABLE_MMAPSPACE
+
+#include <string>
+
+#include <Kokkos_HostSpace.hpp>
+
+/*--------------------------------------------------------------------------*/
+
+namespace Kokkos {
+
+namespace Experimental {
+
+/// \class MmapSpace
+/// \brief Memory space whose allocations are memory mapped files.
+///
+/// Every allocation of an MmapSpace instance constructed with a file path
+/// maps the bytes of that file starting at the instance's offset, so a View
+/// allocated in the space views the file contents without copying them and
+/// may be larger than the physical memory.  The tracking header of a View
+/// is kept on an anonymous page in front of the mapping, so that the data
+/// of the View begins exactly at the offset in the file.
+///
+/// View allocations which map existing file contents must be constructed
+/// 'WithoutInitializing', otherwise the View fills them with zeros.
+///
+///   ReadOnly    : the file is mapped read only, writing to the View faults.
+///   ReadWrite   : writes are shared with the file, which is extended if it
+///                 is shorter than the allocation.  Kokkos::fence() and the
+///                 deallocation msync the written pages to the file.
+///   CopyOnWrite : the View may be written but the file is not modified.
+///
+/// The advice is passed to madvise for the mapped range.  The default
+/// constructed instance maps anonymous memory.
+class MmapSpace {
+ public:
+  //! Tag this class as a kokkos memory space
+  using memory_space = MmapSpace;
+  using size_type    = size_t;
+
+  //! Default execution space for this memory space
+  using execution_space = Kokkos::HostSpace::execution_space;
+
+  //! This memory space preferred device_type
+  using device_type = Kokkos::Device<execution_space, memory_space>;
+
+  enum class Mode : int { ReadOnly, ReadWrite, CopyOnWrite };
+
+  enum class Advice : int { Normal, Sequential, Random, WillNeed };
+
+  /**\brief  Memory space instance for anonymous memory */
+  MmapSpace();
+
+  /**\brief  Memory space instance for the file at 'path', the offset
+   *         must be a multiple of the page size */
+  explicit MmapSpace(const std::string& path, const Mode mode = Mode::ReadOnly,
+                     const Advice advice = Advice::Normal,
+                     const size_t offset = 0);
+
+  MmapSpace(MmapSpace&& rhs)      = default;
+  MmapSpace(const MmapSpace& rhs) = default;
+  MmapSpace& operator=(MmapSpace&&) = default;
+  MmapSpace& operator=(const MmapSpace&) = default;
+  ~MmapSpace()                           = default;
+
+  /**\brief  Allocate untracked memory in the space */
+  void* allocate(const size_t arg_alloc_size) const;
+  void* allocate(const char* arg_label, const size_t arg_alloc_size,
+                 const size_t arg_logical_size = 0) const;
+
+  /**\brief  Deallocate untracked memory in the space */
+  void deallocate(void* const arg_alloc_ptr, const size_t arg_alloc_size) const;
+  void deallocate(const char* arg_label, void* const arg_alloc_ptr,
+                  const size_t arg_alloc_size,
+                  const size_t arg_logical_size = 0) const;
+
+  /**\brief  Map 'arg_alloc_size' bytes of the file preceded by
+   *         'arg_header_size' bytes of anonymous memory, and return the
+   *         pointer to the anonymous bytes */
+  void* impl_allocate_mapped(const char* arg_label,
+                             const size_t arg_header_size,
+                             const size_t arg_alloc_size) const;
+  void impl_deallocate_mapped(const char* arg_label, void* const arg_alloc_ptr,
+                              const size_t arg_header_size,
+                              const size_t arg_alloc_size) const;
+
+  /**\brief  Write back the pages of all ReadWrite mappings to their files,
+   *         called by Kokkos::fence */
+  static void impl_sync_all();
+
+  const std::string& path() const { return m_path; }
+  Mode mode() const { return m_mode; }
+  Advice advice() const { return m_advice; }
+  size_t offset() const { return m_offset; }
+
+  /**\brief Return Name of the MemorySpace */
+  static constexpr const char* name() { return "Mmap"; }
+
+ private:
+  std::string m_path;
+  Mode m_mode;
+  Advice m_advice;
+  size_t m_offset;
+  friend class Kokkos::Impl::SharedAllocationRecord<
+      Kokkos::Experimental::MmapSpace, void>;
+};
+
+}  // namespace Experimental
+
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+
+namespace Impl {
+
+template <>
+class SharedAllocationRecord<Kokkos::Experimental::MmapSpace, void>
+    : public SharedAllocationRecord<void, void> {
+ private:
+  friend Kokkos::Experimental::MmapSpace;
+
+  using RecordBase = SharedAllocationRecord<void, void>;
+
+  SharedAllocationRecord(const SharedAllocationRecord&) = delete;
+  SharedAllocationRecord& operator=(const SharedAllocationRecord&) = delete;
+
+  static void deallocate(RecordBase*);
+
+#ifdef KOKKOS_DEBUG
+  /**\brief  Root record for tracked allocations from this MmapSpace instance */
+  static RecordBase s_root_record;
+#endif
+
+  const Kokkos::Experimental::MmapSpace m_space;
+
+ protected:
+  ~SharedAllocationRecord()
+#if defined( \
+    KOKKOS_IMPL_INTEL_WORKAROUND_NOEXCEPT_SPECIFICATION_VIRTUAL_FUNCTION)
+      noexcept
+#endif
+      ;
+  SharedAllocationRecord() = default;
+
+  SharedAllocationRecord(
+      const Kokkos::Experimental::MmapSpace& arg_space,
+      const std::string& arg_label, const size_t arg_alloc_size,
+      const RecordBase::function_type arg_dealloc = &deallocate);
+
+ public:
+  inline std::string get_label() const {
+    return std::string(RecordBase::head()->label());
+  }
+
+  KOKKOS_INLINE_FUNCTION static SharedAllocationRecord* allocate(
+      const Kokkos::Experimental::MmapSpace& arg_space,
+      const std::string& arg_label, const size_t arg_alloc_size) {
+#if defined(KOKKOS_ACTIVE_EXECUTION_MEMORY_SPACE_HOST)
+    return new SharedAllocationRecord(arg_space, arg_label, arg_alloc_size);
+#else
+    return (SharedAllocationRecord*)0;
+#endif
+  }
+
+  /**\brief  Allocate tracked memory in the space */
+  static void* allocate_tracked(
+      const Kokkos::Experimental::MmapSpace& arg_space,
+      const std::string& arg_label, const size_t arg_alloc_size);
+
+  /**\brief  Reallocate tracked memory in the space */
+  static void* reallocate_tracked(void* const arg_alloc_ptr,
+                                  const size_t arg_alloc_size);
+
+  /**\brief  Deallocate tracked memory in the space */
+  static void deallocate_tracked(void* const arg_alloc_ptr);
+
+  static SharedAllocationRecord* get_record(void* arg_alloc_ptr);
+
+  static void print_records(std::ostream&,
+                            const Kokkos::Experimental::MmapSpace&,
+                            bool detail = false);
+};
+
+}  // namespace Impl
+
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+
+namespace Impl {
+
+static_assert(Kokkos::Impl::MemorySpaceAccess<
+                  Kokkos::Experimental::MmapSpace,
+                  Kokkos::Experimental::MmapSpace>::assignable,
+              "");
+
+template <>
+struct MemorySpaceAccess<Kokkos::HostSpace, Kokkos::Experimental::MmapSpace> {
+  enum { assignable = true };
+  enum { accessible = true };
+  enum { deepcopy = true };
+};
+
+template <>
+struct MemorySpaceAccess<Kokkos::Experimental::MmapSpace, Kokkos::HostSpace> {
+  enum { assignable = false };
+  enum { accessible = true };
+  enum { deepcopy = true };
+};
+
+}  // namespace Impl
+
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+
+namespace Impl {
+
+template <class ExecutionSpace>
+struct DeepCopy<Kokkos::Experimental::MmapSpace,
+                Kokkos::Experimental::MmapSpace, ExecutionSpace> {
+  DeepCopy(void* dst, const void* src, size_t n) { memcpy(dst, src, n); }
+
+  DeepCopy(const ExecutionSpace& exec, void* dst, const void* src, size_t n) {
+    exec.fence();
+    memcpy(dst, src, n);
+  }
+};
+
+template <class ExecutionSpace>
+struct DeepCopy<HostSpace, Kokkos::Experimental::MmapSpace, ExecutionSpace> {
+  DeepCopy(void* dst, const void* src, size_t n) { memcpy(dst, src, n); }
+
+  DeepCopy(const ExecutionSpace& exec, void* dst, const void* src, size_t n) {
+    exec.fence();
+    memcpy(dst, src, n);
+  }
+};
+
+template <class ExecutionSpace>
+struct DeepCopy<Kokkos::Experimental::MmapSpace, HostSpace, ExecutionSpace> {
+  DeepCopy(void* dst, const void* src, size_t n) { memcpy(dst, src, n); }
+
+  DeepCopy(const ExecutionSpace& exec, void* dst, const void* src, size_t n) {
+    exec.fence();
+    memcpy(dst, src, n);
+  }
+};
+
+}  // namespace Impl
+
+}  // namespace Kokkos
+
+namespace Kokkos {
+
+namespace Impl {
+
+template <>
+struct VerifyExecutionCanAccessMemorySpace<Kokkos::HostSpace,
+                                           Kokkos::Experimental::MmapSpace> {
+  enum { value = true };
+  inline static void verify(void) {}
+  inline static void verify(const void*) {}
+};
+
+template <>
+struct VerifyExecutionCanAccessMemorySpace<Kokkos::Experimental::MmapSpace,
+                                           Kokkos::HostSpace> {
+  enum { value = true };
+  inline static void verify(void) {}
+  inline static void verify(const void*) {}
+};
+
+}  // namespace Impl
+
+}  // namespace Kokkos
+
+#endif
+#endif  // #define KOKKOS_MMAPSPACE_HPP
@@ -65,6 +65,7 @@
 #include <impl/Kokkos_Tags.hpp>
 #include <impl/Kokkos_Profiling_Interface.hpp>
 
+#include <memory>
 #include <vector>
 
 /*--------------------------------------------------------------------------*/
@@ -73,7 +74,8 @@ namespace Kokkos {
 
 namespace Impl {
 class OpenMPExec;
-}
+class OpenMPAsyncInstance;
+}  // namespace Impl
 
 /// \class OpenMP
 /// \brief Kokkos device for multicore processors in the host memory space.
@@ -103,28 +105,38 @@ class OpenMP {
 
   /// \brief Wait until all dispatched functors complete on the given instance
   ///
-  ///  This is a no-op on OpenMP
+  ///  Waits for every asynchronous instance created by 'partition'
   static void impl_static_fence(OpenMP const& = OpenMP()) noexcept;
 
+  /// \brief Wait until all functors dispatched to this instance complete
   void fence() const;
 
   /// \brief Does the given instance return immediately after launching
   /// a parallel algorithm
   ///
-  /// This always returns false on OpenMP
+  /// This returns true for the instances created by 'partition'
   inline static bool is_asynchronous(OpenMP const& = OpenMP()) noexcept;
 
-  /// \brief Partition the default instance into new instances without creating
-  ///  new masters
+  /// \brief Partition the default instance into asynchronous instances
   ///
-  /// This is a no-op on OpenMP since the default instance cannot be partitioned
-  /// without promoting other threads to 'master'
-  static std::vector<OpenMP> partition(...);
+  /// Each instance owns a contiguous slice of 'partition_size' ranks of the
+  /// default thread pool which no other live instance owns, and a dedicated
+  /// master thread which executes the functors dispatched to the instance in
+  /// order, each within an OpenMP parallel region of the slice's size.  The
+  /// threads of the region are bound like the default pool's threads of the
+  /// same ranks.  Functors dispatched to different instances run
+  /// concurrently.  The partition is shrunk to fit the ranks not owned by
+  /// other instances, and throws if they are too few or fragmented.  The
+  /// default instance must not dispatch work while any of its partitions are
+  /// executing, since they share the hardware threads.  The resources and
+  /// ranks of an instance are released when its last copy is destroyed.
+  static std::vector<OpenMP> partition(int requested_num_partitions = 0,
+                                       int requested_partition_size = 0);
 
   /// Non-default instances should be ref-counted so that when the last
   /// is destroyed the instance resources are released
   ///
-  /// This is a no-op on OpenMP since a non default instance cannot be created
+  /// This is a no-op on OpenMP, use 'partition' to create instances
   static OpenMP create_instance(...);
 
   /// \brief Partition the default instance and call 'f' on each new 'master'
@@ -166,7 +178,19 @@ class OpenMP {
   static int impl_get_current_max_threads() noexcept;
 
   static constexpr const char* name() noexcept { return "OpenMP"; }
-  uint32_t impl_instance_id() const noexcept { return 0; }
+  uint32_t impl_instance_id() const noexcept;
+
+  /// \brief The thread pool executing the functors dispatched to this
+  /// instance
+  inline Impl::OpenMPExec* impl_internal_space_instance() const noexcept;
+
+  /// \brief Number of threads executing the functors dispatched to this
+  /// instance
+  inline int impl_instance_pool_size() const noexcept;
+
+ private:
+  // Null for the default instance
+  std::shared_ptr<Impl::OpenMPAsyncInstance> m_async_instance;
 };
 
 namespace Tools {
@@ -169,11 +169,17 @@ inline void parallel_for(
         &kpID);
   }
 
-  Kokkos::Impl::shared_allocation_tracking_disable();
-  Impl::ParallelFor<FunctorType, ExecPolicy> closure(functor, policy);
-  Kokkos::Impl::shared_allocation_tracking_enable();
+  {
+    // The tuning context nests inside the one of the kernel
+    Impl::PolicyTuning<ExecPolicy, FunctorType> tuning(policy, str);
 
-  closure.execute();
+    Kokkos::Impl::shared_allocation_tracking_disable();
+    Impl::ParallelFor<FunctorType, ExecPolicy> closure(functor,
+                                                       tuning.policy());
+    Kokkos::Impl::shared_allocation_tracking_enable();
+
+    closure.execute();
+  }
 
   if (Kokkos::Profiling::profileLibraryLoaded()) {
     Kokkos::Profiling::endParallelFor(kpID);
@@ -395,6 +401,18 @@ namespace Kokkos {
 /// };
 /// \endcode
 ///
+/// On the Serial, OpenMP and Threads backends the policy may also be an
+/// MDRangePolicy.  The scan functor then takes one index per rank before
+/// the \c update and \c final_pass arguments:
+/// \code
+///   void operator () (const int i, const int j, value_type& update,
+///   const bool final_pass) const;
+/// \endcode
+/// Points are scanned in the iteration order of the policy: tiles in the
+/// outer iteration order, and the points of each tile in the inner
+/// iteration order.  With tiles spanning the whole extent of every
+/// dimension but the slowest one, this is the order of the outer layout.
+///
 template <class ExecutionPolicy, class FunctorType>
 inline void parallel_scan(
     const ExecutionPolicy& policy, const FunctorType& functor,
@@ -412,11 +430,17 @@ inline void parallel_scan(
         &kpID);
   }
 
-  Kokkos::Impl::shared_allocation_tracking_disable();
-  Impl::ParallelScan<FunctorType, ExecutionPolicy> closure(functor, policy);
-  Kokkos::Impl::shared_allocation_tracking_enable();
+  {
+    // The tuning context nests inside the one of the kernel
+    Impl::PolicyTuning<ExecutionPolicy, FunctorType> tuning(policy, str);
 
-  closure.execute();
+    Kokkos::Impl::shared_allocation_tracking_disable();
+    Impl::ParallelScan<FunctorType, ExecutionPolicy> closure(functor,
+                                                             tuning.policy());
+    Kokkos::Impl::shared_allocation_tracking_enable();
+
+    closure.execute();
+  }
 
   if (Kokkos::Profiling::profileLibraryLoaded()) {
     Kokkos::Profiling::endParallelScan(kpID);
@@ -486,12 +510,17 @@ inline void parallel_scan(
         &kpID);
   }
 
-  Kokkos::Impl::shared_allocation_tracking_disable();
-  Impl::ParallelScanWithTotal<FunctorType, ExecutionPolicy, ReturnType> closure(
-      functor, policy, return_value);
-  Kokkos::Impl::shared_allocation_tracking_enable();
+  {
+    // The tuning context nests inside the one of the kernel
+    Impl::PolicyTuning<ExecutionPolicy, FunctorType> tuning(policy, str);
 
-  closure.execute();
+    Kokkos::Impl::shared_allocation_tracking_disable();
+    Impl::ParallelScanWithTotal<FunctorType, ExecutionPolicy, ReturnType>
+        closure(functor, tuning.policy(), return_value);
+    Kokkos::Impl::shared_allocation_tracking_enable();
+
+    closure.execute();
+  }
 
   if (Kokkos::Profiling::profileLibraryLoaded()) {
     Kokkos::Profiling::endParallelScan(kpID);
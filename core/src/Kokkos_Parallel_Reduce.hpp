@@ -862,20 +862,25 @@ struct ParallelReduceAdaptor {
       Kokkos::Profiling::beginParallelReduce(name.get(), 0, &kpID);
     }
 
-    Kokkos::Impl::shared_allocation_tracking_disable();
+    {
+      // The tuning context nests inside the one of the kernel
+      PolicyTuning<PolicyType, FunctorType> tuning(policy, label);
+
+      Kokkos::Impl::shared_allocation_tracking_disable();
 #ifdef KOKKOS_IMPL_NEED_FUNCTOR_WRAPPER
-    Impl::ParallelReduce<typename functor_adaptor::functor_type, PolicyType,
-                         typename return_value_adapter::reducer_type>
-        closure(functor_adaptor::functor(functor), policy,
-                return_value_adapter::return_value(return_value, functor));
+      Impl::ParallelReduce<typename functor_adaptor::functor_type, PolicyType,
+                           typename return_value_adapter::reducer_type>
+          closure(functor_adaptor::functor(functor), tuning.policy(),
+                  return_value_adapter::return_value(return_value, functor));
 #else
-    Impl::ParallelReduce<FunctorType, PolicyType,
-                         typename return_value_adapter::reducer_type>
-        closure(functor, policy,
-                return_value_adapter::return_value(return_value, functor));
+      Impl::ParallelReduce<FunctorType, PolicyType,
+                           typename return_value_adapter::reducer_type>
+          closure(functor, tuning.policy(),
+                  return_value_adapter::return_value(return_value, functor));
 #endif
-    Kokkos::Impl::shared_allocation_tracking_enable();
-    closure.execute();
+      Kokkos::Impl::shared_allocation_tracking_enable();
+      closure.execute();
+    }
 
     if (Kokkos::Profiling::profileLibraryLoaded()) {
       Kokkos::Profiling::endParallelReduce(kpID);
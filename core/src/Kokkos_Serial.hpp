@@ -801,6 +801,127 @@ class ParallelReduce<FunctorType, Kokkos::MDRangePolicy<Traits...>, ReducerType,
   }
 };
 
+/*--------------------------------------------------------------------------*/
+
+template <class FunctorType, class... Traits>
+class ParallelScan<FunctorType, Kokkos::MDRangePolicy<Traits...>,
+                   Kokkos::Serial> {
+ private:
+  using MDRangePolicy = Kokkos::MDRangePolicy<Traits...>;
+  using Policy        = typename MDRangePolicy::impl_range_policy;
+  using WorkTag       = typename MDRangePolicy::work_tag;
+
+  using Analysis = FunctorAnalysis<FunctorPatternInterface::SCAN,
+                                   MDRangePolicy, FunctorType>;
+
+  using ValueInit = Kokkos::Impl::FunctorValueInit<FunctorType, WorkTag>;
+
+  using pointer_type   = typename Analysis::pointer_type;
+  using reference_type = typename Analysis::reference_type;
+
+  using iterate_type =
+      typename Kokkos::Impl::HostIterateTileScan<MDRangePolicy, FunctorType,
+                                                 WorkTag, reference_type>;
+
+  const FunctorType m_functor;
+  const MDRangePolicy m_mdr_policy;
+  const Policy m_policy;
+
+  inline void exec(reference_type update) const {
+    const typename Policy::member_type e = m_policy.end();
+    for (typename Policy::member_type i = m_policy.begin(); i < e; ++i) {
+      iterate_type(m_mdr_policy, m_functor, update, true)(i);
+    }
+  }
+
+ public:
+  inline void execute() const {
+    const size_t pool_reduce_size  = Analysis::value_size(m_functor);
+    const size_t team_reduce_size  = 0;  // Never shrinks
+    const size_t team_shared_size  = 0;  // Never shrinks
+    const size_t thread_local_size = 0;  // Never shrinks
+
+    serial_resize_thread_team_data(pool_reduce_size, team_reduce_size,
+                                   team_shared_size, thread_local_size);
+
+    HostThreadTeamData& data = *serial_get_thread_team_data();
+
+    reference_type update =
+        ValueInit::init(m_functor, pointer_type(data.pool_reduce_local()));
+
+    this->exec(update);
+  }
+
+  inline ParallelScan(const FunctorType& arg_functor,
+                      const MDRangePolicy& arg_policy)
+      : m_functor(arg_functor),
+        m_mdr_policy(arg_policy),
+        m_policy(Policy(0, m_mdr_policy.m_num_tiles).set_chunk_size(1)) {}
+};
+
+/*--------------------------------------------------------------------------*/
+
+template <class FunctorType, class ReturnType, class... Traits>
+class ParallelScanWithTotal<FunctorType, Kokkos::MDRangePolicy<Traits...>,
+                            ReturnType, Kokkos::Serial> {
+ private:
+  using MDRangePolicy = Kokkos::MDRangePolicy<Traits...>;
+  using Policy        = typename MDRangePolicy::impl_range_policy;
+  using WorkTag       = typename MDRangePolicy::work_tag;
+
+  using Analysis = FunctorAnalysis<FunctorPatternInterface::SCAN,
+                                   MDRangePolicy, FunctorType>;
+
+  using ValueInit = Kokkos::Impl::FunctorValueInit<FunctorType, WorkTag>;
+
+  using pointer_type   = typename Analysis::pointer_type;
+  using reference_type = typename Analysis::reference_type;
+
+  using iterate_type =
+      typename Kokkos::Impl::HostIterateTileScan<MDRangePolicy, FunctorType,
+                                                 WorkTag, reference_type>;
+
+  const FunctorType m_functor;
+  const MDRangePolicy m_mdr_policy;
+  const Policy m_policy;
+  ReturnType& m_returnvalue;
+
+  inline void exec(reference_type update) const {
+    const typename Policy::member_type e = m_policy.end();
+    for (typename Policy::member_type i = m_policy.begin(); i < e; ++i) {
+      iterate_type(m_mdr_policy, m_functor, update, true)(i);
+    }
+  }
+
+ public:
+  inline void execute() {
+    const size_t pool_reduce_size  = Analysis::value_size(m_functor);
+    const size_t team_reduce_size  = 0;  // Never shrinks
+    const size_t team_shared_size  = 0;  // Never shrinks
+    const size_t thread_local_size = 0;  // Never shrinks
+
+    serial_resize_thread_team_data(pool_reduce_size, team_reduce_size,
+                                   team_shared_size, thread_local_size);
+
+    HostThreadTeamData& data = *serial_get_thread_team_data();
+
+    reference_type update =
+        ValueInit::init(m_functor, pointer_type(data.pool_reduce_local()));
+
+    this->exec(update);
+
+    m_returnvalue = update;
+  }
+
+  inline ParallelScanWithTotal(const FunctorType& arg_functor,
+                               const MDRangePolicy& arg_policy,
+                               ReturnType& arg_returnvalue)
+      : m_functor(arg_functor),
+        m_mdr_policy(arg_policy),
+        m_policy(Policy(0, m_mdr_policy.m_num_tiles).set_chunk_size(1)),
+        m_returnvalue(arg_returnvalue) {}
+};
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -201,6 +201,24 @@ class BasicTaskScheduler : public Impl::TaskSchedulerBase {
     return f;
   }
 
+  template <int TaskEnum, typename GeneratorType>
+  struct _spawn_batch_operation {
+    BasicTaskScheduler* m_scheduler;
+    TaskPriority m_priority;
+    typename task_base::function_type m_function;
+    typename task_base::destroy_type m_destroy;
+    GeneratorType const& m_generator;
+
+    KOKKOS_INLINE_FUNCTION
+    future_type_for_functor<typename std::decay<
+        decltype(std::declval<GeneratorType const&>()(0))>::type>
+    operator()(int i) const {
+      return m_scheduler->template _spawn_impl<TaskEnum>(
+          (task_base*)nullptr, m_priority, m_function, m_destroy,
+          m_generator(i));
+    }
+  };
+
  public:
   KOKKOS_INLINE_FUNCTION
   BasicTaskScheduler() : m_track(), m_queue(nullptr) {}
@@ -301,6 +319,20 @@ class BasicTaskScheduler : public Impl::TaskSchedulerBase {
             std::forward<FunctorType>(arg_functor));
   }
 
+  // This queue has no batched insertion, so a batch is spawned one task at a
+  // time into a when_all
+  template <int TaskEnum, typename GeneratorType>
+  KOKKOS_FUNCTION static BasicFuture<void, scheduler_type> spawn_batch(
+      Impl::TaskPolicyWithScheduler<TaskEnum, scheduler_type>&& arg_policy,
+      typename task_base::function_type arg_function,
+      typename task_base::destroy_type arg_destroy, int arg_count,
+      GeneratorType const& arg_generator) {
+    return arg_policy.scheduler().when_all(
+        arg_count, _spawn_batch_operation<TaskEnum, GeneratorType>{
+                       &arg_policy.scheduler(), arg_policy.priority(),
+                       arg_function, arg_destroy, arg_generator});
+  }
+
   template <int TaskEnum, typename DepFutureType, typename FunctorType>
   KOKKOS_FUNCTION
       future_type_for_functor<typename std::decay<FunctorType>::type>
@@ -400,6 +432,7 @@ class BasicTaskScheduler : public Impl::TaskSchedulerBase {
           f.m_task->m_alloc_size = static_cast<int32_t>(alloc_size);
           f.m_task->m_dep_count  = narg;
           f.m_task->m_task_type  = task_base::Aggregate;
+          f.m_task->m_priority   = int16_t(TaskPriority::Low);
 
           // Assign dependences, reference counts were already incremented
 
@@ -450,6 +483,7 @@ class BasicTaskScheduler : public Impl::TaskSchedulerBase {
       f.m_task->m_alloc_size = static_cast<int32_t>(alloc_size);
       f.m_task->m_dep_count  = narg;
       f.m_task->m_task_type  = task_base::Aggregate;
+      f.m_task->m_priority   = int16_t(TaskPriority::Low);
       // f.m_task->m_apply = nullptr;
       // f.m_task->m_destroy = nullptr;
 
@@ -498,6 +532,15 @@ class BasicTaskScheduler : public Impl::TaskSchedulerBase {
     return m_queue->m_accum_alloc;
   }
 
+  /** \brief  Tasks stolen so far by the teams executing this scheduler,
+   *          from teams in the same package and from other packages.
+   *          Always zero for a single queue.
+   */
+  KOKKOS_INLINE_FUNCTION
+  Impl::TaskStealCounts steal_counts() const noexcept {
+    return m_queue->steal_counts();
+  }
+
   //----------------------------------------
 
   template <class S, class Q>
@@ -662,6 +705,36 @@ typename Scheduler::template future_type_for_functor<
                                std::forward<FunctorType>(arg_functor));
 }
 
+/**\brief  A task spawns a batch of tasks with options
+ *
+ *  1) Team or Serial
+ *  2) High, Normal, or Low priority
+ *
+ *  The i-th task of the batch runs the functor returned by
+ *  'arg_generator(i)'.  The tasks are enqueued together and the returned
+ *  future, like that of 'when_all', is ready when all of them are complete.
+ */
+template <int TaskEnum, typename Scheduler, typename GeneratorType>
+BasicFuture<void, Scheduler> KOKKOS_INLINE_FUNCTION
+task_spawn_batch(Impl::TaskPolicyWithScheduler<TaskEnum, Scheduler> arg_policy,
+                 int arg_count, GeneratorType const& arg_generator) {
+  using scheduler_type = Scheduler;
+
+  using functor_type = typename std::decay<decltype(arg_generator(0))>::type;
+  using task_type =
+      typename scheduler_type::template runnable_task_type<functor_type>;
+
+  static_assert(TaskEnum == Impl::TaskType::TaskTeam ||
+                    TaskEnum == Impl::TaskType::TaskSingle,
+                "Kokkos task_spawn_batch requires TaskTeam or TaskSingle");
+
+  typename task_type::function_type const ptr = task_type::apply;
+  typename task_type::destroy_type const dtor = task_type::destroy;
+
+  return scheduler_type::spawn_batch(std::move(arg_policy), ptr, dtor,
+                                     arg_count, arg_generator);
+}
+
 /**\brief  A task respawns itself with options
  *
  *  1) With scheduler or dependence
@@ -516,6 +516,8 @@ constexpr Kokkos::Impl::WithoutInitializing_t WithoutInitializing =
 constexpr Kokkos::Impl::AllowPadding_t AllowPadding =
     Kokkos::Impl::AllowPadding_t();
 
+constexpr Kokkos::Impl::FirstTouch_t FirstTouch = Kokkos::Impl::FirstTouch_t();
+
 }  // namespace
 
 /** \brief  Create View allocation parameter bundle from argument list.
@@ -527,6 +529,8 @@ constexpr Kokkos::Impl::AllowPadding_t AllowPadding =
  *    4) Kokkos::WithoutInitializing to bypass initialization
  *    4) Kokkos::AllowPadding to allow allocation to pad dimensions for memory
  * alignment
+ *    5) Kokkos::FirstTouch to touch the pages of an uninitialized HostSpace
+ *       allocation in parallel, see Kokkos::Impl::set_host_first_touch
  */
 template <class... Args>
 inline Impl::ViewCtorProp<typename Impl::ViewCtorProp<void, Args>::type...>
@@ -173,6 +173,37 @@ class WorkGraphPolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
     }
   }
 
+  /**\brief  Complete work item 'w', calling 'ready( j )' for each
+   *          successor 'j' whose last predecessor was 'w' instead of
+   *          pushing it onto the shared ready queue.
+   *
+   *  Used by the host implementations, which keep their own per-thread
+   *  ready lists.
+   */
+  template <class ReadyFunctor>
+  KOKKOS_INLINE_FUNCTION void completed_work(
+      std::int32_t w, ReadyFunctor const& ready) const noexcept {
+    Kokkos::memory_fence();
+
+    const std::int32_t N = m_graph.numRows();
+
+    std::int32_t volatile* const count_queue = &m_queue[N];
+
+    const std::int32_t B = m_graph.row_map(w);
+    const std::int32_t E = m_graph.row_map(w + 1);
+
+    for (std::int32_t i = B; i < E; ++i) {
+      const std::int32_t j = m_graph.entries(i);
+      if (1 == atomic_fetch_add(count_queue + j, -1)) {
+        ready(j);
+      }
+    }
+  }
+
+  /**\brief  Total number of work items */
+  KOKKOS_INLINE_FUNCTION
+  std::int32_t work_count() const noexcept { return m_graph.numRows(); }
+
   struct TagInit {};
   struct TagCount {};
   struct TagReady {};
@@ -84,6 +84,25 @@ unsigned get_available_cores_per_numa();
  * hyperthreads */
 unsigned get_available_threads_per_core();
 
+/** \brief  Query number of "hard" threads within a locality domain;
+ *          i.e., a NUMA region if hwloc reports more than one and
+ *          otherwise the threads sharing the last level cache as
+ *          reported by /sys.  Return 0 if unknown.
+ */
+unsigned get_available_threads_per_domain();
+
+/** \brief  Query number of NUMA nodes with memory, the nodes on which
+ *          HostSpace allocations can be placed.  Uses the Linux /sys
+ *          node list if available and otherwise the NUMA region count.
+ */
+unsigned get_memory_numa_count();
+
+/** \brief  Query the operating system id of NUMA node 'numa', in
+ *          [ 0 , get_memory_numa_count() ), as used by the memory policy
+ *          system calls.  Return -1 if out of range.
+ */
+int get_memory_numa_id(const unsigned numa);
+
 } /* namespace hwloc */
 } /* namespace Kokkos */
 
@@ -135,6 +154,48 @@ unsigned bind_this_thread(const unsigned coordinate_count,
 /** \brief  Unbind the current thread back to the original process binding */
 bool unbind_this_thread();
 
+/** \brief  Placement of the persistent threads of a host thread pool.
+ *
+ *  NONE    : leave placement to the process binding (default)
+ *  COMPACT : consecutive pool ranks fill the hyperthreads of a core
+ *            before moving on to the neighbouring core
+ *  SCATTER : pool ranks are spread evenly over the available cores,
+ *            neighbouring ranks on neighbouring cores
+ *  NUMA    : pool ranks are divided into contiguous blocks, one per
+ *            NUMA region, and bound to all cores of their region
+ *
+ *  Set by the '--kokkos-bind' argument or the KOKKOS_BIND environment
+ *  variable.  Uses the hwloc topology if hwloc can bind threads and
+ *  otherwise the Linux /sys topology and sched_setaffinity.
+ */
+enum class BindPolicy : int { NONE, COMPACT, SCATTER, NUMA };
+
+BindPolicy get_bind_policy() noexcept;
+
+void set_bind_policy(const BindPolicy policy);
+
+/** \brief  Bind the current thread, rank 'pool_rank' of a pool of
+ *          'pool_size' threads, according to the bind policy.
+ *          Return false if the policy is NONE or binding failed.
+ *
+ *  Host backends partition static work by pool rank, so neighbouring
+ *  ranges of work land on neighbouring cores.
+ */
+bool bind_pool_thread(const unsigned pool_rank, const unsigned pool_size);
+
+/** \brief  Undo 'bind_pool_thread' for the current thread */
+bool unbind_pool_thread();
+
+/** \brief  Query the core, last level cache and package the calling thread
+ *          is bound to, as reported by the Linux /sys topology.  Hardware
+ *          threads sharing a core, cache or package have the same id for it.
+ *          The core or cache is -1 when the affinity of the thread spans
+ *          several of them, e.g. when it is not bound.
+ *          Return false and leave the arguments unchanged if the package
+ *          is unknown or not unique.
+ */
+bool get_this_thread_locality(int& core, int& cache, int& package);
+
 } /* namespace hwloc */
 } /* namespace Kokkos */
 
@@ -48,8 +48,10 @@
 #include <cstdio>
 #include <cstdlib>
 
+#include <algorithm>
 #include <limits>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 #include <Kokkos_Core.hpp>
@@ -240,6 +242,224 @@ void OpenMPExec::resize_thread_data(size_t pool_reduce_bytes,
   }
 }
 
+//----------------------------------------------------------------------------
+
+namespace {
+
+std::mutex &openmp_async_registry_mutex() {
+  static std::mutex registry_mutex;
+  return registry_mutex;
+}
+
+// Signaled when an instance has released the threads it owns
+std::condition_variable &openmp_async_registry_cv() {
+  static std::condition_variable registry_cv;
+  return registry_cv;
+}
+
+// Live instances created by 'partition'.  The reference is weak, and
+// expired from the release of the last copy until the instance has
+// released its threads and removed its entry.
+struct OpenMPAsyncEntry {
+  OpenMPAsyncInstance *instance;
+  std::weak_ptr<OpenMPAsyncInstance> reference;
+};
+
+std::vector<OpenMPAsyncEntry> &openmp_async_registry() {
+  static std::vector<OpenMPAsyncEntry> registry;
+  return registry;
+}
+
+// Threads of the default pool owned by a live instance, by pool rank
+std::vector<bool> &openmp_async_claims() {
+  static std::vector<bool> claims;
+  return claims;
+}
+
+void openmp_async_unclaim(const int offset, const int size) {
+  std::vector<bool> &claims = openmp_async_claims();
+  for (int i = offset; i < offset + size && i < int(claims.size()); ++i) {
+    claims[i] = false;
+  }
+}
+
+uint32_t openmp_async_next_instance_id() {
+  static uint32_t next_id = 0;
+  return Kokkos::atomic_fetch_add(&next_id, 1u) + 1u;
+}
+
+}  // namespace
+
+OpenMPAsyncInstance::OpenMPAsyncInstance(int arg_pool_size,
+                                         int arg_hardware_id_offset)
+    : m_pool_size(arg_pool_size),
+      m_hardware_id_offset(arg_hardware_id_offset),
+      m_instance_id(openmp_async_next_instance_id()),
+      m_exec(nullptr),
+      m_mutex(),
+      m_cv_dispatch(),
+      m_cv_complete(),
+      m_queue(),
+      m_dispatched(0),
+      m_completed(0),
+      m_ready(false),
+      m_terminate(false),
+      m_orphaned(false),
+      m_master() {
+  m_master = std::thread(&OpenMPAsyncInstance::driver, this);
+
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv_complete.wait(lock, [this]() { return m_ready; });
+  }
+
+  if (m_exec == nullptr) {
+    m_master.join();
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::OpenMP::partition ERROR: failed to allocate instance");
+  }
+}
+
+OpenMPAsyncInstance::~OpenMPAsyncInstance() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_terminate = true;
+  }
+  m_cv_dispatch.notify_one();
+  if (m_master.joinable()) m_master.join();
+}
+
+void OpenMPAsyncInstance::release() {
+  // No functor is queued once the last copy is released, so the threads
+  // are handed back before the master thread exits.
+  {
+    std::lock_guard<std::mutex> lock(openmp_async_registry_mutex());
+    auto &registry = openmp_async_registry();
+    registry.erase(std::remove_if(registry.begin(), registry.end(),
+                                  [this](OpenMPAsyncEntry const &entry) {
+                                    return entry.instance == this;
+                                  }),
+                   registry.end());
+    openmp_async_unclaim(m_hardware_id_offset, m_pool_size);
+  }
+  openmp_async_registry_cv().notify_all();
+
+  if (std::this_thread::get_id() == m_master.get_id()) {
+    // The driver is executing the functor releasing the last copy and
+    // deletes the instance once the functor has completed.
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_terminate = true;
+    m_orphaned  = true;
+  } else {
+    delete this;
+  }
+}
+
+void OpenMPAsyncInstance::driver() {
+  // The master thread and its OpenMP team form the instance's thread pool;
+  // the thread pool data is first touched by the threads which use it.
+  // The threads take the place of the default pool's threads of the same
+  // ranks, so they are bound to the same cores.
+  const int hardware_id_offset = m_hardware_id_offset;
+  const int default_pool_size  = g_openmp_hardware_max_threads;
+
+#pragma omp parallel num_threads(m_pool_size)
+  {
+    t_openmp_instance    = nullptr;
+    t_openmp_hardware_id = hardware_id_offset + omp_get_thread_num();
+    SharedAllocationRecord<void, void>::tracking_enable();
+    Kokkos::hwloc::bind_pool_thread(t_openmp_hardware_id, default_pool_size);
+  }
+
+  OpenMP::memory_space space;
+  OpenMPExec *exec = nullptr;
+  try {
+    exec = new (space.allocate(sizeof(OpenMPExec))) OpenMPExec(m_pool_size);
+    exec->m_async_instance = this;
+
+    t_openmp_instance = exec;
+
+    exec->resize_thread_data(32 * m_pool_size, 32 * m_pool_size,
+                             1024 * m_pool_size, 1024);
+  } catch (Kokkos::Experimental::RawMemoryAllocationFailure const &) {
+    if (exec) {
+      exec->~OpenMPExec();
+      space.deallocate(exec, sizeof(OpenMPExec));
+    }
+    exec              = nullptr;
+    t_openmp_instance = nullptr;
+  }
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_exec  = exec;
+  m_ready = true;
+  m_cv_complete.notify_all();
+
+  if (exec == nullptr) return;
+
+  while (true) {
+    m_cv_dispatch.wait(lock,
+                       [this]() { return m_terminate || !m_queue.empty(); });
+
+    if (m_queue.empty()) break;
+
+    std::function<void()> f = std::move(m_queue.front());
+    m_queue.pop_front();
+
+    lock.unlock();
+    f();
+    // Release the functor before the dispatching thread can observe completion
+    f = nullptr;
+    lock.lock();
+
+    ++m_completed;
+    m_cv_complete.notify_all();
+  }
+
+  const bool orphaned = m_orphaned;
+  lock.unlock();
+
+  exec->~OpenMPExec();
+  space.deallocate(exec, sizeof(OpenMPExec));
+  t_openmp_instance = nullptr;
+
+  if (orphaned) {
+    m_master.detach();
+    delete this;
+  }
+}
+
+void OpenMPAsyncInstance::dispatch(std::function<void()> f) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_queue.push_back(std::move(f));
+    ++m_dispatched;
+  }
+  m_cv_dispatch.notify_one();
+}
+
+void OpenMPAsyncInstance::fence() {
+  // Functors executing on the master thread are already ordered
+  if (t_openmp_instance == m_exec) return;
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_cv_complete.wait(lock, [this]() { return m_completed == m_dispatched; });
+}
+
+void OpenMPAsyncInstance::fence_all() {
+  // Fence without the registry lock: a fenced functor may release the last
+  // copy of an instance, whose release takes the lock.
+  std::vector<std::shared_ptr<OpenMPAsyncInstance>> instances;
+  {
+    std::lock_guard<std::mutex> lock(openmp_async_registry_mutex());
+    for (auto const &entry : openmp_async_registry()) {
+      std::shared_ptr<OpenMPAsyncInstance> instance = entry.reference.lock();
+      if (instance) instances.push_back(std::move(instance));
+    }
+  }
+  for (auto const &instance : instances) instance->fence();
+}
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -280,7 +500,8 @@ void OpenMP::impl_initialize(int thread_count) {
   }
 
   {
-    if (Kokkos::show_warnings() && nullptr == std::getenv("OMP_PROC_BIND")) {
+    if (Kokkos::show_warnings() && nullptr == std::getenv("OMP_PROC_BIND") &&
+        Kokkos::hwloc::BindPolicy::NONE == Kokkos::hwloc::get_bind_policy()) {
       printf(
           "Kokkos::OpenMP::initialize WARNING: OMP_PROC_BIND environment "
           "variable not set\n");
@@ -334,6 +555,10 @@ void OpenMP::impl_initialize(int thread_count) {
       Impl::t_openmp_instance    = nullptr;
       Impl::t_openmp_hardware_id = omp_get_thread_num();
       Impl::SharedAllocationRecord<void, void>::tracking_enable();
+
+      // The pool rank of a thread is its OpenMP thread number.
+      Kokkos::hwloc::bind_pool_thread(omp_get_thread_num(),
+                                      omp_get_num_threads());
     }
 
     void *ptr = nullptr;
@@ -389,6 +614,9 @@ void OpenMP::impl_finalize() {
     Kokkos::Impl::throw_runtime_exception(msg);
   }
 
+  // Instances created by 'partition' may still be executing
+  Impl::OpenMPAsyncInstance::fence_all();
+
   if (Impl::t_openmp_instance) {
     // Silence Cuda Warning
     const int nthreads = Impl::t_openmp_instance->m_pool_size <=
@@ -409,6 +637,7 @@ void OpenMP::impl_finalize() {
       Impl::t_openmp_hardware_id = 0;
       Impl::t_openmp_instance    = nullptr;
       Impl::SharedAllocationRecord<void, void>::tracking_disable();
+      Kokkos::hwloc::unbind_pool_thread();
     }
 
     // allow main thread to track
@@ -441,13 +670,108 @@ void OpenMP::print_configuration(std::ostream &s, const bool /*verbose*/) {
   }
 }
 
-std::vector<OpenMP> OpenMP::partition(...) { return std::vector<OpenMP>(1); }
+std::vector<OpenMP> OpenMP::partition(int num_partitions,
+                                      int partition_size) {
+  Impl::OpenMPExec::verify_is_master("Kokkos::OpenMP::partition");
+
+  const int pool_size = Impl::g_openmp_hardware_max_threads;
+
+  // Each instance owns a contiguous slice of the default pool's ranks which
+  // no other live instance owns.
+  std::vector<int> offsets;
+  {
+    // Wait for released instances to hand back their threads
+    std::unique_lock<std::mutex> lock(Impl::openmp_async_registry_mutex());
+    Impl::openmp_async_registry_cv().wait(lock, []() {
+      auto const &registry = Impl::openmp_async_registry();
+      return std::none_of(registry.begin(), registry.end(),
+                          [](Impl::OpenMPAsyncEntry const &entry) {
+                            return entry.reference.expired();
+                          });
+    });
+
+    std::vector<bool> &claims = Impl::openmp_async_claims();
+    if (int(claims.size()) < pool_size) claims.resize(pool_size, false);
+
+    const int free_threads =
+        int(std::count(claims.begin(), claims.begin() + pool_size, false));
+    if (free_threads == 0) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::OpenMP::partition ERROR: all threads of the default pool "
+          "are owned by other partitions");
+    }
+
+    Impl::OpenMPExec::validate_partition(free_threads, num_partitions,
+                                         partition_size);
+
+    for (int i = 0; i + partition_size <= pool_size &&
+                    int(offsets.size()) < num_partitions;) {
+      const auto begin = claims.begin() + i;
+      if (std::find(begin, begin + partition_size, true) ==
+          begin + partition_size) {
+        offsets.push_back(i);
+        i += partition_size;
+      } else {
+        ++i;
+      }
+    }
+    if (int(offsets.size()) < num_partitions) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::OpenMP::partition ERROR: the partitions do not fit in the "
+          "threads of the default pool not owned by other partitions");
+    }
+    for (const int offset : offsets) {
+      std::fill(claims.begin() + offset,
+                claims.begin() + offset + partition_size, true);
+    }
+  }
+
+  std::vector<OpenMP> instances;
+  instances.reserve(num_partitions);
+
+  for (int i = 0; i < num_partitions; ++i) {
+    OpenMP instance;
+    try {
+      instance.m_async_instance = std::shared_ptr<Impl::OpenMPAsyncInstance>(
+          new Impl::OpenMPAsyncInstance(partition_size, offsets[i]),
+          [](Impl::OpenMPAsyncInstance *ptr) { ptr->release(); });
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(Impl::openmp_async_registry_mutex());
+      for (int j = i; j < num_partitions; ++j) {
+        Impl::openmp_async_unclaim(offsets[j], partition_size);
+      }
+      throw;
+    }
+    {
+      std::lock_guard<std::mutex> lock(Impl::openmp_async_registry_mutex());
+      Impl::openmp_async_registry().push_back(
+          {instance.m_async_instance.get(), instance.m_async_instance});
+    }
+    instances.push_back(instance);
+  }
+
+  return instances;
+}
 
 OpenMP OpenMP::create_instance(...) { return OpenMP(); }
 
 int OpenMP::concurrency() { return Impl::g_openmp_hardware_max_threads; }
 
-void OpenMP::fence() const {}
+void OpenMP::impl_static_fence(OpenMP const &instance) noexcept {
+  if (instance.m_async_instance) {
+    instance.m_async_instance->fence();
+  } else {
+    Impl::OpenMPAsyncInstance::fence_all();
+  }
+}
+
+void OpenMP::fence() const {
+  if (m_async_instance) m_async_instance->fence();
+}
+
+uint32_t OpenMP::impl_instance_id() const noexcept {
+  return m_async_instance ? m_async_instance->instance_id() : 0;
+}
 }  // namespace Kokkos
 
 #else
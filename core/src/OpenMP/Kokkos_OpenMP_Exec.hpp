@@ -65,6 +65,13 @@
 
 #include <omp.h>
 
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
 
@@ -84,6 +91,7 @@ extern __thread OpenMPExec* t_openmp_instance;
 class OpenMPExec {
  public:
   friend class Kokkos::OpenMP;
+  friend class OpenMPAsyncInstance;
 
   enum { MAX_THREAD_COUNT = 512 };
 
@@ -101,6 +109,9 @@ class OpenMPExec {
   int m_pool_size;
   int m_level;
 
+  // Asynchronous instance owning this pool, nullptr for the default instance
+  OpenMPAsyncInstance* m_async_instance = nullptr;
+
   HostThreadTeamData* m_pool[MAX_THREAD_COUNT];
 
  public:
@@ -116,8 +127,92 @@ class OpenMPExec {
   inline HostThreadTeamData* get_thread_data(int i) const noexcept {
     return m_pool[i];
   }
+
+  inline int pool_size() const noexcept { return m_pool_size; }
+
+  inline OpenMPAsyncInstance* async_instance() const noexcept {
+    return m_async_instance;
+  }
 };
 
+//----------------------------------------------------------------------------
+/** \brief  Asynchronous OpenMP execution space instance
+ *
+ *  Owns a master thread which executes the functors dispatched to the
+ *  instance in order, each within an OpenMP parallel region of the
+ *  instance's pool size.  The master thread's 't_openmp_instance' is the
+ *  instance's OpenMPExec so that the parallel patterns run on it exactly
+ *  as they run on the default instance.
+ *
+ *  Dispatched closures hold copies of their policy's execution space, so
+ *  the last copy may be released by a functor on the master thread.  The
+ *  instance is then deleted by the master thread after the functor
+ *  returns instead of joining itself; see 'release'.
+ */
+class OpenMPAsyncInstance {
+ public:
+  OpenMPAsyncInstance(int arg_pool_size, int arg_hardware_id_offset);
+  ~OpenMPAsyncInstance();
+
+  /// \brief Hand back the instance's threads of the default pool and
+  ///        delete the instance, deferred to the end of the executing
+  ///        functor when called on the instance's master thread
+  void release();
+
+  OpenMPAsyncInstance(OpenMPAsyncInstance const&) = delete;
+  OpenMPAsyncInstance& operator=(OpenMPAsyncInstance const&) = delete;
+
+  inline OpenMPExec* exec() const noexcept { return m_exec; }
+  inline uint32_t instance_id() const noexcept { return m_instance_id; }
+
+  /// \brief Append 'f' to the instance's queue of functors
+  void dispatch(std::function<void()> f);
+
+  /// \brief Wait until all dispatched functors have completed
+  void fence();
+
+  /// \brief Wait until all functors dispatched to any instance have completed
+  static void fence_all();
+
+ private:
+  void driver();
+
+  int m_pool_size;
+  int m_hardware_id_offset;
+  uint32_t m_instance_id;
+  OpenMPExec* m_exec;
+
+  std::mutex m_mutex;
+  std::condition_variable m_cv_dispatch;
+  std::condition_variable m_cv_complete;
+  std::deque<std::function<void()>> m_queue;
+  uint64_t m_dispatched;
+  uint64_t m_completed;
+  bool m_ready;
+  bool m_terminate;
+  bool m_orphaned;
+
+  std::thread m_master;
+};
+
+/** \brief  Dispatch 'closure.execute()' to the master thread of the
+ *          asynchronous instance owning 'instance'.
+ *
+ *  Returns false if the caller must execute the closure itself; i.e., the
+ *  instance is not asynchronous, the caller is the instance's master thread,
+ *  or the caller is within a parallel region.
+ */
+template <class Closure>
+inline bool openmp_dispatch_async(OpenMPExec const* instance,
+                                  Closure const& closure) {
+  if (instance == nullptr || instance->async_instance() == nullptr ||
+      instance == t_openmp_instance || OpenMP::in_parallel()) {
+    return false;
+  }
+  instance->async_instance()->dispatch([closure]() { closure.execute(); });
+  return true;
+}
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -150,10 +245,18 @@ int OpenMP::impl_thread_pool_rank() noexcept {
 #endif
 }
 
-inline void OpenMP::impl_static_fence(OpenMP const& /*instance*/) noexcept {}
+inline bool OpenMP::is_asynchronous(OpenMP const& instance) noexcept {
+  return instance.m_async_instance != nullptr;
+}
+
+inline Impl::OpenMPExec* OpenMP::impl_internal_space_instance() const
+    noexcept {
+  return m_async_instance ? m_async_instance->exec() : Impl::t_openmp_instance;
+}
 
-inline bool OpenMP::is_asynchronous(OpenMP const& /*instance*/) noexcept {
-  return false;
+inline int OpenMP::impl_instance_pool_size() const noexcept {
+  return m_async_instance ? m_async_instance->exec()->pool_size()
+                          : impl_thread_pool_size();
 }
 
 template <typename F>
@@ -0,0 +1,89 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_OPENMP_HOSTGRAPH_HPP
+#define KOKKOS_OPENMP_HOSTGRAPH_HPP
+
+#include <Kokkos_OpenMP.hpp>
+
+namespace Kokkos {
+namespace Impl {
+
+template <>
+class HostGraphExec<Kokkos::OpenMP> {
+ private:
+  using Graph = Kokkos::Experimental::HostGraph<Kokkos::OpenMP>;
+
+  OpenMPExec* m_instance;
+  const Graph* m_graph;
+
+ public:
+  enum : bool { single_region = true };
+
+  inline void execute() const {
+    if (openmp_dispatch_async(m_instance, *this)) return;
+
+    m_graph->impl_reset();
+
+    if (OpenMP::in_parallel()) {
+      m_graph->impl_execute(0, 1);
+    } else {
+      OpenMPExec::verify_is_master("Kokkos::HostGraph::submit");
+
+#pragma omp parallel num_threads(OpenMP::impl_thread_pool_size())
+      {
+        m_graph->impl_execute(omp_get_thread_num(), omp_get_num_threads());
+      }
+    }
+  }
+
+  HostGraphExec(const Graph& arg_graph, const Kokkos::OpenMP& arg_space)
+      : m_instance(arg_space.impl_internal_space_instance()),
+        m_graph(&arg_graph) {}
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif /* #define KOKKOS_OPENMP_HOSTGRAPH_HPP */
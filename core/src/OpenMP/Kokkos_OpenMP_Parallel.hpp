@@ -105,6 +105,8 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>, Kokkos::OpenMP> {
 
  public:
   inline void execute() const {
+    if (openmp_dispatch_async(m_instance, *this)) return;
+
     enum {
       is_dynamic = std::is_same<typename Policy::schedule_type::type,
                                 Kokkos::Dynamic>::value
@@ -130,7 +132,7 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>, Kokkos::OpenMP> {
         std::pair<int64_t, int64_t> range(0, 0);
 
         do {
-          range = is_dynamic ? data.get_work_stealing_chunk()
+          range = is_dynamic ? data.get_work_stealing_range()
                              : data.get_work_partition();
 
           ParallelFor::template exec_range<WorkTag>(
@@ -143,7 +145,7 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>, Kokkos::OpenMP> {
   }
 
   inline ParallelFor(const FunctorType& arg_functor, Policy arg_policy)
-      : m_instance(t_openmp_instance),
+      : m_instance(arg_policy.space().impl_internal_space_instance()),
         m_functor(arg_functor),
         m_policy(arg_policy) {}
 };
@@ -184,6 +186,8 @@ class ParallelFor<FunctorType, Kokkos::MDRangePolicy<Traits...>,
 
  public:
   inline void execute() const {
+    if (openmp_dispatch_async(m_instance, *this)) return;
+
     enum {
       is_dynamic = std::is_same<typename Policy::schedule_type::type,
                                 Kokkos::Dynamic>::value
@@ -210,7 +214,7 @@ class ParallelFor<FunctorType, Kokkos::MDRangePolicy<Traits...>,
         std::pair<int64_t, int64_t> range(0, 0);
 
         do {
-          range = is_dynamic ? data.get_work_stealing_chunk()
+          range = is_dynamic ? data.get_work_stealing_range()
                              : data.get_work_partition();
 
           ParallelFor::exec_range(m_mdr_policy, m_functor,
@@ -224,7 +228,7 @@ class ParallelFor<FunctorType, Kokkos::MDRangePolicy<Traits...>,
   }
 
   inline ParallelFor(const FunctorType& arg_functor, MDRangePolicy arg_policy)
-      : m_instance(t_openmp_instance),
+      : m_instance(arg_policy.space().impl_internal_space_instance()),
         m_functor(arg_functor),
         m_mdr_policy(arg_policy),
         m_policy(Policy(0, m_mdr_policy.m_num_tiles).set_chunk_size(1)) {}
@@ -297,6 +301,8 @@ class ParallelReduce<FunctorType, Kokkos::RangePolicy<Traits...>, ReducerType,
 
  public:
   inline void execute() const {
+    if (openmp_dispatch_async(m_instance, *this)) return;
+
     enum {
       is_dynamic = std::is_same<typename Policy::schedule_type::type,
                                 Kokkos::Dynamic>::value
@@ -334,7 +340,7 @@ class ParallelReduce<FunctorType, Kokkos::RangePolicy<Traits...>, ReducerType,
       std::pair<int64_t, int64_t> range(0, 0);
 
       do {
-        range = is_dynamic ? data.get_work_stealing_chunk()
+        range = is_dynamic ? data.get_work_stealing_range()
                            : data.get_work_partition();
 
         ParallelReduce::template exec_range<WorkTag>(
@@ -342,6 +348,17 @@ class ParallelReduce<FunctorType, Kokkos::RangePolicy<Traits...>, ReducerType,
             range.second + m_policy.begin(), update);
 
       } while (is_dynamic && 0 <= range.first);
+
+      // Join the contributions within each locality domain in parallel,
+      // the master then joins the first members of the domains.
+      if (data.domain_rendezvous()) {
+        for (int i = 1; i < data.domain_size(); ++i) {
+          ValueJoin::join(ReducerConditional::select(m_functor, m_reducer),
+                          data.pool_reduce_local(),
+                          data.domain_member(i)->pool_reduce_local());
+        }
+        data.domain_rendezvous_release();
+      }
     }
 
     // Reduction:
@@ -349,7 +366,8 @@ class ParallelReduce<FunctorType, Kokkos::RangePolicy<Traits...>, ReducerType,
     const pointer_type ptr =
         pointer_type(m_instance->get_thread_data(0)->pool_reduce_local());
 
-    for (int i = 1; i < pool_size; ++i) {
+    for (int i = m_instance->get_thread_data(0)->domain_size(); i < pool_size;
+         i += m_instance->get_thread_data(i)->domain_size()) {
       ValueJoin::join(ReducerConditional::select(m_functor, m_reducer), ptr,
                       m_instance->get_thread_data(i)->pool_reduce_local());
     }
@@ -376,7 +394,7 @@ class ParallelReduce<FunctorType, Kokkos::RangePolicy<Traits...>, ReducerType,
       typename std::enable_if<Kokkos::is_view<ViewType>::value &&
                                   !Kokkos::is_reducer_type<ReducerType>::value,
                               void*>::type = nullptr)
-      : m_instance(t_openmp_instance),
+      : m_instance(arg_policy.space().impl_internal_space_instance()),
         m_functor(arg_functor),
         m_policy(arg_policy),
         m_reducer(InvalidType()),
@@ -389,7 +407,7 @@ class ParallelReduce<FunctorType, Kokkos::RangePolicy<Traits...>, ReducerType,
 
   inline ParallelReduce(const FunctorType& arg_functor, Policy arg_policy,
                         const ReducerType& reducer)
-      : m_instance(t_openmp_instance),
+      : m_instance(arg_policy.space().impl_internal_space_instance()),
         m_functor(arg_functor),
         m_policy(arg_policy),
         m_reducer(reducer),
@@ -453,6 +471,8 @@ class ParallelReduce<FunctorType, Kokkos::MDRangePolicy<Traits...>, ReducerType,
 
  public:
   inline void execute() const {
+    if (openmp_dispatch_async(m_instance, *this)) return;
+
     enum {
       is_dynamic = std::is_same<typename Policy::schedule_type::type,
                                 Kokkos::Dynamic>::value
@@ -490,7 +510,7 @@ class ParallelReduce<FunctorType, Kokkos::MDRangePolicy<Traits...>, ReducerType,
       std::pair<int64_t, int64_t> range(0, 0);
 
       do {
-        range = is_dynamic ? data.get_work_stealing_chunk()
+        range = is_dynamic ? data.get_work_stealing_range()
                            : data.get_work_partition();
 
         ParallelReduce::exec_range(m_mdr_policy, m_functor,
@@ -498,6 +518,17 @@ class ParallelReduce<FunctorType, Kokkos::MDRangePolicy<Traits...>, ReducerType,
                                    range.second + m_policy.begin(), update);
 
       } while (is_dynamic && 0 <= range.first);
+
+      // Join the contributions within each locality domain in parallel,
+      // the master then joins the first members of the domains.
+      if (data.domain_rendezvous()) {
+        for (int i = 1; i < data.domain_size(); ++i) {
+          ValueJoin::join(ReducerConditional::select(m_functor, m_reducer),
+                          data.pool_reduce_local(),
+                          data.domain_member(i)->pool_reduce_local());
+        }
+        data.domain_rendezvous_release();
+      }
     }
     // END #pragma omp parallel
 
@@ -506,7 +537,8 @@ class ParallelReduce<FunctorType, Kokkos::MDRangePolicy<Traits...>, ReducerType,
     const pointer_type ptr =
         pointer_type(m_instance->get_thread_data(0)->pool_reduce_local());
 
-    for (int i = 1; i < pool_size; ++i) {
+    for (int i = m_instance->get_thread_data(0)->domain_size(); i < pool_size;
+         i += m_instance->get_thread_data(i)->domain_size()) {
       ValueJoin::join(ReducerConditional::select(m_functor, m_reducer), ptr,
                       m_instance->get_thread_data(i)->pool_reduce_local());
     }
@@ -533,7 +565,7 @@ class ParallelReduce<FunctorType, Kokkos::MDRangePolicy<Traits...>, ReducerType,
       typename std::enable_if<Kokkos::is_view<ViewType>::value &&
                                   !Kokkos::is_reducer_type<ReducerType>::value,
                               void*>::type = nullptr)
-      : m_instance(t_openmp_instance),
+      : m_instance(arg_policy.space().impl_internal_space_instance()),
         m_functor(arg_functor),
         m_mdr_policy(arg_policy),
         m_policy(Policy(0, m_mdr_policy.m_num_tiles).set_chunk_size(1)),
@@ -547,7 +579,7 @@ class ParallelReduce<FunctorType, Kokkos::MDRangePolicy<Traits...>, ReducerType,
 
   inline ParallelReduce(const FunctorType& arg_functor,
                         MDRangePolicy arg_policy, const ReducerType& reducer)
-      : m_instance(t_openmp_instance),
+      : m_instance(arg_policy.space().impl_internal_space_instance()),
         m_functor(arg_functor),
         m_mdr_policy(arg_policy),
         m_policy(Policy(0, m_mdr_policy.m_num_tiles).set_chunk_size(1)),
@@ -616,6 +648,8 @@ class ParallelScan<FunctorType, Kokkos::RangePolicy<Traits...>,
 
  public:
   inline void execute() const {
+    if (openmp_dispatch_async(m_instance, *this)) return;
+
     OpenMPExec::verify_is_master("Kokkos::OpenMP parallel_scan");
 
     const int value_count          = Analysis::value_count(m_functor);
@@ -676,7 +710,7 @@ class ParallelScan<FunctorType, Kokkos::RangePolicy<Traits...>,
   //----------------------------------------
 
   inline ParallelScan(const FunctorType& arg_functor, const Policy& arg_policy)
-      : m_instance(t_openmp_instance),
+      : m_instance(arg_policy.space().impl_internal_space_instance()),
         m_functor(arg_functor),
         m_policy(arg_policy) {}
 
@@ -731,6 +765,8 @@ class ParallelScanWithTotal<FunctorType, Kokkos::RangePolicy<Traits...>,
 
  public:
   inline void execute() const {
+    if (openmp_dispatch_async(m_instance, *this)) return;
+
     OpenMPExec::verify_is_master("Kokkos::OpenMP parallel_scan");
 
     const int value_count          = Analysis::value_count(m_functor);
@@ -796,7 +832,7 @@ class ParallelScanWithTotal<FunctorType, Kokkos::RangePolicy<Traits...>,
   inline ParallelScanWithTotal(const FunctorType& arg_functor,
                                const Policy& arg_policy,
                                ReturnType& arg_returnvalue)
-      : m_instance(t_openmp_instance),
+      : m_instance(arg_policy.space().impl_internal_space_instance()),
         m_functor(arg_functor),
         m_policy(arg_policy),
         m_returnvalue(arg_returnvalue) {}
@@ -804,6 +840,244 @@ class ParallelScanWithTotal<FunctorType, Kokkos::RangePolicy<Traits...>,
   //----------------------------------------
 };
 
+// MDRangePolicy impl
+template <class FunctorType, class... Traits>
+class ParallelScan<FunctorType, Kokkos::MDRangePolicy<Traits...>,
+                   Kokkos::OpenMP> {
+ private:
+  using MDRangePolicy = Kokkos::MDRangePolicy<Traits...>;
+  using Policy        = typename MDRangePolicy::impl_range_policy;
+
+  using Analysis = FunctorAnalysis<FunctorPatternInterface::SCAN,
+                                   MDRangePolicy, FunctorType>;
+
+  using WorkTag   = typename MDRangePolicy::work_tag;
+  using WorkRange = typename Policy::WorkRange;
+  using Member    = typename Policy::member_type;
+
+  using ValueInit = Kokkos::Impl::FunctorValueInit<FunctorType, WorkTag>;
+  using ValueJoin = Kokkos::Impl::FunctorValueJoin<FunctorType, WorkTag>;
+  using ValueOps  = Kokkos::Impl::FunctorValueOps<FunctorType, WorkTag>;
+
+  using pointer_type   = typename Analysis::pointer_type;
+  using reference_type = typename Analysis::reference_type;
+
+  using iterate_type =
+      typename Kokkos::Impl::HostIterateTileScan<MDRangePolicy, FunctorType,
+                                                 WorkTag, reference_type>;
+
+  OpenMPExec* m_instance;
+  const FunctorType m_functor;
+  const MDRangePolicy m_mdr_policy;
+  const Policy m_policy;  // construct as RangePolicy( 0, num_tiles
+                          // ).set_chunk_size(1) in ctor
+
+  inline static void exec_range(const MDRangePolicy& mdr_policy,
+                                const FunctorType& functor, const Member ibeg,
+                                const Member iend, reference_type update,
+                                const bool final) {
+    for (Member iwork = ibeg; iwork < iend; ++iwork) {
+      iterate_type(mdr_policy, functor, update, final)(iwork);
+    }
+  }
+
+ public:
+  inline void execute() const {
+    if (openmp_dispatch_async(m_instance, *this)) return;
+
+    OpenMPExec::verify_is_master("Kokkos::OpenMP parallel_scan");
+
+    const int value_count          = Analysis::value_count(m_functor);
+    const size_t pool_reduce_bytes = 2 * Analysis::value_size(m_functor);
+
+    m_instance->resize_thread_data(pool_reduce_bytes, 0  // team_reduce_bytes
+                                   ,
+                                   0  // team_shared_bytes
+                                   ,
+                                   0  // thread_local_bytes
+    );
+
+#pragma omp parallel num_threads(OpenMP::impl_thread_pool_size())
+    {
+      HostThreadTeamData& data = *(m_instance->get_thread_data());
+
+      // Contiguous ranges of tiles in the order of the policy
+      const WorkRange range(m_policy, omp_get_thread_num(),
+                            omp_get_num_threads());
+
+      reference_type update_sum =
+          ValueInit::init(m_functor, data.pool_reduce_local());
+
+      ParallelScan::exec_range(m_mdr_policy, m_functor, range.begin(),
+                               range.end(), update_sum, false);
+
+      if (data.pool_rendezvous()) {
+        pointer_type ptr_prev = nullptr;
+
+        const int n = omp_get_num_threads();
+
+        for (int i = 0; i < n; ++i) {
+          pointer_type ptr =
+              (pointer_type)data.pool_member(i)->pool_reduce_local();
+
+          if (i) {
+            for (int j = 0; j < value_count; ++j) {
+              ptr[j + value_count] = ptr_prev[j + value_count];
+            }
+            ValueJoin::join(m_functor, ptr + value_count, ptr_prev);
+          } else {
+            ValueInit::init(m_functor, ptr + value_count);
+          }
+
+          ptr_prev = ptr;
+        }
+
+        data.pool_rendezvous_release();
+      }
+
+      reference_type update_base = ValueOps::reference(
+          ((pointer_type)data.pool_reduce_local()) + value_count);
+
+      ParallelScan::exec_range(m_mdr_policy, m_functor, range.begin(),
+                               range.end(), update_base, true);
+    }
+  }
+
+  //----------------------------------------
+
+  inline ParallelScan(const FunctorType& arg_functor,
+                      const MDRangePolicy& arg_policy)
+      : m_instance(arg_policy.space().impl_internal_space_instance()),
+        m_functor(arg_functor),
+        m_mdr_policy(arg_policy),
+        m_policy(Policy(0, m_mdr_policy.m_num_tiles).set_chunk_size(1)) {}
+
+  //----------------------------------------
+};
+
+template <class FunctorType, class ReturnType, class... Traits>
+class ParallelScanWithTotal<FunctorType, Kokkos::MDRangePolicy<Traits...>,
+                            ReturnType, Kokkos::OpenMP> {
+ private:
+  using MDRangePolicy = Kokkos::MDRangePolicy<Traits...>;
+  using Policy        = typename MDRangePolicy::impl_range_policy;
+
+  using Analysis = FunctorAnalysis<FunctorPatternInterface::SCAN,
+                                   MDRangePolicy, FunctorType>;
+
+  using WorkTag   = typename MDRangePolicy::work_tag;
+  using WorkRange = typename Policy::WorkRange;
+  using Member    = typename Policy::member_type;
+
+  using ValueInit = Kokkos::Impl::FunctorValueInit<FunctorType, WorkTag>;
+  using ValueJoin = Kokkos::Impl::FunctorValueJoin<FunctorType, WorkTag>;
+  using ValueOps  = Kokkos::Impl::FunctorValueOps<FunctorType, WorkTag>;
+
+  using pointer_type   = typename Analysis::pointer_type;
+  using reference_type = typename Analysis::reference_type;
+
+  using iterate_type =
+      typename Kokkos::Impl::HostIterateTileScan<MDRangePolicy, FunctorType,
+                                                 WorkTag, reference_type>;
+
+  OpenMPExec* m_instance;
+  const FunctorType m_functor;
+  const MDRangePolicy m_mdr_policy;
+  const Policy m_policy;  // construct as RangePolicy( 0, num_tiles
+                          // ).set_chunk_size(1) in ctor
+  ReturnType& m_returnvalue;
+
+  inline static void exec_range(const MDRangePolicy& mdr_policy,
+                                const FunctorType& functor, const Member ibeg,
+                                const Member iend, reference_type update,
+                                const bool final) {
+    for (Member iwork = ibeg; iwork < iend; ++iwork) {
+      iterate_type(mdr_policy, functor, update, final)(iwork);
+    }
+  }
+
+ public:
+  inline void execute() const {
+    if (openmp_dispatch_async(m_instance, *this)) return;
+
+    OpenMPExec::verify_is_master("Kokkos::OpenMP parallel_scan");
+
+    const int value_count          = Analysis::value_count(m_functor);
+    const size_t pool_reduce_bytes = 2 * Analysis::value_size(m_functor);
+
+    m_instance->resize_thread_data(pool_reduce_bytes, 0  // team_reduce_bytes
+                                   ,
+                                   0  // team_shared_bytes
+                                   ,
+                                   0  // thread_local_bytes
+    );
+
+#pragma omp parallel num_threads(OpenMP::impl_thread_pool_size())
+    {
+      HostThreadTeamData& data = *(m_instance->get_thread_data());
+
+      // Contiguous ranges of tiles in the order of the policy
+      const WorkRange range(m_policy, omp_get_thread_num(),
+                            omp_get_num_threads());
+
+      reference_type update_sum =
+          ValueInit::init(m_functor, data.pool_reduce_local());
+
+      ParallelScanWithTotal::exec_range(m_mdr_policy, m_functor,
+                                        range.begin(), range.end(), update_sum,
+                                        false);
+
+      if (data.pool_rendezvous()) {
+        pointer_type ptr_prev = nullptr;
+
+        const int n = omp_get_num_threads();
+
+        for (int i = 0; i < n; ++i) {
+          pointer_type ptr =
+              (pointer_type)data.pool_member(i)->pool_reduce_local();
+
+          if (i) {
+            for (int j = 0; j < value_count; ++j) {
+              ptr[j + value_count] = ptr_prev[j + value_count];
+            }
+            ValueJoin::join(m_functor, ptr + value_count, ptr_prev);
+          } else {
+            ValueInit::init(m_functor, ptr + value_count);
+          }
+
+          ptr_prev = ptr;
+        }
+
+        data.pool_rendezvous_release();
+      }
+
+      reference_type update_base = ValueOps::reference(
+          ((pointer_type)data.pool_reduce_local()) + value_count);
+
+      ParallelScanWithTotal::exec_range(m_mdr_policy, m_functor,
+                                        range.begin(), range.end(), update_base,
+                                        true);
+
+      if (omp_get_thread_num() == omp_get_num_threads() - 1) {
+        m_returnvalue = update_base;
+      }
+    }
+  }
+
+  //----------------------------------------
+
+  inline ParallelScanWithTotal(const FunctorType& arg_functor,
+                               const MDRangePolicy& arg_policy,
+                               ReturnType& arg_returnvalue)
+      : m_instance(arg_policy.space().impl_internal_space_instance()),
+        m_functor(arg_functor),
+        m_mdr_policy(arg_policy),
+        m_policy(Policy(0, m_mdr_policy.m_num_tiles).set_chunk_size(1)),
+        m_returnvalue(arg_returnvalue) {}
+
+  //----------------------------------------
+};
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -872,6 +1146,8 @@ class ParallelFor<FunctorType, Kokkos::TeamPolicy<Properties...>,
 
  public:
   inline void execute() const {
+    if (openmp_dispatch_async(m_instance, *this)) return;
+
     enum { is_dynamic = std::is_same<SchedTag, Kokkos::Dynamic>::value };
 
     OpenMPExec::verify_is_master("Kokkos::OpenMP parallel_for");
@@ -907,7 +1183,7 @@ class ParallelFor<FunctorType, Kokkos::TeamPolicy<Properties...>,
         std::pair<int64_t, int64_t> range(0, 0);
 
         do {
-          range = is_dynamic ? data.get_work_stealing_chunk()
+          range = is_dynamic ? data.get_team_work_stealing_chunk()
                              : data.get_work_partition();
 
           ParallelFor::template exec_team<WorkTag>(m_functor, data, range.first,
@@ -922,7 +1198,7 @@ class ParallelFor<FunctorType, Kokkos::TeamPolicy<Properties...>,
   }
 
   inline ParallelFor(const FunctorType& arg_functor, const Policy& arg_policy)
-      : m_instance(t_openmp_instance),
+      : m_instance(arg_policy.space().impl_internal_space_instance()),
         m_functor(arg_functor),
         m_policy(arg_policy),
         m_shmem_size(arg_policy.scratch_size(0) + arg_policy.scratch_size(1) +
@@ -1012,6 +1288,8 @@ class ParallelReduce<FunctorType, Kokkos::TeamPolicy<Properties...>,
 
  public:
   inline void execute() const {
+    if (openmp_dispatch_async(m_instance, *this)) return;
+
     enum { is_dynamic = std::is_same<SchedTag, Kokkos::Dynamic>::value };
 
     OpenMPExec::verify_is_master("Kokkos::OpenMP parallel_reduce");
@@ -1054,7 +1332,7 @@ class ParallelReduce<FunctorType, Kokkos::TeamPolicy<Properties...>,
         std::pair<int64_t, int64_t> range(0, 0);
 
         do {
-          range = is_dynamic ? data.get_work_stealing_chunk()
+          range = is_dynamic ? data.get_team_work_stealing_chunk()
                              : data.get_work_partition();
 
           ParallelReduce::template exec_team<WorkTag>(m_functor, data, update,
@@ -1069,6 +1347,17 @@ class ParallelReduce<FunctorType, Kokkos::TeamPolicy<Properties...>,
 
       data.disband_team();
 
+      // Join the contributions within each locality domain in parallel,
+      // the master then joins the first members of the domains.
+      if (data.domain_rendezvous()) {
+        for (int i = 1; i < data.domain_size(); ++i) {
+          ValueJoin::join(ReducerConditional::select(m_functor, m_reducer),
+                          data.pool_reduce_local(),
+                          data.domain_member(i)->pool_reduce_local());
+        }
+        data.domain_rendezvous_release();
+      }
+
       //  This thread has updated 'pool_reduce_local()' with its
       //  contributions to the reduction.  The parallel region is
       //  about to terminate and the master thread will load and
@@ -1085,7 +1374,8 @@ class ParallelReduce<FunctorType, Kokkos::TeamPolicy<Properties...>,
     const pointer_type ptr =
         pointer_type(m_instance->get_thread_data(0)->pool_reduce_local());
 
-    for (int i = 1; i < pool_size; ++i) {
+    for (int i = m_instance->get_thread_data(0)->domain_size(); i < pool_size;
+         i += m_instance->get_thread_data(i)->domain_size()) {
       ValueJoin::join(ReducerConditional::select(m_functor, m_reducer), ptr,
                       m_instance->get_thread_data(i)->pool_reduce_local());
     }
@@ -1112,7 +1402,7 @@ class ParallelReduce<FunctorType, Kokkos::TeamPolicy<Properties...>,
       typename std::enable_if<Kokkos::is_view<ViewType>::value &&
                                   !Kokkos::is_reducer_type<ReducerType>::value,
                               void*>::type = nullptr)
-      : m_instance(t_openmp_instance),
+      : m_instance(arg_policy.space().impl_internal_space_instance()),
         m_functor(arg_functor),
         m_policy(arg_policy),
         m_reducer(InvalidType()),
@@ -1123,7 +1413,7 @@ class ParallelReduce<FunctorType, Kokkos::TeamPolicy<Properties...>,
 
   inline ParallelReduce(const FunctorType& arg_functor, Policy arg_policy,
                         const ReducerType& reducer)
-      : m_instance(t_openmp_instance),
+      : m_instance(arg_policy.space().impl_internal_space_instance()),
         m_functor(arg_functor),
         m_policy(arg_policy),
         m_reducer(reducer),
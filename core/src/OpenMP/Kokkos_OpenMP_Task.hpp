@@ -119,6 +119,13 @@ class TaskQueueSpecialization<SimpleTaskScheduler<Kokkos::OpenMP, QueueType> > {
     {
       Impl::HostThreadTeamData& self = *(instance->get_thread_data());
 
+      // Record where each team runs, with teams of one thread, before
+      // any team starts to steal
+      queue.set_team_locality(
+          queue.initial_team_scheduler_info(self.pool_rank()),
+          TaskQueueLocality::this_thread());
+#pragma omp barrier
+
       // Organizing threads into a team performs a barrier across the
       // entire pool to insure proper initialization of the team
       // rendezvous mechanism before a team rendezvous can be performed.
@@ -278,6 +285,12 @@ class TaskQueueSpecializationConstrained<
     {
       Impl::HostThreadTeamData& self = *(instance->get_thread_data());
 
+      // Record where each team runs, with teams of one thread, before
+      // any team starts to steal
+      queue.set_team_locality(self.pool_rank(),
+                              TaskQueueLocality::this_thread());
+#pragma omp barrier
+
       // Organizing threads into a team performs a barrier across the
       // entire pool to insure proper initialization of the team
       // rendezvous mechanism before a team rendezvous can be performed.
@@ -62,10 +62,7 @@ class TeamPolicyInternal<Kokkos::OpenMP, Properties...>
 
   using traits = PolicyTraits<Properties...>;
 
-  const typename traits::execution_space& space() const {
-    static typename traits::execution_space m_space;
-    return m_space;
-  }
+  const typename traits::execution_space& space() const { return m_space; }
 
   template <class ExecSpace, class... OtherProperties>
   friend class TeamPolicyInternal;
@@ -73,6 +70,7 @@ class TeamPolicyInternal<Kokkos::OpenMP, Properties...>
   template <class... OtherProperties>
   TeamPolicyInternal(
       const TeamPolicyInternal<Kokkos::OpenMP, OtherProperties...>& p) {
+    m_space                  = p.m_space;
     m_league_size            = p.m_league_size;
     m_team_size              = p.m_team_size;
     m_team_alloc             = p.m_team_alloc;
@@ -87,13 +85,13 @@ class TeamPolicyInternal<Kokkos::OpenMP, Properties...>
 
   template <class FunctorType>
   int team_size_max(const FunctorType&, const ParallelForTag&) const {
-    int pool_size          = traits::execution_space::impl_thread_pool_size(1);
+    int pool_size          = m_space.impl_instance_pool_size();
     int max_host_team_size = Impl::HostThreadTeamData::max_team_members;
     return pool_size < max_host_team_size ? pool_size : max_host_team_size;
   }
   template <class FunctorType>
   int team_size_max(const FunctorType&, const ParallelReduceTag&) const {
-    int pool_size          = traits::execution_space::impl_thread_pool_size(1);
+    int pool_size          = m_space.impl_instance_pool_size();
     int max_host_team_size = Impl::HostThreadTeamData::max_team_members;
     return pool_size < max_host_team_size ? pool_size : max_host_team_size;
   }
@@ -129,6 +127,8 @@ class TeamPolicyInternal<Kokkos::OpenMP, Properties...>
   //----------------------------------------
 
  private:
+  typename traits::execution_space m_space;
+
   int m_league_size;
   int m_team_size;
   int m_team_alloc;
@@ -140,7 +140,7 @@ class TeamPolicyInternal<Kokkos::OpenMP, Properties...>
   int m_chunk_size;
 
   inline void init(const int league_size_request, const int team_size_request) {
-    const int pool_size  = traits::execution_space::impl_thread_pool_size(0);
+    const int pool_size  = m_space.impl_instance_pool_size();
     const int team_grain = traits::execution_space::impl_thread_pool_size(2);
     const int max_host_team_size = Impl::HostThreadTeamData::max_team_members;
     const int team_max =
@@ -177,21 +177,23 @@ class TeamPolicyInternal<Kokkos::OpenMP, Properties...>
   }
 
   /** \brief  Specify league size, request team size */
-  TeamPolicyInternal(const typename traits::execution_space&,
+  TeamPolicyInternal(const typename traits::execution_space& space,
                      int league_size_request, int team_size_request,
                      int /* vector_length_request */ = 1)
-      : m_team_scratch_size{0, 0},
+      : m_space(space),
+        m_team_scratch_size{0, 0},
         m_thread_scratch_size{0, 0},
         m_chunk_size(0) {
     init(league_size_request, team_size_request);
   }
 
-  TeamPolicyInternal(const typename traits::execution_space&,
+  TeamPolicyInternal(const typename traits::execution_space& space,
                      int league_size_request,
                      const Kokkos::AUTO_t& /* team_size_request */
                      ,
                      int /* vector_length_request */ = 1)
-      : m_team_scratch_size{0, 0},
+      : m_space(space),
+        m_team_scratch_size{0, 0},
         m_thread_scratch_size{0, 0},
         m_chunk_size(0) {
     init(league_size_request,
@@ -258,8 +260,7 @@ class TeamPolicyInternal<Kokkos::OpenMP, Properties...>
  private:
   /** \brief finalize chunk_size if it was set to AUTO*/
   inline void set_auto_chunk_size() {
-    int concurrency =
-        traits::execution_space::impl_thread_pool_size(0) / m_team_alloc;
+    int concurrency = m_space.impl_instance_pool_size() / m_team_alloc;
     if (concurrency == 0) concurrency = 1;
 
     if (m_chunk_size > 0) {
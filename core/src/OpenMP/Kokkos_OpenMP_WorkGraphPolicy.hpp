@@ -46,6 +46,7 @@
 #define KOKKOS_OPENMP_WORKGRAPHPOLICY_HPP
 
 #include <Kokkos_OpenMP.hpp>
+#include <impl/Kokkos_HostWorkGraph.hpp>
 
 namespace Kokkos {
 namespace Impl {
@@ -74,18 +75,18 @@ class ParallelFor<FunctorType, Kokkos::WorkGraphPolicy<Traits...>,
 
  public:
   inline void execute() {
-#pragma omp parallel num_threads(OpenMP::impl_thread_pool_size())
-    {
-      // Spin until COMPLETED_TOKEN.
-      // END_TOKEN indicates no work is currently available.
+    const int pool_size = OpenMP::impl_thread_pool_size();
+
+    HostWorkGraphQueues queues(m_policy.work_count(), pool_size);
 
-      for (std::int32_t w = Policy::END_TOKEN;
-           Policy::COMPLETED_TOKEN != (w = m_policy.pop_work());) {
-        if (Policy::END_TOKEN != w) {
-          exec_one<typename Policy::work_tag>(w);
-          m_policy.completed_work(w);
-        }
-      }
+#pragma omp parallel num_threads(pool_size)
+    {
+      queues.run(
+          m_policy,
+          [this](const std::int32_t w) {
+            exec_one<typename Policy::work_tag>(w);
+          },
+          OpenMP::impl_thread_pool_rank());
     }
   }
 
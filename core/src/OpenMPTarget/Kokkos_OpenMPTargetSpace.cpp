@@ -137,10 +137,7 @@ SharedAllocationRecord<Kokkos::Experimental::OpenMPTargetSpace, void>::
 
   header.m_record = static_cast<SharedAllocationRecord<void, void> *>(this);
 
-  strncpy(header.m_label, arg_label.c_str(),
-          SharedAllocationHeader::maximum_label_length);
-  // Set last element zero, in case c_str is too long
-  header.m_label[SharedAllocationHeader::maximum_label_length - 1] = (char)0;
+  header.set_label(arg_label);
   // TODO DeepCopy
   // DeepCopy
   Kokkos::Impl::DeepCopy<Experimental::OpenMPTargetSpace, HostSpace>(
@@ -263,12 +263,12 @@ std::string SharedAllocationRecord<Kokkos::Experimental::ROCmSpace,
   Kokkos::Impl::DeepCopy<Kokkos::HostSpace, Kokkos::Experimental::ROCmSpace>(
       &header, RecordBase::head(), sizeof(SharedAllocationHeader));
 
-  return std::string(header.m_label);
+  return std::string(header.label());
 }
 
 std::string SharedAllocationRecord<Kokkos::Experimental::ROCmHostPinnedSpace,
                                    void>::get_label() const {
-  return std::string(RecordBase::head()->m_label);
+  return std::string(RecordBase::head()->label());
 }
 
 SharedAllocationRecord<Kokkos::Experimental::ROCmSpace, void>*
@@ -305,7 +305,7 @@ SharedAllocationRecord<Kokkos::Experimental::ROCmSpace,
     Kokkos::Profiling::deallocateData(
         Kokkos::Profiling::make_space_handle(
             Kokkos::Experimental::ROCmSpace::name()),
-        header.m_label, data(), size());
+        header.label(), data(), size());
   }
 
   m_space.deallocate(SharedAllocationRecord<void, void>::m_alloc_ptr,
@@ -318,7 +318,7 @@ SharedAllocationRecord<Kokkos::Experimental::ROCmHostPinnedSpace,
     Kokkos::Profiling::deallocateData(
         Kokkos::Profiling::make_space_handle(
             Kokkos::Experimental::ROCmHostPinnedSpace::name()),
-        RecordBase::m_alloc_ptr->m_label, data(), size());
+        RecordBase::m_alloc_ptr->label(), data(), size());
   }
 
   m_space.deallocate(SharedAllocationRecord<void, void>::m_alloc_ptr,
@@ -352,10 +352,7 @@ SharedAllocationRecord<Kokkos::Experimental::ROCmSpace, void>::
   // Fill in the Header information
   header.m_record = static_cast<SharedAllocationRecord<void, void>*>(this);
 
-  strncpy(header.m_label, arg_label.c_str(),
-          SharedAllocationHeader::maximum_label_length);
-  // Set last element zero, in case c_str is too long
-  header.m_label[SharedAllocationHeader::maximum_label_length - 1] = (char)0;
+  header.set_label(arg_label);
 
   // Copy to device memory
   Kokkos::Impl::DeepCopy<Kokkos::Experimental::ROCmSpace, HostSpace>(
@@ -387,11 +384,7 @@ SharedAllocationRecord<Kokkos::Experimental::ROCmHostPinnedSpace, void>::
 
   RecordBase::m_alloc_ptr->m_record = this;
 
-  strncpy(RecordBase::m_alloc_ptr->m_label, arg_label.c_str(),
-          SharedAllocationHeader::maximum_label_length);
-  // Set last element zero, in case c_str is too long
-  RecordBase::m_alloc_ptr
-      ->m_label[SharedAllocationHeader::maximum_label_length - 1] = (char)0;
+  RecordBase::m_alloc_ptr->set_label(arg_label);
 }
 
 //----------------------------------------------------------------------------
@@ -546,7 +539,7 @@ void SharedAllocationRecord<Kokkos::Experimental::ROCmSpace, void>::
         Kokkos::Impl::DeepCopy<HostSpace, Kokkos::Experimental::ROCmSpace>(
             &head, r->m_alloc_ptr, sizeof(SharedAllocationHeader));
       } else {
-        head.m_label[0] = 0;
+        head.set_label("");
       }
 
       // Formatting dependent on sizeof(uintptr_t)
@@ -567,7 +560,7 @@ void SharedAllocationRecord<Kokkos::Experimental::ROCmSpace, void>::
                reinterpret_cast<uintptr_t>(r->m_next),
                reinterpret_cast<uintptr_t>(r->m_alloc_ptr), r->m_alloc_size,
                r->m_count, reinterpret_cast<uintptr_t>(r->m_dealloc),
-               head.m_label);
+               head.label());
       std::cout << buffer;
       r = r->m_next;
     } while (r != &s_root_record);
@@ -588,7 +581,7 @@ void SharedAllocationRecord<Kokkos::Experimental::ROCmSpace, void>::
 
         snprintf(buffer, 256, format_string,
                  reinterpret_cast<uintptr_t>(r->data()), r->size(),
-                 head.m_label);
+                 head.label());
       } else {
         snprintf(buffer, 256, "ROCm [ 0 + 0 ]\n");
       }
@@ -76,6 +76,11 @@ unsigned s_current_shared_size = 0;
 
 void (*volatile s_current_function)(ThreadsExec &, const void *);
 const void *volatile s_current_function_arg = nullptr;
+bool s_dispatch_tree                          = true;
+
+// Set while a host thread owns the pool, 't_dispatcher' on that thread
+int volatile s_dispatch_lock = 0;
+KOKKOS_THREAD_LOCAL bool t_dispatcher = false;
 
 struct Sentinel {
   ~Sentinel() {
@@ -117,10 +122,14 @@ void ThreadsExec::driver(void) {
   ThreadsExec this_thread;
 
   while (ThreadsExec::Active == this_thread.m_pool_state) {
-    (*s_current_function)(this_thread, s_current_function_arg);
+    if (this_thread.m_dispatch_fan_out) this_thread.fan_out();
+
+    (*this_thread.m_dispatch_function)(this_thread,
+                                       this_thread.m_dispatch_arg);
 
     // Deactivate thread and wait for reactivation
     this_thread.m_pool_state = ThreadsExec::Inactive;
+    host_futex_wake(&this_thread.m_pool_state);
 
     wait_yield(this_thread.m_pool_state, ThreadsExec::Inactive);
   }
@@ -136,7 +145,10 @@ ThreadsExec::ThreadsExec()
       m_pool_rank(0),
       m_pool_size(0),
       m_pool_fan_size(0),
-      m_pool_state(ThreadsExec::Terminating) {
+      m_pool_state(ThreadsExec::Terminating),
+      m_dispatch_function(&execute_function_noop),
+      m_dispatch_arg(nullptr),
+      m_dispatch_fan_out(0) {
   if (&s_threads_process != this) {
     // A spawned thread
 
@@ -152,6 +164,10 @@ ThreadsExec::ThreadsExec()
     // Given a good entry set this thread in the 's_threads_exec' array
     if (entry < s_thread_pool_size[0] &&
         nil == atomic_compare_exchange(s_threads_exec + entry, nil, this)) {
+      // Place the thread by its pool rank if a bind policy is set.
+      Kokkos::hwloc::bind_pool_thread(s_thread_pool_size[0] - (entry + 1),
+                                      s_thread_pool_size[0]);
+
       const std::pair<unsigned, unsigned> coord =
           Kokkos::hwloc::get_this_thread_coordinate();
 
@@ -172,6 +188,7 @@ ThreadsExec::ThreadsExec()
       // Inform spawning process that the threads_exec entry could not be set.
       s_threads_process.m_pool_state = ThreadsExec::Terminating;
     }
+    host_futex_wake(&s_threads_process.m_pool_state);
   } else {
     // Enables 'parallel_for' to execute on unitialized Threads device
     m_pool_rank  = 0;
@@ -212,6 +229,7 @@ ThreadsExec::~ThreadsExec() {
     atomic_compare_exchange(s_threads_exec + entry, this, nil);
 
     s_threads_process.m_pool_state = ThreadsExec::Terminating;
+    host_futex_wake(&s_threads_process.m_pool_state);
   }
 }
 
@@ -240,6 +258,42 @@ ThreadsExec *ThreadsExec::get_thread(const int init_thread_rank) {
 
 //----------------------------------------------------------------------------
 
+void ThreadsExec::activate(void (*func)(ThreadsExec &, const void *),
+                           const void *arg, const bool fan_out) {
+  m_dispatch_function = func;
+  m_dispatch_arg      = arg;
+  m_dispatch_fan_out  = fan_out;
+
+  // Make sure the mailbox is written before activating the thread.
+  memory_fence();
+
+  m_pool_state = ThreadsExec::Active;
+  host_futex_wake(&m_pool_state);
+}
+
+void ThreadsExec::fan_out() const {
+  const int rev_rank = m_pool_size - (m_pool_rank + 1);
+
+  // Children are activated in the reverse order of 'fan_in' so that the
+  // largest subtree, which has the longest path to its leaves, starts first.
+  // Pool entries follow the hwloc thread mapping, so the nearest children
+  // are on the same core or NUMA region as this thread.
+  for (int i = m_pool_fan_size; 0 < i--;) {
+    m_pool_base[rev_rank + (1 << i)]->activate(m_dispatch_function,
+                                               m_dispatch_arg, true);
+  }
+}
+
+void ThreadsExec::set_dispatch_tree(const bool enable) {
+  verify_is_process("ThreadsExec::set_dispatch_tree", false);
+  fence();
+  s_dispatch_tree = enable;
+}
+
+bool ThreadsExec::dispatch_tree() { return s_dispatch_tree; }
+
+//----------------------------------------------------------------------------
+
 void ThreadsExec::execute_sleep(ThreadsExec &exec, const void *) {
   ThreadsExec::global_lock();
   ThreadsExec::global_unlock();
@@ -269,8 +323,8 @@ void ThreadsExec::verify_is_process(const std::string &name,
   if (!is_process()) {
     std::string msg(name);
     msg.append(
-        " FAILED : Called by a worker thread, can only be called by the master "
-        "process.");
+        " FAILED : Called by a worker thread, can only be called by a host "
+        "thread outside of the pool.");
     Kokkos::Impl::throw_runtime_exception(msg);
   }
 
@@ -284,17 +338,67 @@ void ThreadsExec::verify_is_process(const std::string &name,
 int ThreadsExec::in_parallel() {
   // A thread function is in execution and
   // the function argument is not the special threads process argument and
-  // the master process is a worker or is not the master process.
+  // the caller is a worker or the dispatcher executing as the root thread.
   return s_current_function && (&s_threads_process != s_current_function_arg) &&
-         (s_threads_process.m_pool_base || !is_process());
+         (!is_process() || (s_threads_process.m_pool_base && is_dispatcher()));
 }
 
-// Wait for root thread to become inactive
+bool ThreadsExec::is_dispatcher() { return t_dispatcher; }
+
+void ThreadsExec::acquire_dispatch() {
+  verify_is_process("ThreadsExec::acquire_dispatch", false);
+
+  if (is_dispatcher()) {
+    Kokkos::Impl::throw_runtime_exception(
+        std::string("ThreadsExec::acquire_dispatch() FAILED : already "
+                    "executing"));
+  }
+
+  // Wait for the current dispatcher to release the pool
+  while (0 != atomic_compare_exchange(&s_dispatch_lock, 0, 1)) {
+    wait_yield(s_dispatch_lock, 1);
+  }
+
+  t_dispatcher = true;
+
+  // The dispatcher executes as the root thread of the pool
+  if (s_threads_process.m_pool_base) {
+    s_threads_pid[s_threads_process.m_pool_rank] = pthread_self();
+  }
+
+  memory_fence();
+}
+
+void ThreadsExec::release_dispatch() {
+  t_dispatcher = false;
+
+  memory_fence();
+
+  s_dispatch_lock = 0;
+  host_futex_wake(&s_dispatch_lock);
+}
+
+// Wait for the kernels of all dispatchers to complete
 void ThreadsExec::fence() {
+  if (is_process() && !is_dispatcher()) {
+    // The pool may be owned by another dispatcher
+    DispatchGuard guard;
+    fence_pool();
+  } else {
+    fence_pool();
+  }
+}
+
+// Wait for root thread to become inactive
+void ThreadsExec::fence_pool() {
   if (s_thread_pool_size[0]) {
     // Wait for the root thread to complete:
-    Impl::spinwait_while_equal<int>(s_threads_exec[0]->m_pool_state,
-                                    ThreadsExec::Active);
+    if (host_wait_policy() == WaitPolicy::ACTIVE) {
+      Impl::spinwait_while_equal<int>(s_threads_exec[0]->m_pool_state,
+                                      ThreadsExec::Active);
+    } else {
+      wait_yield(s_threads_exec[0]->m_pool_state, ThreadsExec::Active);
+    }
   }
 
   s_current_function     = nullptr;
@@ -307,7 +411,7 @@ void ThreadsExec::fence() {
 
 /** \brief  Begin execution of the asynchronous functor */
 void ThreadsExec::start(void (*func)(ThreadsExec &, const void *),
-                        const void *arg) {
+                        const void *arg, const bool allow_tree) {
   verify_is_process("ThreadsExec::start", true);
 
   if (s_current_function || s_current_function_arg) {
@@ -321,13 +425,22 @@ void ThreadsExec::start(void (*func)(ThreadsExec &, const void *),
   // Make sure function and arguments are written before activating threads.
   memory_fence();
 
-  // Activate threads:
-  for (int i = s_thread_pool_size[0]; 0 < i--;) {
-    s_threads_exec[i]->m_pool_state = ThreadsExec::Active;
+  const bool tree = s_dispatch_tree && allow_tree;
+
+  if (tree) {
+    // Activate the root thread which activates the rest of the pool
+    // through the fan-out tree:
+    s_threads_exec[0]->activate(func, arg, true);
+  } else {
+    // Activate threads:
+    for (int i = s_thread_pool_size[0]; 0 < i--;) {
+      s_threads_exec[i]->activate(func, arg, false);
+    }
   }
 
   if (s_threads_process.m_pool_size) {
     // Master process is the root thread, run it:
+    if (tree) s_threads_process.fan_out();
     (*func)(s_threads_process, arg);
     s_threads_process.m_pool_state = ThreadsExec::Inactive;
   }
@@ -348,7 +461,7 @@ bool ThreadsExec::sleep() {
 
   // Activate threads:
   for (unsigned i = s_thread_pool_size[0]; 0 < i;) {
-    s_threads_exec[--i]->m_pool_state = ThreadsExec::Active;
+    s_threads_exec[--i]->activate(&execute_sleep, nullptr, false);
   }
 
   return true;
@@ -385,7 +498,7 @@ void ThreadsExec::execute_serial(void (*func)(ThreadsExec &, const void *)) {
   for (unsigned i = s_thread_pool_size[0]; begin < i;) {
     ThreadsExec &th = *s_threads_exec[--i];
 
-    th.m_pool_state = ThreadsExec::Active;
+    th.activate(func, &s_threads_process, false);
 
     wait_yield(th.m_pool_state, ThreadsExec::Active);
   }
@@ -568,6 +681,8 @@ void ThreadsExec::initialize(unsigned thread_count, unsigned use_numa_count,
     const bool hwloc_avail = Kokkos::hwloc::available();
     const bool hwloc_can_bind =
         hwloc_avail && Kokkos::hwloc::can_bind_threads();
+    const bool bind_by_rank =
+        Kokkos::hwloc::BindPolicy::NONE != Kokkos::hwloc::get_bind_policy();
 
     if (thread_count == 0) {
       thread_count = hwloc_avail
@@ -600,9 +715,10 @@ void ThreadsExec::initialize(unsigned thread_count, unsigned use_numa_count,
 
       // If hwloc available then spawned thread will
       // choose its own entry in 's_threads_coord'
-      // otherwise specify the entry.
-      s_current_function_arg =
-          (void *)static_cast<uintptr_t>(hwloc_can_bind ? ~0u : ith);
+      // otherwise specify the entry.  A bind policy places
+      // threads by entry, i.e., by pool rank.
+      s_current_function_arg = (void *)static_cast<uintptr_t>(
+          hwloc_can_bind && !bind_by_rank ? ~0u : ith);
 
       // Make sure all outstanding memory writes are complete
       // before spawning the new thread.
@@ -638,8 +754,10 @@ void ThreadsExec::initialize(unsigned thread_count, unsigned use_numa_count,
 
     if (!thread_spawn_failed) {
       // Bind process to the core on which it was located before spawning
-      // occurred
-      if (hwloc_can_bind) {
+      // occurred, or by its pool rank if a bind policy is set.
+      if (!(thread_spawn_begin &&
+            Kokkos::hwloc::bind_pool_thread(thread_count - 1, thread_count)) &&
+          hwloc_can_bind) {
         Kokkos::hwloc::bind_this_thread(proc_coord);
       }
 
@@ -724,6 +842,7 @@ void ThreadsExec::finalize() {
   for (unsigned i = s_thread_pool_size[0]; begin < i--;) {
     if (s_threads_exec[i]) {
       s_threads_exec[i]->m_pool_state = ThreadsExec::Terminating;
+      host_futex_wake(&s_threads_exec[i]->m_pool_state);
 
       wait_yield(s_threads_process.m_pool_state, ThreadsExec::Inactive);
 
@@ -740,6 +859,8 @@ void ThreadsExec::finalize() {
 
   if (Kokkos::hwloc::can_bind_threads()) {
     Kokkos::hwloc::unbind_this_thread();
+  } else {
+    Kokkos::hwloc::unbind_pool_thread();
   }
 
   s_thread_pool_size[0] = 0;
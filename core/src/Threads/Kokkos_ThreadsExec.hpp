@@ -53,6 +53,7 @@
 #include <utility>
 #include <impl/Kokkos_Spinwait.hpp>
 #include <impl/Kokkos_FunctorAdapter.hpp>
+#include <impl/Kokkos_HostRangeStealing.hpp>
 
 #include <Kokkos_Atomic.hpp>
 
@@ -109,6 +110,14 @@ class ThreadsExec {
   int m_pool_fan_size;
   int volatile m_pool_state;  ///< State for global synchronizations
 
+  // Dispatch mailbox, written by the activating thread before it sets
+  // 'm_pool_state' to Active.  When 'm_dispatch_fan_out' is set the thread
+  // forwards the dispatch to its children in the fan-in tree before
+  // executing the function itself.
+  void (*volatile m_dispatch_function)(ThreadsExec &, const void *);
+  const void *volatile m_dispatch_arg;
+  int volatile m_dispatch_fan_out;
+
   // Members for dynamic scheduling
   // Which thread am I stealing from currently
   int m_current_steal_target;
@@ -120,6 +129,11 @@ class ThreadsExec {
   // Is this thread stealing (i.e. its owned work_range is exhausted
   bool m_stealing;
 
+#ifdef KOKKOS_ENABLE_TASKDAG
+  // Work stealing deque for dynamically scheduled range policies
+  HostRangeStealing m_range_stealing;
+#endif
+
   static void global_lock();
   static void global_unlock();
   static bool spawn();
@@ -132,6 +146,13 @@ class ThreadsExec {
 
   static void execute_serial(void (*)(ThreadsExec &, const void *));
 
+  static bool is_dispatcher();
+  static void fence_pool();
+
+  void activate(void (*)(ThreadsExec &, const void *), const void *,
+                const bool fan_out);
+  void fan_out() const;
+
  public:
   KOKKOS_INLINE_FUNCTION int pool_size() const { return m_pool_size; }
   KOKKOS_INLINE_FUNCTION int pool_rank() const { return m_pool_rank; }
@@ -182,6 +203,12 @@ class ThreadsExec {
 
   static void wait_yield(volatile int &, const int);
 
+  /** \brief  Dispatch kernels through the fan-out tree (default)
+   *          or by activating every thread from the master.
+   */
+  static void set_dispatch_tree(const bool);
+  static bool dispatch_tree();
+
   //------------------------------------
   // All-thread functions:
 
@@ -469,8 +496,33 @@ class ThreadsExec {
   /** \brief  Wait for previous asynchronous functor to
    *          complete and release the Threads device.
    *          Acquire the Threads device and start this functor.
+   *
+   *  Unless 'allow_tree' is false the threads are activated through the
+   *  fan-out tree, in which case a thread may only wait on its fan-in
+   *  tree descendants before they are known to be active.
+   */
+  static void start(void (*)(ThreadsExec &, const void *), const void *,
+                    const bool allow_tree = true);
+
+  /** \brief  Exclusive use of the thread pool by the calling host thread.
+   *
+   *  Any host thread other than the workers of the pool may dispatch
+   *  kernels.  A dispatcher owns the pool from the resize of the scratch
+   *  memory until it has read the results of its kernel; concurrent
+   *  dispatchers wait for the pool in between.  The dispatcher executes
+   *  as the root thread of the pool when the process is part of it.
    */
-  static void start(void (*)(ThreadsExec &, const void *), const void *);
+  class DispatchGuard {
+   public:
+    DispatchGuard() { ThreadsExec::acquire_dispatch(); }
+    ~DispatchGuard() { ThreadsExec::release_dispatch(); }
+
+    DispatchGuard(const DispatchGuard &) = delete;
+    DispatchGuard &operator=(const DispatchGuard &) = delete;
+  };
+
+  static void acquire_dispatch();
+  static void release_dispatch();
 
   static int in_parallel();
   static void fence();
@@ -486,6 +538,43 @@ class ThreadsExec {
         end > 0 ? (end + chunk_size - 1) / chunk_size : m_work_range.first;
   }
 
+  // Initialize the work range for this thread's work stealing deque
+  // from its static partition [ begin .. end ) of [ 0 .. length )
+  inline void set_work_stealing_range(const long &begin, const long &end,
+                                      const long &length,
+                                      const long &chunk_size) {
+    set_work_range(begin, end, chunk_size);
+#ifdef KOKKOS_ENABLE_TASKDAG
+    m_range_stealing.reset(m_work_range.first, m_work_range.second,
+                           (length + chunk_size - 1) / chunk_size,
+                           m_pool_rank_rev);
+#else
+    (void)length;
+    reset_steal_target();
+#endif
+  }
+
+  // Claim a range of chunk indices [ first .. second ), stealing half of
+  // the remaining work of a random thread once this thread's deque is empty.
+  // Returns (-1,-1) when all work has been claimed.
+  inline Kokkos::pair<long, long> get_work_stealing_range() {
+#ifdef KOKKOS_ENABLE_TASKDAG
+    ThreadsExec *const *const pool = m_pool_base;
+
+    const std::pair<int64_t, int64_t> range = m_range_stealing.next(
+        [pool](int r) -> HostRangeStealing & {
+          return pool[r]->m_range_stealing;
+        },
+        m_pool_rank_rev, m_pool_size);
+
+    return Kokkos::pair<long, long>(range.first, range.second);
+#else
+    const long work_index = get_work_index();
+    return Kokkos::pair<long, long>(work_index,
+                                    work_index == -1 ? -1 : work_index + 1);
+#endif
+  }
+
   // Claim and index from this thread's range from the beginning
   inline long get_work_index_begin() {
     Kokkos::pair<long, long> work_range_new = m_work_range;
@@ -69,12 +69,16 @@ namespace {
 
 pthread_mutex_t host_internal_pthread_mutex = PTHREAD_MUTEX_INITIALIZER;
 
+// Set on the worker threads spawned for the pool
+KOKKOS_THREAD_LOCAL bool t_pool_worker = false;
+
 // Pthreads compatible driver.
 // Recovery from an exception would require constant intra-thread health
 // verification; which would negatively impact runtime.  As such simply
 // abort the process.
 
 void* internal_pthread_driver(void*) {
+  t_pool_worker = true;
   try {
     ThreadsExec::driver();
   } catch (const std::exception& x) {
@@ -115,11 +119,7 @@ bool ThreadsExec::spawn() {
 
 //----------------------------------------------------------------------------
 
-bool ThreadsExec::is_process() {
-  static const pthread_t master_pid = pthread_self();
-
-  return pthread_equal(master_pid, pthread_self());
-}
+bool ThreadsExec::is_process() { return !t_pool_worker; }
 
 void ThreadsExec::global_lock() {
   pthread_mutex_lock(&host_internal_pthread_mutex);
@@ -132,8 +132,27 @@ void ThreadsExec::global_unlock() {
 //----------------------------------------------------------------------------
 
 void ThreadsExec::wait_yield(volatile int& flag, const int value) {
+  const WaitPolicy policy = host_wait_policy();
+
+  if (policy == WaitPolicy::ACTIVE) {
+    while (value == flag) {
+      sched_yield();
+    }
+    return;
+  }
+
+  // The hybrid policy spins briefly so that back to back kernels are
+  // picked up without a system call, then sleeps until woken.
+  static constexpr uint32_t spin_limit = 1 << 10;
+
+  uint32_t i = policy == WaitPolicy::HYBRID ? 0 : spin_limit;
+
   while (value == flag) {
-    sched_yield();
+    if (i < spin_limit) {
+      host_thread_yield(++i, WaitMode::ACTIVE);
+    } else {
+      host_futex_wait(&flag, value);
+    }
   }
 }
 
@@ -0,0 +1,85 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_THREADS_HOSTGRAPH_HPP
+#define KOKKOS_THREADS_HOSTGRAPH_HPP
+
+#include <Kokkos_Core_fwd.hpp>
+#include <Kokkos_Threads.hpp>
+
+namespace Kokkos {
+namespace Impl {
+
+template <>
+class HostGraphExec<Kokkos::Threads> {
+ private:
+  using Graph = Kokkos::Experimental::HostGraph<Kokkos::Threads>;
+  using Self  = HostGraphExec<Kokkos::Threads>;
+
+  const Graph* m_graph;
+
+  static void thread_main(ThreadsExec& exec, const void* arg) {
+    const Self& self = *(static_cast<const Self*>(arg));
+    self.m_graph->impl_execute(exec.pool_rank(), exec.pool_size());
+    exec.fan_in();
+  }
+
+ public:
+  enum : bool { single_region = true };
+
+  inline void execute() const {
+    ThreadsExec::DispatchGuard guard;
+    m_graph->impl_reset();
+    ThreadsExec::start(&Self::thread_main, this);
+    ThreadsExec::fence();
+  }
+
+  HostGraphExec(const Graph& arg_graph, const Kokkos::Threads&)
+      : m_graph(&arg_graph) {}
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif /* #define KOKKOS_THREADS_HOSTGRAPH_HPP */
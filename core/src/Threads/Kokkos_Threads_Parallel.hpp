@@ -130,24 +130,25 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>,
 
     WorkRange range(self.m_policy, exec.pool_rank(), exec.pool_size());
 
-    exec.set_work_range(range.begin() - self.m_policy.begin(),
-                        range.end() - self.m_policy.begin(),
-                        self.m_policy.chunk_size());
-    exec.reset_steal_target();
+    exec.set_work_stealing_range(range.begin() - self.m_policy.begin(),
+                                 range.end() - self.m_policy.begin(),
+                                 self.m_policy.end() - self.m_policy.begin(),
+                                 self.m_policy.chunk_size());
     exec.barrier();
 
-    long work_index = exec.get_work_index();
+    Kokkos::pair<long, long> work = exec.get_work_stealing_range();
 
-    while (work_index != -1) {
+    while (work.first != -1) {
       const Member begin =
-          static_cast<Member>(work_index) * self.m_policy.chunk_size() +
+          static_cast<Member>(work.first) * self.m_policy.chunk_size() +
+          self.m_policy.begin();
+      const Member end_chunk =
+          static_cast<Member>(work.second) * self.m_policy.chunk_size() +
           self.m_policy.begin();
       const Member end =
-          begin + self.m_policy.chunk_size() < self.m_policy.end()
-              ? begin + self.m_policy.chunk_size()
-              : self.m_policy.end();
+          end_chunk < self.m_policy.end() ? end_chunk : self.m_policy.end();
       ParallelFor::template exec_range<WorkTag>(self.m_functor, begin, end);
-      work_index = exec.get_work_index();
+      work = exec.get_work_stealing_range();
     }
 
     exec.fan_in();
@@ -155,6 +156,7 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>,
 
  public:
   inline void execute() const {
+    ThreadsExec::DispatchGuard guard;
     ThreadsExec::start(&ParallelFor::exec, this);
     ThreadsExec::fence();
   }
@@ -222,22 +224,23 @@ class ParallelFor<FunctorType, Kokkos::MDRangePolicy<Traits...>,
 
     WorkRange range(self.m_policy, exec.pool_rank(), exec.pool_size());
 
-    exec.set_work_range(range.begin(), range.end(), self.m_policy.chunk_size());
-    exec.reset_steal_target();
+    exec.set_work_stealing_range(range.begin(), range.end(),
+                                 self.m_policy.end(),
+                                 self.m_policy.chunk_size());
     exec.barrier();
 
-    long work_index = exec.get_work_index();
+    Kokkos::pair<long, long> work = exec.get_work_stealing_range();
 
-    while (work_index != -1) {
+    while (work.first != -1) {
       const Member begin =
-          static_cast<Member>(work_index) * self.m_policy.chunk_size();
+          static_cast<Member>(work.first) * self.m_policy.chunk_size();
+      const Member end_chunk =
+          static_cast<Member>(work.second) * self.m_policy.chunk_size();
       const Member end =
-          begin + self.m_policy.chunk_size() < self.m_policy.end()
-              ? begin + self.m_policy.chunk_size()
-              : self.m_policy.end();
+          end_chunk < self.m_policy.end() ? end_chunk : self.m_policy.end();
 
       ParallelFor::exec_range(self.m_mdr_policy, self.m_functor, begin, end);
-      work_index = exec.get_work_index();
+      work = exec.get_work_stealing_range();
     }
 
     exec.fan_in();
@@ -245,6 +248,7 @@ class ParallelFor<FunctorType, Kokkos::MDRangePolicy<Traits...>,
 
  public:
   inline void execute() const {
+    ThreadsExec::DispatchGuard guard;
     ThreadsExec::start(&ParallelFor::exec, this);
     ThreadsExec::fence();
   }
@@ -325,10 +329,16 @@ class ParallelFor<FunctorType, Kokkos::TeamPolicy<Properties...>,
 
  public:
   inline void execute() const {
+    ThreadsExec::DispatchGuard guard;
     ThreadsExec::resize_scratch(
         0, Policy::member_type::team_reduce_size() + m_shared);
 
-    ThreadsExec::start(&ParallelFor::exec, this);
+    // Team fan-in trees are subtrees of the dispatch tree only when
+    // teams are allocated on power of two boundaries.
+    const int team_alloc = m_policy.team_alloc();
+
+    ThreadsExec::start(&ParallelFor::exec, this,
+                       0 == (team_alloc & (team_alloc - 1)));
 
     ThreadsExec::fence();
   }
@@ -432,27 +442,28 @@ class ParallelReduce<FunctorType, Kokkos::RangePolicy<Traits...>, ReducerType,
     const ParallelReduce &self = *((const ParallelReduce *)arg);
     const WorkRange range(self.m_policy, exec.pool_rank(), exec.pool_size());
 
-    exec.set_work_range(range.begin() - self.m_policy.begin(),
-                        range.end() - self.m_policy.begin(),
-                        self.m_policy.chunk_size());
-    exec.reset_steal_target();
+    exec.set_work_stealing_range(range.begin() - self.m_policy.begin(),
+                                 range.end() - self.m_policy.begin(),
+                                 self.m_policy.end() - self.m_policy.begin(),
+                                 self.m_policy.chunk_size());
     exec.barrier();
 
-    long work_index       = exec.get_work_index();
-    reference_type update = ValueInit::init(
+    Kokkos::pair<long, long> work = exec.get_work_stealing_range();
+    reference_type update         = ValueInit::init(
         ReducerConditional::select(self.m_functor, self.m_reducer),
         exec.reduce_memory());
-    while (work_index != -1) {
+    while (work.first != -1) {
       const Member begin =
-          static_cast<Member>(work_index) * self.m_policy.chunk_size() +
+          static_cast<Member>(work.first) * self.m_policy.chunk_size() +
+          self.m_policy.begin();
+      const Member end_chunk =
+          static_cast<Member>(work.second) * self.m_policy.chunk_size() +
           self.m_policy.begin();
       const Member end =
-          begin + self.m_policy.chunk_size() < self.m_policy.end()
-              ? begin + self.m_policy.chunk_size()
-              : self.m_policy.end();
+          end_chunk < self.m_policy.end() ? end_chunk : self.m_policy.end();
       ParallelReduce::template exec_range<WorkTag>(self.m_functor, begin, end,
                                                    update);
-      work_index = exec.get_work_index();
+      work = exec.get_work_stealing_range();
     }
 
     exec.template fan_in_reduce<ReducerTypeFwd, WorkTagFwd>(
@@ -461,6 +472,7 @@ class ParallelReduce<FunctorType, Kokkos::RangePolicy<Traits...>, ReducerType,
 
  public:
   inline void execute() const {
+    ThreadsExec::DispatchGuard guard;
     ThreadsExec::resize_scratch(
         ValueTraits::value_size(
             ReducerConditional::select(m_functor, m_reducer)),
@@ -593,24 +605,25 @@ class ParallelReduce<FunctorType, Kokkos::MDRangePolicy<Traits...>, ReducerType,
     const ParallelReduce &self = *((const ParallelReduce *)arg);
     const WorkRange range(self.m_policy, exec.pool_rank(), exec.pool_size());
 
-    exec.set_work_range(range.begin(), range.end(), self.m_policy.chunk_size());
-    exec.reset_steal_target();
+    exec.set_work_stealing_range(range.begin(), range.end(),
+                                 self.m_policy.end(),
+                                 self.m_policy.chunk_size());
     exec.barrier();
 
-    long work_index       = exec.get_work_index();
-    reference_type update = ValueInit::init(
+    Kokkos::pair<long, long> work = exec.get_work_stealing_range();
+    reference_type update         = ValueInit::init(
         ReducerConditional::select(self.m_functor, self.m_reducer),
         exec.reduce_memory());
-    while (work_index != -1) {
+    while (work.first != -1) {
       const Member begin =
-          static_cast<Member>(work_index) * self.m_policy.chunk_size();
+          static_cast<Member>(work.first) * self.m_policy.chunk_size();
+      const Member end_chunk =
+          static_cast<Member>(work.second) * self.m_policy.chunk_size();
       const Member end =
-          begin + self.m_policy.chunk_size() < self.m_policy.end()
-              ? begin + self.m_policy.chunk_size()
-              : self.m_policy.end();
+          end_chunk < self.m_policy.end() ? end_chunk : self.m_policy.end();
       ParallelReduce::exec_range(self.m_mdr_policy, self.m_functor, begin, end,
                                  update);
-      work_index = exec.get_work_index();
+      work = exec.get_work_stealing_range();
     }
 
     exec.template fan_in_reduce<ReducerTypeFwd, WorkTagFwd>(
@@ -619,6 +632,7 @@ class ParallelReduce<FunctorType, Kokkos::MDRangePolicy<Traits...>, ReducerType,
 
  public:
   inline void execute() const {
+    ThreadsExec::DispatchGuard guard;
     ThreadsExec::resize_scratch(
         ValueTraits::value_size(
             ReducerConditional::select(m_functor, m_reducer)),
@@ -743,12 +757,18 @@ class ParallelReduce<FunctorType, Kokkos::TeamPolicy<Properties...>,
 
  public:
   inline void execute() const {
+    ThreadsExec::DispatchGuard guard;
     ThreadsExec::resize_scratch(
         ValueTraits::value_size(
             ReducerConditional::select(m_functor, m_reducer)),
         Policy::member_type::team_reduce_size() + m_shared);
 
-    ThreadsExec::start(&ParallelReduce::exec, this);
+    // Team fan-in trees are subtrees of the dispatch tree only when
+    // teams are allocated on power of two boundaries.
+    const int team_alloc = m_policy.team_alloc();
+
+    ThreadsExec::start(&ParallelReduce::exec, this,
+                       0 == (team_alloc & (team_alloc - 1)));
 
     ThreadsExec::fence();
 
@@ -867,6 +887,7 @@ class ParallelScan<FunctorType, Kokkos::RangePolicy<Traits...>,
 
  public:
   inline void execute() const {
+    ThreadsExec::DispatchGuard guard;
     ThreadsExec::resize_scratch(2 * ValueTraits::value_size(m_functor), 0);
     ThreadsExec::start(&ParallelScan::exec, this);
     ThreadsExec::fence();
@@ -949,6 +970,7 @@ class ParallelScanWithTotal<FunctorType, Kokkos::RangePolicy<Traits...>,
 
  public:
   inline void execute() const {
+    ThreadsExec::DispatchGuard guard;
     ThreadsExec::resize_scratch(2 * ValueTraits::value_size(m_functor), 0);
     ThreadsExec::start(&ParallelScanWithTotal::exec, this);
     ThreadsExec::fence();
@@ -961,6 +983,151 @@ class ParallelScanWithTotal<FunctorType, Kokkos::RangePolicy<Traits...>,
         m_returnvalue(arg_returnvalue) {}
 };
 
+// MDRangePolicy impl
+template <class FunctorType, class... Traits>
+class ParallelScan<FunctorType, Kokkos::MDRangePolicy<Traits...>,
+                   Kokkos::Threads> {
+ private:
+  using MDRangePolicy = Kokkos::MDRangePolicy<Traits...>;
+  using Policy        = typename MDRangePolicy::impl_range_policy;
+  using WorkRange     = typename Policy::WorkRange;
+  using WorkTag       = typename MDRangePolicy::work_tag;
+  using Member        = typename Policy::member_type;
+  using ValueTraits = Kokkos::Impl::FunctorValueTraits<FunctorType, WorkTag>;
+  using ValueInit   = Kokkos::Impl::FunctorValueInit<FunctorType, WorkTag>;
+
+  using pointer_type   = typename ValueTraits::pointer_type;
+  using reference_type = typename ValueTraits::reference_type;
+
+  using iterate_type =
+      typename Kokkos::Impl::HostIterateTileScan<MDRangePolicy, FunctorType,
+                                                 WorkTag, reference_type>;
+
+  const FunctorType m_functor;
+  const MDRangePolicy m_mdr_policy;
+  const Policy m_policy;  // construct as RangePolicy( 0, num_tiles
+                          // ).set_chunk_size(1) in ctor
+
+  inline static void exec_range(const MDRangePolicy &mdr_policy,
+                                const FunctorType &functor, const Member &ibeg,
+                                const Member &iend, reference_type update,
+                                const bool final) {
+    for (Member i = ibeg; i < iend; ++i) {
+      iterate_type(mdr_policy, functor, update, final)(i);
+    }
+  }
+
+  static void exec(ThreadsExec &exec, const void *arg) {
+    const ParallelScan &self = *((const ParallelScan *)arg);
+
+    // Contiguous ranges of tiles in the order of the policy
+    const WorkRange range(self.m_policy, exec.pool_rank(), exec.pool_size());
+
+    reference_type update =
+        ValueInit::init(self.m_functor, exec.reduce_memory());
+
+    ParallelScan::exec_range(self.m_mdr_policy, self.m_functor, range.begin(),
+                             range.end(), update, false);
+
+    exec.template scan_small<FunctorType, WorkTag>(self.m_functor);
+
+    ParallelScan::exec_range(self.m_mdr_policy, self.m_functor, range.begin(),
+                             range.end(), update, true);
+
+    exec.fan_in();
+  }
+
+ public:
+  inline void execute() const {
+    ThreadsExec::DispatchGuard guard;
+    ThreadsExec::resize_scratch(2 * ValueTraits::value_size(m_functor), 0);
+    ThreadsExec::start(&ParallelScan::exec, this);
+    ThreadsExec::fence();
+  }
+
+  ParallelScan(const FunctorType &arg_functor, const MDRangePolicy &arg_policy)
+      : m_functor(arg_functor),
+        m_mdr_policy(arg_policy),
+        m_policy(Policy(0, m_mdr_policy.m_num_tiles).set_chunk_size(1)) {}
+};
+
+template <class FunctorType, class ReturnType, class... Traits>
+class ParallelScanWithTotal<FunctorType, Kokkos::MDRangePolicy<Traits...>,
+                            ReturnType, Kokkos::Threads> {
+ private:
+  using MDRangePolicy = Kokkos::MDRangePolicy<Traits...>;
+  using Policy        = typename MDRangePolicy::impl_range_policy;
+  using WorkRange     = typename Policy::WorkRange;
+  using WorkTag       = typename MDRangePolicy::work_tag;
+  using Member        = typename Policy::member_type;
+  using ValueTraits = Kokkos::Impl::FunctorValueTraits<FunctorType, WorkTag>;
+  using ValueInit   = Kokkos::Impl::FunctorValueInit<FunctorType, WorkTag>;
+
+  using pointer_type   = typename ValueTraits::pointer_type;
+  using reference_type = typename ValueTraits::reference_type;
+
+  using iterate_type =
+      typename Kokkos::Impl::HostIterateTileScan<MDRangePolicy, FunctorType,
+                                                 WorkTag, reference_type>;
+
+  const FunctorType m_functor;
+  const MDRangePolicy m_mdr_policy;
+  const Policy m_policy;  // construct as RangePolicy( 0, num_tiles
+                          // ).set_chunk_size(1) in ctor
+  ReturnType &m_returnvalue;
+
+  inline static void exec_range(const MDRangePolicy &mdr_policy,
+                                const FunctorType &functor, const Member &ibeg,
+                                const Member &iend, reference_type update,
+                                const bool final) {
+    for (Member i = ibeg; i < iend; ++i) {
+      iterate_type(mdr_policy, functor, update, final)(i);
+    }
+  }
+
+  static void exec(ThreadsExec &exec, const void *arg) {
+    const ParallelScanWithTotal &self = *((const ParallelScanWithTotal *)arg);
+
+    // Contiguous ranges of tiles in the order of the policy
+    const WorkRange range(self.m_policy, exec.pool_rank(), exec.pool_size());
+
+    reference_type update =
+        ValueInit::init(self.m_functor, exec.reduce_memory());
+
+    ParallelScanWithTotal::exec_range(self.m_mdr_policy, self.m_functor,
+                                      range.begin(), range.end(), update,
+                                      false);
+
+    exec.template scan_small<FunctorType, WorkTag>(self.m_functor);
+
+    ParallelScanWithTotal::exec_range(self.m_mdr_policy, self.m_functor,
+                                      range.begin(), range.end(), update,
+                                      true);
+
+    exec.fan_in();
+
+    if (exec.pool_rank() == exec.pool_size() - 1) {
+      self.m_returnvalue = update;
+    }
+  }
+
+ public:
+  inline void execute() const {
+    ThreadsExec::DispatchGuard guard;
+    ThreadsExec::resize_scratch(2 * ValueTraits::value_size(m_functor), 0);
+    ThreadsExec::start(&ParallelScanWithTotal::exec, this);
+    ThreadsExec::fence();
+  }
+
+  ParallelScanWithTotal(const FunctorType &arg_functor,
+                        const MDRangePolicy &arg_policy,
+                        ReturnType &arg_returnvalue)
+      : m_functor(arg_functor),
+        m_mdr_policy(arg_policy),
+        m_policy(Policy(0, m_mdr_policy.m_num_tiles).set_chunk_size(1)),
+        m_returnvalue(arg_returnvalue) {}
+};
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -47,6 +47,7 @@
 
 #include <Kokkos_Core_fwd.hpp>
 #include <Kokkos_Threads.hpp>
+#include <impl/Kokkos_HostWorkGraph.hpp>
 
 namespace Kokkos {
 namespace Impl {
@@ -62,6 +63,7 @@ class ParallelFor<FunctorType, Kokkos::WorkGraphPolicy<Traits...>,
 
   Policy m_policy;
   FunctorType m_functor;
+  HostWorkGraphQueues* m_queues;
 
   template <class TagType>
   typename std::enable_if<std::is_same<TagType, void>::value>::type exec_one(
@@ -76,33 +78,34 @@ class ParallelFor<FunctorType, Kokkos::WorkGraphPolicy<Traits...>,
     m_functor(t, w);
   }
 
-  inline void exec_one_thread() const noexcept {
-    // Spin until COMPLETED_TOKEN.
-    // END_TOKEN indicates no work is currently available.
-
-    for (std::int32_t w = Policy::END_TOKEN;
-         Policy::COMPLETED_TOKEN != (w = m_policy.pop_work());) {
-      if (Policy::END_TOKEN != w) {
-        exec_one<typename Policy::work_tag>(w);
-        m_policy.completed_work(w);
-      }
-    }
+  inline void exec_one_thread(const int rank) const noexcept {
+    m_queues->run(
+        m_policy,
+        [this](const std::int32_t w) {
+          exec_one<typename Policy::work_tag>(w);
+        },
+        rank);
   }
 
   static inline void thread_main(ThreadsExec& exec, const void* arg) noexcept {
     const Self& self = *(static_cast<const Self*>(arg));
-    self.exec_one_thread();
+    self.exec_one_thread(exec.pool_rank());
     exec.fan_in();
   }
 
  public:
   inline void execute() {
+    ThreadsExec::DispatchGuard guard;
+    HostWorkGraphQueues queues(m_policy.work_count(),
+                               Threads::impl_thread_pool_size());
+    m_queues = &queues;
     ThreadsExec::start(&Self::thread_main, this);
     ThreadsExec::fence();
+    m_queues = nullptr;
   }
 
   inline ParallelFor(const FunctorType& arg_functor, const Policy& arg_policy)
-      : m_policy(arg_policy), m_functor(arg_functor) {}
+      : m_policy(arg_policy), m_functor(arg_functor), m_queues(nullptr) {}
 };
 
 }  // namespace Impl
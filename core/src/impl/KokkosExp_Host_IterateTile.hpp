@@ -57,6 +57,20 @@
 #define KOKKOS_ENABLE_IVDEP_MDRANGE
 #endif
 
+// Annotation for the unit-stride inner tile loop; 'omp simd' is only
+// understood when compiling with OpenMP 4.0 or later.
+#if defined(KOKKOS_MDRANGE_IVDEP) && defined(_OPENMP) && (_OPENMP >= 201307)
+#define KOKKOS_ENABLE_SIMD_MDRANGE _Pragma("omp simd")
+#else
+#define KOKKOS_ENABLE_SIMD_MDRANGE KOKKOS_ENABLE_IVDEP_MDRANGE
+#endif
+
+// Width of the fixed-length blocks the unit-stride inner tile loop is split
+// into; the remainder of the inner tile extent is peeled into a scalar loop.
+#ifndef KOKKOS_MDRANGE_VECTOR_LENGTH
+#define KOKKOS_MDRANGE_VECTOR_LENGTH 8
+#endif
+
 #include <algorithm>
 
 namespace Kokkos {
@@ -1518,6 +1532,121 @@ struct Tile_Loop_Type<
 };
 // end Structs for calling loops
 
+// Unit-stride loops over a full tile
+//
+// MDRange points are always unit-stride, and the inner iteration direction is
+// the one contiguous in memory for views of the matching layout. For full
+// tiles the inner extent is the tile size, so the inner loop is emitted as a
+// counted loop over fixed-length blocks with loop-invariant bounds, followed
+// by a peeled remainder. The outer dimensions are walked by recursion on the
+// number of indices collected so far.
+template <typename Tagged>
+struct Tile_Unit_Stride_Invoke {
+  template <typename Func, typename... Args>
+  static inline void call(Func const& func, Args const&... args) {
+    func(Tagged(), args...);
+  }
+};
+
+template <>
+struct Tile_Unit_Stride_Invoke<void> {
+  template <typename Func, typename... Args>
+  static inline void call(Func const& func, Args const&... args) {
+    func(args...);
+  }
+};
+
+template <int Rank, bool IsLeft, typename IType, typename Tagged>
+struct Tile_Loop_Unit_Stride {
+  using invoke_type = Tile_Unit_Stride_Invoke<Tagged>;
+
+  enum { vector_length = KOKKOS_MDRANGE_VECTOR_LENGTH };
+
+  template <typename Func, typename Offset, typename Extent>
+  static inline void apply(Func const& func, Offset const& offset,
+                           Extent const& extent) {
+    loop(func, offset, extent);
+  }
+
+ private:
+  // LayoutLeft: the inner index goes first, outer indices are prepended
+  template <typename Func, typename... Idx>
+  static inline void invoke(std::true_type, Func const& func, IType i,
+                            Idx const&... idx) {
+    invoke_type::call(func, i, idx...);
+  }
+
+  // LayoutRight: the inner index goes last, outer indices are appended
+  template <typename Func, typename... Idx>
+  static inline void invoke(std::false_type, Func const& func, IType i,
+                            Idx const&... idx) {
+    invoke_type::call(func, idx..., i);
+  }
+
+  template <typename Func, typename Offset, typename Extent, typename... Idx>
+  static inline void descend(std::true_type, Func const& func,
+                             Offset const& offset, Extent const& extent,
+                             IType i, Idx const&... idx) {
+    loop(func, offset, extent, i, idx...);
+  }
+
+  template <typename Func, typename Offset, typename Extent, typename... Idx>
+  static inline void descend(std::false_type, Func const& func,
+                             Offset const& offset, Extent const& extent,
+                             IType i, Idx const&... idx) {
+    loop(func, offset, extent, idx..., i);
+  }
+
+  // Outer dimensions
+  template <typename Func, typename Offset, typename Extent, typename... Idx>
+  static inline typename std::enable_if<(sizeof...(Idx) + 1 < Rank)>::type
+  loop(Func const& func, Offset const& offset, Extent const& extent,
+       Idx const&... idx) {
+    enum { d = IsLeft ? Rank - 1 - int(sizeof...(Idx)) : int(sizeof...(Idx)) };
+    const IType begin = static_cast<IType>(offset[d]);
+    const IType end   = begin + static_cast<IType>(extent[d]);
+    for (IType i = begin; i < end; ++i) {
+      descend(std::integral_constant<bool, IsLeft>(), func, offset, extent, i,
+              idx...);
+    }
+  }
+
+  // Inner dimension
+  template <typename Func, typename Offset, typename Extent, typename... Idx>
+  static inline typename std::enable_if<(sizeof...(Idx) + 1 == Rank)>::type
+  loop(Func const& func, Offset const& offset, Extent const& extent,
+       Idx const&... idx) {
+    enum { d = IsLeft ? 0 : Rank - 1 };
+    const IType begin = static_cast<IType>(offset[d]);
+    const IType count = static_cast<IType>(extent[d]);
+    const IType count_vec =
+        count - count % static_cast<IType>(vector_length);
+
+    IType i = 0;
+    for (; i < count_vec; i += vector_length) {
+      const IType base = begin + i;
+      KOKKOS_ENABLE_SIMD_MDRANGE
+      for (IType v = 0; v < static_cast<IType>(vector_length); ++v) {
+        invoke(std::integral_constant<bool, IsLeft>(), func, base + v, idx...);
+      }
+    }
+    // Peeled remainder
+    for (; i < count; ++i) {
+      invoke(std::integral_constant<bool, IsLeft>(), func, begin + i, idx...);
+    }
+  }
+};
+
+// Functors whose calls depend on the order points are visited in (the scan
+// closure) declare 'ordered_tile_iteration' and keep the generic loops.
+template <typename Functor, typename Enable = void>
+struct tile_iteration_is_ordered : std::false_type {};
+
+template <typename Functor>
+struct tile_iteration_is_ordered<
+    Functor, typename std::enable_if<Functor::ordered_tile_iteration>::type>
+    : std::true_type {};
+
 template <typename T>
 using is_void_type = std::is_same<T, void>;
 
@@ -1600,9 +1729,15 @@ struct HostIterateTile<
     // partial tile dims
     const bool full_tile = check_iteration_bounds(m_tiledims, m_offset);
 
-    Tile_Loop_Type<RP::rank, (RP::inner_direction == RP::Left), index_type,
-                   Tag>::apply(m_func, full_tile, m_offset, m_rp.m_tile,
-                               m_tiledims);
+    if (full_tile && !tile_iteration_is_ordered<Functor>::value) {
+      Tile_Loop_Unit_Stride<RP::rank, (RP::inner_direction == RP::Left),
+                            index_type, Tag>::apply(m_func, m_offset,
+                                                    m_rp.m_tile);
+    } else {
+      Tile_Loop_Type<RP::rank, (RP::inner_direction == RP::Left), index_type,
+                     Tag>::apply(m_func, full_tile, m_offset, m_rp.m_tile,
+                                 m_tiledims);
+    }
   }
 
 #else
@@ -2789,9 +2924,45 @@ struct HostIterateTile<
       m_tag;
 };
 
+// For ParallelScan
+// The points of a tile are visited by the ParallelFor loops above, in the
+// inner iteration order, passing the scan value and final pass flag.
+// ReferenceType is 'value_type &' for scalar and 'value_type *' for array
+// scans.
+template <typename RP, typename Functor, typename Tag, typename ReferenceType>
+struct HostIterateTileScan {
+  struct ScanFunctor {
+    enum : bool { ordered_tile_iteration = true };
+
+    Functor const& m_func;
+    ReferenceType m_update;
+    const bool m_final;
+
+    template <typename... Args>
+    inline void operator()(Args const&... args) const {
+      m_func(args..., m_update, m_final);
+    }
+  };
+
+  using iterate_type = HostIterateTile<RP, ScanFunctor, Tag, void>;
+
+  inline HostIterateTileScan(RP const& rp, Functor const& func,
+                             ReferenceType update, const bool final)
+      : m_rp(rp), m_scan{func, update, final} {}
+
+  template <typename IType>
+  inline void operator()(IType tile_idx) const {
+    iterate_type(m_rp, m_scan)(tile_idx);
+  }
+
+  RP const& m_rp;
+  const ScanFunctor m_scan;
+};
+
 // ------------------------------------------------------------------ //
 
 #undef KOKKOS_ENABLE_NEW_LOOP_MACROS
+#undef KOKKOS_ENABLE_SIMD_MDRANGE
 
 }  // namespace Impl
 }  // namespace Kokkos
@@ -0,0 +1,204 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <Kokkos_Macros.hpp>
+#include <impl/KokkosExp_MDRangeTiling.hpp>
+#include <impl/Kokkos_CPUDiscovery.hpp>
+#include <impl/Kokkos_Profiling.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <mutex>
+
+namespace Kokkos {
+namespace Impl {
+
+namespace {
+
+// Assume that a kernel streams a few double precision values per point
+constexpr size_t mdrange_bytes_per_point = 4 * sizeof(double);
+
+// Keep the innermost tile a multiple of a cache line of doubles
+constexpr long mdrange_inner_align = 8;
+
+}  // namespace
+
+void mdrange_host_tile(const int rank, const bool inner_right,
+                       const long span[], long tile[], const int concurrency) {
+  const size_t l1 = host_cache_size(1) ? host_cache_size(1) : 32 << 10;
+  const size_t l2 = host_cache_size(2) ? host_cache_size(2) : 256 << 10;
+
+  const long inner_max =
+      std::max(long(l1 / mdrange_bytes_per_point), mdrange_inner_align);
+
+  // Points per tile, less the dimensions with a given tile size
+  double volume = double(std::max(long(l2 / mdrange_bytes_per_point),
+                                  inner_max));
+  int auto_count = 0;
+  for (int i = 0; i < rank; ++i) {
+    if (0 < tile[i]) {
+      volume /= tile[i];
+    } else {
+      ++auto_count;
+    }
+  }
+  if (!auto_count) return;
+
+  // Dimensions from the innermost to the outermost
+  const int begin = inner_right ? rank - 1 : 0;
+  const int step  = inner_right ? -1 : 1;
+  const int inner = begin;
+
+  if (tile[inner] <= 0) {
+    const long extent = std::max(span[inner], 1L);
+    // Split into equal pieces of at most 'inner_max' points
+    const long pieces = (extent + inner_max - 1) / inner_max;
+    long t            = (extent + pieces - 1) / pieces;
+    if (1 < pieces) {
+      t = std::min(extent, (t + mdrange_inner_align - 1) /
+                               mdrange_inner_align * mdrange_inner_align);
+    }
+    tile[inner] = t;
+    volume /= t;
+    --auto_count;
+  }
+
+  // Share the remaining volume evenly among the outer dimensions
+  for (int i = begin + step; 0 <= i && i < rank; i += step) {
+    if (0 < tile[i]) continue;
+    const long extent = std::max(span[i], 1L);
+    const long t =
+        std::max(1L, std::min(extent, long(std::pow(std::max(volume, 1.0),
+                                                     1.0 / auto_count))));
+    tile[i] = t;
+    volume /= t;
+    --auto_count;
+  }
+
+  // Halve the largest outer tile until each thread has two tiles
+  const long min_tiles = 2 * std::max(concurrency, 1);
+  for (;;) {
+    long num_tiles = 1;
+    int largest    = -1;
+    for (int i = 0; i < rank; ++i) {
+      num_tiles *= (std::max(span[i], 1L) + tile[i] - 1) / tile[i];
+      if (i != inner && 1 < tile[i] &&
+          (largest < 0 || tile[largest] < tile[i])) {
+        largest = i;
+      }
+    }
+    if (min_tiles <= num_tiles || largest < 0) break;
+    tile[largest] = (tile[largest] + 1) / 2;
+  }
+}
+
+//----------------------------------------------------------------------------
+
+namespace {
+
+struct MDRangeTileVariables {
+  size_t id[6];
+  long tile[6];
+};
+
+std::mutex s_mdrange_tuning_mutex;
+std::map<std::string, MDRangeTileVariables> s_mdrange_tile_variables;
+
+}  // namespace
+
+size_t mdrange_begin_tuning(const std::string& label, const int rank,
+                            const long span[], long tile[]) {
+  namespace Tuning = Kokkos::Tools::Experimental;
+
+  if (!Tuning::have_tuning_tool()) return 0;
+
+  std::lock_guard<std::mutex> lock(s_mdrange_tuning_mutex);
+
+  const std::string name = label + ".mdrange_tile_" + std::to_string(rank);
+
+  auto variables = s_mdrange_tile_variables.find(name);
+
+  if (variables == s_mdrange_tile_variables.end()) {
+    MDRangeTileVariables declared;
+    for (int i = 0; i < rank; ++i) {
+      Tuning::VariableInfo info;
+      info.type          = Tuning::ValueType::kokkos_value_int64;
+      info.category      = Tuning::StatisticalCategory::kokkos_value_ordinal;
+      info.valueQuantity = Tuning::CandidateValueType::kokkos_value_range;
+      info.candidates    = Tuning::make_candidate_range(
+          int64_t(1), int64_t(std::max(span[i], 1L)), int64_t(1), false,
+          false);
+      declared.id[i] =
+          Tuning::declare_output_type(name + "_" + std::to_string(i), info);
+      declared.tile[i] = tile[i];
+    }
+    variables = s_mdrange_tile_variables.emplace(name, declared).first;
+  }
+
+  Tuning::VariableValue values[6];
+  for (int i = 0; i < rank; ++i) {
+    values[i] = Tuning::make_variable_value(variables->second.id[i],
+                                            int64_t(variables->second.tile[i]));
+  }
+
+  const size_t context = Tuning::get_new_context_id();
+  Tuning::begin_context(context);
+  Tuning::request_output_values(context, rank, values);
+
+  for (int i = 0; i < rank; ++i) {
+    tile[i] = std::max(1L, std::min(std::max(span[i], 1L),
+                                    long(values[i].value.int_value)));
+    variables->second.tile[i] = tile[i];
+  }
+
+  return context;
+}
+
+void mdrange_end_tuning(const size_t context) {
+  if (context) Kokkos::Tools::Experimental::end_context(context);
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
@@ -0,0 +1,82 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_EXP_MDRANGETILING_HPP
+#define KOKKOS_EXP_MDRANGETILING_HPP
+
+#include <Kokkos_Macros.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace Kokkos {
+namespace Impl {
+
+/** \brief  Choose host tile sizes for the dimensions with tile[i] <= 0.
+ *
+ *  The innermost, unit stride, dimension gets its whole extent as long as
+ *  that fits in the L1 data cache, the other dimensions share the L2 cache
+ *  evenly.  Outer tiles are then halved until every thread has at least
+ *  two tiles to work on.
+ */
+void mdrange_host_tile(const int rank, const bool inner_right,
+                       const long span[], long tile[], const int concurrency);
+
+/** \brief  Ask a tuning tool for the tile sizes of kernel 'label',
+ *          starting from 'tile'.
+ *
+ *  The tuning variables of each kernel label are declared once and the
+ *  last choice for a label is offered as the starting point of its next
+ *  request.  Returns the tuning context to be closed by
+ *  'mdrange_end_tuning' after the kernel, 0 if there is no tuning tool.
+ */
+size_t mdrange_begin_tuning(const std::string& label, const int rank,
+                            const long span[], long tile[]);
+
+void mdrange_end_tuning(const size_t context);
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif  // KOKKOS_EXP_MDRANGETILING_HPP
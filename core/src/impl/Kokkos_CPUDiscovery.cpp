@@ -55,6 +55,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <cerrno>
+#include <fstream>
 #include <string>
 
 namespace Kokkos {
@@ -116,5 +117,53 @@ int mpi_local_rank_on_node() {
   return local_rank;
 }
 
+namespace {
+
+// Cache size as reported by Linux sysfs, 0 if not available.
+size_t sysfs_cache_size(const int level) {
+  const std::string cache("/sys/devices/system/cpu/cpu0/cache/index");
+
+  for (int index = 0; index < 16; ++index) {
+    std::ifstream level_file(cache + std::to_string(index) + "/level");
+    std::ifstream type_file(cache + std::to_string(index) + "/type");
+    std::ifstream size_file(cache + std::to_string(index) + "/size");
+    int index_level = 0;
+    std::string type;
+    size_t size = 0;
+    char unit   = 0;
+    if (!(level_file >> index_level) || !(type_file >> type)) break;
+    if (index_level != level || type == "Instruction") continue;
+    if (!(size_file >> size)) return 0;
+    if (size_file >> unit) {
+      if (unit == 'K') size <<= 10;
+      if (unit == 'M') size <<= 20;
+    }
+    return size;
+  }
+  return 0;
+}
+
+size_t query_cache_size(const int level) {
+  long size = 0;
+#if defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE) && \
+    defined(_SC_LEVEL3_CACHE_SIZE)
+  switch (level) {
+    case 1: size = sysconf(_SC_LEVEL1_DCACHE_SIZE); break;
+    case 2: size = sysconf(_SC_LEVEL2_CACHE_SIZE); break;
+    case 3: size = sysconf(_SC_LEVEL3_CACHE_SIZE); break;
+    default: break;
+  }
+#endif
+  return 0 < size ? size_t(size) : sysfs_cache_size(level);
+}
+
+}  // namespace
+
+size_t host_cache_size(const int level) {
+  static const size_t size[3] = {query_cache_size(1), query_cache_size(2),
+                                 query_cache_size(3)};
+  return 1 <= level && level <= 3 ? size[level - 1] : 0;
+}
+
 }  // namespace Impl
 }  // namespace Kokkos
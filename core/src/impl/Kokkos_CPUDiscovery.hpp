@@ -41,6 +41,8 @@
 // ************************************************************************
 //@HEADER
 */
+#include <cstddef>
+
 namespace Kokkos {
 namespace Impl {
 
@@ -48,5 +50,10 @@ int processors_per_node();
 int mpi_ranks_per_node();
 int mpi_local_rank_on_node();
 
+/** \brief  Size in bytes of the data or unified cache of the given level
+ *          (1, 2 or 3) seen by the first processor, 0 if unknown.
+ */
+size_t host_cache_size(const int level);
+
 }  // namespace Impl
 }  // namespace Kokkos
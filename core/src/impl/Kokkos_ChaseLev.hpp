@@ -236,6 +236,25 @@ struct ChaseLevDeque {
     return true;
   }
 
+  /// Push `n_nodes` nodes at once, so that `nodes[0]` is popped last.  Either
+  /// all of the nodes are pushed with a single release store of the bottom
+  /// index or, if they do not all fit, none of them are.
+  template <class NodePtr>
+  KOKKOS_INLINE_FUNCTION bool push_n(NodePtr const nodes[], size_type n_nodes) {
+    auto b  = m_bottom;  // memory order relaxed
+    auto t  = Impl::atomic_load(&m_top, memory_order_acquire);
+    auto& a = m_array;
+    if (b - t > a.size() - n_nodes) {
+      /* not enough room for all of them */
+      return false;
+    }
+    for (size_type i = 0; i < n_nodes; ++i) {
+      a[b + i] = static_cast<node_type*>(nodes[i]);  // relaxed
+    }
+    Impl::atomic_store(&m_bottom, b + n_nodes, memory_order_release);
+    return true;
+  }
+
   KOKKOS_INLINE_FUNCTION
   OptionalRef<T> steal() {
     auto t = m_top;  // TODO @tasking @memory_order DSH: atomic load acquire
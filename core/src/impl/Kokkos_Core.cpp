@@ -44,6 +44,8 @@
 
 #include <Kokkos_Core.hpp>
 #include <impl/Kokkos_Error.hpp>
+#include <impl/Kokkos_Spinwait.hpp>
+#include <impl/Kokkos_HostSpaceCache.hpp>
 #include <cctype>
 #include <cstring>
 #include <iostream>
@@ -361,6 +363,40 @@ void initialize_profiling(const InitArguments&) {
 
 void pre_initialize_internal(const InitArguments& args) {
   if (args.disable_warnings) g_show_warnings = false;
+
+  if (args.wait_policy.empty() || args.wait_policy == "active") {
+    set_host_wait_policy(WaitPolicy::ACTIVE);
+  } else if (args.wait_policy == "hybrid") {
+    set_host_wait_policy(WaitPolicy::HYBRID);
+  } else if (args.wait_policy == "passive") {
+    set_host_wait_policy(WaitPolicy::PASSIVE);
+  } else {
+    Impl::throw_runtime_exception(
+        "Error: unknown wait policy '" + args.wait_policy +
+        "', expecting one of 'active', 'hybrid' or 'passive'. Raised by "
+        "Kokkos::initialize(int narg, char* argc[]).");
+  }
+
+  set_host_first_touch(args.first_touch);
+  set_host_huge_pages(args.huge_pages);
+  set_host_huge_page_threshold(args.huge_page_threshold);
+  if (args.host_cache_size) set_host_cache_capacity(args.host_cache_size);
+  set_memory_usage_print(args.memory_usage);
+
+  if (args.bind_policy.empty() || args.bind_policy == "none") {
+    Kokkos::hwloc::set_bind_policy(Kokkos::hwloc::BindPolicy::NONE);
+  } else if (args.bind_policy == "compact") {
+    Kokkos::hwloc::set_bind_policy(Kokkos::hwloc::BindPolicy::COMPACT);
+  } else if (args.bind_policy == "scatter") {
+    Kokkos::hwloc::set_bind_policy(Kokkos::hwloc::BindPolicy::SCATTER);
+  } else if (args.bind_policy == "numa") {
+    Kokkos::hwloc::set_bind_policy(Kokkos::hwloc::BindPolicy::NUMA);
+  } else {
+    Impl::throw_runtime_exception(
+        "Error: unknown bind policy '" + args.bind_policy +
+        "', expecting one of 'compact', 'scatter', 'numa' or 'none'. Raised "
+        "by Kokkos::initialize(int narg, char* argc[]).");
+  }
 }
 
 void post_initialize_internal(const InitArguments& args) {
@@ -402,6 +438,10 @@ void finalize_internal(const bool all_spaces = false) {
     ++numSuccessfulCalls;
   }
 
+  if (memory_usage_print()) {
+    Kokkos::Experimental::print_memory_usage(std::cout);
+  }
+
   Kokkos::Profiling::finalize();
 
 #if defined(KOKKOS_ENABLE_CUDA)
@@ -474,6 +514,13 @@ void finalize_internal(const bool all_spaces = false) {
 
   g_is_initialized = false;
   g_show_warnings  = true;
+  set_host_wait_policy(WaitPolicy::ACTIVE);
+  set_host_first_touch(false);
+  set_host_huge_pages(false);
+  set_host_huge_page_threshold(0);
+  host_cache_finalize();
+  set_memory_usage_print(false);
+  Kokkos::hwloc::set_bind_policy(Kokkos::hwloc::BindPolicy::NONE);
 }
 
 void fence_internal() {
@@ -504,6 +551,10 @@ void fence_internal() {
 #if defined(KOKKOS_ENABLE_SERIAL)
   Kokkos::Serial::impl_static_fence();
 #endif
+
+#if defined(KOKKOS_ENABLE_MMAPSPACE)
+  Kokkos::Experimental::MmapSpace::impl_sync_all();
+#endif
 }
 
 bool check_arg(char const* arg, char const* expected) {
@@ -541,6 +592,39 @@ bool check_int_arg(char const* arg, char const* expected, int* value) {
   return true;
 }
 
+bool check_str_arg(char const* arg, char const* expected, std::string& value) {
+  if (!check_arg(arg, expected)) return false;
+  std::size_t arg_len = std::strlen(arg);
+  std::size_t exp_len = std::strlen(expected);
+  if (arg_len == exp_len || arg[exp_len] != '=' || arg_len == exp_len + 1) {
+    std::ostringstream ss;
+    ss << "Error: expecting an '=STRING' after command line argument '"
+       << expected << "'";
+    ss << ". Raised by Kokkos::initialize(int narg, char* argc[]).";
+    Impl::throw_runtime_exception(ss.str());
+  }
+  value = arg + exp_len + 1;
+  return true;
+}
+
+bool check_size_arg(char const* arg, char const* expected,
+                    std::size_t& value) {
+  if (!check_arg(arg, expected)) return false;
+  std::size_t arg_len = std::strlen(arg);
+  std::size_t exp_len = std::strlen(expected);
+  char const* number  = arg + exp_len + 1;
+  if (arg_len == exp_len || arg[exp_len] != '=' ||
+      !Impl::is_unsigned_int(number) || strlen(number) == 0) {
+    std::ostringstream ss;
+    ss << "Error: expecting an '=INT' after command line argument '" << expected
+       << "'";
+    ss << ". Raised by Kokkos::initialize(int narg, char* argc[]).";
+    Impl::throw_runtime_exception(ss.str());
+  }
+  value = std::stoull(number);
+  return true;
+}
+
 void warn_deprecated_command_line_argument(std::string deprecated,
                                            std::string valid) {
   std::cerr
@@ -566,6 +650,13 @@ void parse_command_line_arguments(int& narg, char* arg[],
   auto& ndevices         = arguments.ndevices;
   auto& skip_device      = arguments.skip_device;
   auto& disable_warnings = arguments.disable_warnings;
+  auto& wait_policy      = arguments.wait_policy;
+  auto& first_touch      = arguments.first_touch;
+  auto& bind_policy      = arguments.bind_policy;
+  auto& huge_pages       = arguments.huge_pages;
+  auto& huge_threshold   = arguments.huge_page_threshold;
+  auto& host_cache_size  = arguments.host_cache_size;
+  auto& memory_usage     = arguments.memory_usage;
 
   bool kokkos_threads_found  = false;
   bool kokkos_numa_found     = false;
@@ -680,6 +771,46 @@ void parse_command_line_arguments(int& narg, char* arg[],
         arg[k] = arg[k + 1];
       }
       narg--;
+    } else if (check_str_arg(arg[iarg], "--kokkos-wait-policy", wait_policy)) {
+      for (int k = iarg; k < narg - 1; k++) {
+        arg[k] = arg[k + 1];
+      }
+      narg--;
+    } else if (check_arg(arg[iarg], "--kokkos-first-touch")) {
+      first_touch = true;
+      for (int k = iarg; k < narg - 1; k++) {
+        arg[k] = arg[k + 1];
+      }
+      narg--;
+    } else if (check_str_arg(arg[iarg], "--kokkos-bind", bind_policy)) {
+      for (int k = iarg; k < narg - 1; k++) {
+        arg[k] = arg[k + 1];
+      }
+      narg--;
+    } else if (check_arg(arg[iarg], "--kokkos-huge-pages")) {
+      huge_pages = true;
+      for (int k = iarg; k < narg - 1; k++) {
+        arg[k] = arg[k + 1];
+      }
+      narg--;
+    } else if (check_size_arg(arg[iarg], "--kokkos-huge-page-threshold",
+                              huge_threshold)) {
+      for (int k = iarg; k < narg - 1; k++) {
+        arg[k] = arg[k + 1];
+      }
+      narg--;
+    } else if (check_size_arg(arg[iarg], "--kokkos-host-cache",
+                              host_cache_size)) {
+      for (int k = iarg; k < narg - 1; k++) {
+        arg[k] = arg[k + 1];
+      }
+      narg--;
+    } else if (check_arg(arg[iarg], "--kokkos-memory-usage")) {
+      memory_usage = true;
+      for (int k = iarg; k < narg - 1; k++) {
+        arg[k] = arg[k + 1];
+      }
+      narg--;
     } else if (check_arg(arg[iarg], "--kokkos-help") ||
                check_arg(arg[iarg], "--help")) {
       auto const help_message = R"(
@@ -707,6 +838,32 @@ void parse_command_line_arguments(int& narg, char* arg[],
                                        to be ignored. This is most useful on workstations
                                        with multiple GPUs of which one is used to drive
                                        screen output.
+      --kokkos-wait-policy=STRING    : how idle host threads wait for work:
+                                       'active' spins (default), 'hybrid' spins
+                                       briefly and then sleeps, 'passive' sleeps
+                                       immediately. Sleeping threads are woken
+                                       when a kernel is dispatched.
+      --kokkos-first-touch           : touch the pages of uninitialized HostSpace
+                                       View allocations in parallel so that they
+                                       are placed near the threads using them.
+      --kokkos-bind=STRING           : bind host threads by their pool rank:
+                                       'compact' fills the hyperthreads of a
+                                       core first, 'scatter' spreads threads
+                                       evenly over the cores, 'numa' binds
+                                       blocks of threads to NUMA regions,
+                                       'none' keeps the process binding
+                                       (default).
+      --kokkos-huge-pages            : advise HostSpace allocations of at least
+                                       the huge page threshold to use
+                                       transparent huge pages.
+      --kokkos-huge-page-threshold=INT : smallest HostSpace allocation in
+                                       bytes advised to use transparent huge
+                                       pages (default 2 MiB).
+      --kokkos-host-cache=INT        : keep up to INT bytes of freed HostSpace
+                                       allocations for reuse by later
+                                       allocations of the same size class.
+      --kokkos-memory-usage          : print the live and peak bytes of every
+                                       memory space in Kokkos::finalize.
       --------------------------------------------------------------------------------
 )";
       std::cout << help_message << std::endl;
@@ -732,6 +889,13 @@ void parse_environment_variables(InitArguments& arguments) {
   auto& ndevices         = arguments.ndevices;
   auto& skip_device      = arguments.skip_device;
   auto& disable_warnings = arguments.disable_warnings;
+  auto& wait_policy      = arguments.wait_policy;
+  auto& first_touch      = arguments.first_touch;
+  auto& bind_policy      = arguments.bind_policy;
+  auto& huge_pages       = arguments.huge_pages;
+  auto& huge_threshold   = arguments.huge_page_threshold;
+  auto& host_cache_size  = arguments.host_cache_size;
+  auto& memory_usage     = arguments.memory_usage;
 
   char* endptr;
   auto env_num_threads_str = std::getenv("KOKKOS_NUM_THREADS");
@@ -872,6 +1036,20 @@ void parse_environment_variables(InitArguments& arguments) {
       }
     }
   }
+  char* env_wait_policy_str = std::getenv("KOKKOS_WAIT_POLICY");
+  if (env_wait_policy_str != nullptr) {
+    std::string env_str(env_wait_policy_str);
+    for (char& c : env_str) {
+      c = tolower(c);
+    }
+    if (!wait_policy.empty() && (env_str != wait_policy))
+      Impl::throw_runtime_exception(
+          "Error: expecting a match between --kokkos-wait-policy and "
+          "KOKKOS_WAIT_POLICY if both are set. Raised by "
+          "Kokkos::initialize(int narg, char* argc[]).");
+    else
+      wait_policy = env_str;
+  }
   char* env_disablewarnings_str = std::getenv("KOKKOS_DISABLE_WARNINGS");
   if (env_disablewarnings_str != nullptr) {
     std::string env_str(env_disablewarnings_str);  // deep-copies string
@@ -886,6 +1064,105 @@ void parse_environment_variables(InitArguments& arguments) {
           "KOKKOS_DISABLE_WARNINGS if both are set. Raised by "
           "Kokkos::initialize(int narg, char* argc[]).");
   }
+  char* env_first_touch_str = std::getenv("KOKKOS_FIRST_TOUCH");
+  if (env_first_touch_str != nullptr) {
+    std::string env_str(env_first_touch_str);
+    for (char& c : env_str) {
+      c = toupper(c);
+    }
+    if ((env_str == "TRUE") || (env_str == "ON") || (env_str == "1"))
+      first_touch = true;
+    else if (first_touch)
+      Impl::throw_runtime_exception(
+          "Error: expecting a match between --kokkos-first-touch and "
+          "KOKKOS_FIRST_TOUCH if both are set. Raised by "
+          "Kokkos::initialize(int narg, char* argc[]).");
+  }
+  char* env_bind_str = std::getenv("KOKKOS_BIND");
+  if (env_bind_str != nullptr) {
+    std::string env_str(env_bind_str);
+    for (char& c : env_str) {
+      c = tolower(c);
+    }
+    if (!bind_policy.empty() && (env_str != bind_policy))
+      Impl::throw_runtime_exception(
+          "Error: expecting a match between --kokkos-bind and KOKKOS_BIND if "
+          "both are set. Raised by Kokkos::initialize(int narg, char* "
+          "argc[]).");
+    else
+      bind_policy = env_str;
+  }
+  char* env_huge_pages_str = std::getenv("KOKKOS_HUGE_PAGES");
+  if (env_huge_pages_str != nullptr) {
+    std::string env_str(env_huge_pages_str);
+    for (char& c : env_str) {
+      c = toupper(c);
+    }
+    if ((env_str == "TRUE") || (env_str == "ON") || (env_str == "1"))
+      huge_pages = true;
+    else if (huge_pages)
+      Impl::throw_runtime_exception(
+          "Error: expecting a match between --kokkos-huge-pages and "
+          "KOKKOS_HUGE_PAGES if both are set. Raised by "
+          "Kokkos::initialize(int narg, char* argc[]).");
+  }
+  auto env_huge_threshold_str = std::getenv("KOKKOS_HUGE_PAGE_THRESHOLD");
+  if (env_huge_threshold_str != nullptr) {
+    errno = 0;
+    auto env_huge_threshold =
+        std::strtoull(env_huge_threshold_str, &endptr, 10);
+    if (endptr == env_huge_threshold_str ||
+        !Impl::is_unsigned_int(env_huge_threshold_str))
+      Impl::throw_runtime_exception(
+          "Error: cannot convert KOKKOS_HUGE_PAGE_THRESHOLD to an unsigned "
+          "integer. Raised by Kokkos::initialize(int narg, char* argc[]).");
+    if (errno == ERANGE)
+      Impl::throw_runtime_exception(
+          "Error: KOKKOS_HUGE_PAGE_THRESHOLD out of range of representable "
+          "values. Raised by Kokkos::initialize(int narg, char* argc[]).");
+    if ((huge_threshold != 0) && (env_huge_threshold != huge_threshold))
+      Impl::throw_runtime_exception(
+          "Error: expecting a match between --kokkos-huge-page-threshold and "
+          "KOKKOS_HUGE_PAGE_THRESHOLD if both are set. Raised by "
+          "Kokkos::initialize(int narg, char* argc[]).");
+    else
+      huge_threshold = env_huge_threshold;
+  }
+  auto env_host_cache_str = std::getenv("KOKKOS_HOST_CACHE");
+  if (env_host_cache_str != nullptr) {
+    errno               = 0;
+    auto env_host_cache = std::strtoull(env_host_cache_str, &endptr, 10);
+    if (endptr == env_host_cache_str ||
+        !Impl::is_unsigned_int(env_host_cache_str))
+      Impl::throw_runtime_exception(
+          "Error: cannot convert KOKKOS_HOST_CACHE to an unsigned integer. "
+          "Raised by Kokkos::initialize(int narg, char* argc[]).");
+    if (errno == ERANGE)
+      Impl::throw_runtime_exception(
+          "Error: KOKKOS_HOST_CACHE out of range of representable values. "
+          "Raised by Kokkos::initialize(int narg, char* argc[]).");
+    if ((host_cache_size != 0) && (env_host_cache != host_cache_size))
+      Impl::throw_runtime_exception(
+          "Error: expecting a match between --kokkos-host-cache and "
+          "KOKKOS_HOST_CACHE if both are set. Raised by "
+          "Kokkos::initialize(int narg, char* argc[]).");
+    else
+      host_cache_size = env_host_cache;
+  }
+  char* env_memory_usage_str = std::getenv("KOKKOS_MEMORY_USAGE");
+  if (env_memory_usage_str != nullptr) {
+    std::string env_str(env_memory_usage_str);
+    for (char& c : env_str) {
+      c = toupper(c);
+    }
+    if ((env_str == "TRUE") || (env_str == "ON") || (env_str == "1"))
+      memory_usage = true;
+    else if (memory_usage)
+      Impl::throw_runtime_exception(
+          "Error: expecting a match between --kokkos-memory-usage and "
+          "KOKKOS_MEMORY_USAGE if both are set. Raised by "
+          "Kokkos::initialize(int narg, char* argc[]).");
+  }
 }
 
 }  // namespace
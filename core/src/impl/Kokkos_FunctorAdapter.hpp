@@ -1321,6 +1321,125 @@ struct FunctorValueTraits<FunctorType, ArgTag,
       tag_type, void (FunctorType::*)(const tag_type&, const ArgMember&, T&,
                                       const bool&) const) {}
   //----------------------------------------
+  // multi-dimensional parallel_scan operator without a tag:
+
+  template <class ArgMember, class T>
+  KOKKOS_INLINE_FUNCTION static T deduce_reduce_type(
+      VOIDTAG, void (FunctorType::*)(ArgMember, ArgMember, T&, bool) const) {}
+
+  template <class ArgMember, class T>
+  KOKKOS_INLINE_FUNCTION static T deduce_reduce_type(
+      VOIDTAG, void (FunctorType::*)(ArgMember, ArgMember, ArgMember, T&, bool)
+                   const) {}
+
+  template <class ArgMember, class T>
+  KOKKOS_INLINE_FUNCTION static T deduce_reduce_type(
+      VOIDTAG, void (FunctorType::*)(ArgMember, ArgMember, ArgMember, ArgMember,
+                                     T&, bool) const) {}
+
+  template <class ArgMember, class T>
+  KOKKOS_INLINE_FUNCTION static T deduce_reduce_type(
+      VOIDTAG, void (FunctorType::*)(ArgMember, ArgMember, ArgMember, ArgMember,
+                                     ArgMember, T&, bool) const) {}
+
+  template <class ArgMember, class T>
+  KOKKOS_INLINE_FUNCTION static T deduce_reduce_type(
+      VOIDTAG, void (FunctorType::*)(ArgMember, ArgMember, ArgMember, ArgMember,
+                                     ArgMember, ArgMember, T&, bool) const) {}
+
+  template <class ArgMember, class T>
+  KOKKOS_INLINE_FUNCTION static T deduce_reduce_type(
+      VOIDTAG,
+      void (FunctorType::*)(ArgMember, ArgMember, ArgMember, ArgMember,
+                            ArgMember, ArgMember, ArgMember, T&, bool) const) {}
+
+  template <class ArgMember, class T>
+  KOKKOS_INLINE_FUNCTION static T deduce_reduce_type(
+      VOIDTAG, void (FunctorType::*)(ArgMember, ArgMember, ArgMember, ArgMember,
+                                     ArgMember, ArgMember, ArgMember, ArgMember,
+                                     T&, bool) const) {}
+
+  //----------------------------------------
+  // multi-dimensional parallel_scan operator with a tag:
+
+  template <class ArgMember, class T>
+  KOKKOS_INLINE_FUNCTION static T deduce_reduce_type(
+      tag_type,
+      void (FunctorType::*)(tag_type, ArgMember, ArgMember, T&, bool) const) {}
+
+  template <class ArgMember, class T>
+  KOKKOS_INLINE_FUNCTION static T deduce_reduce_type(
+      tag_type, void (FunctorType::*)(tag_type, ArgMember, ArgMember, ArgMember,
+                                      T&, bool) const) {}
+
+  template <class ArgMember, class T>
+  KOKKOS_INLINE_FUNCTION static T deduce_reduce_type(
+      tag_type, void (FunctorType::*)(tag_type, ArgMember, ArgMember, ArgMember,
+                                      ArgMember, T&, bool) const) {}
+
+  template <class ArgMember, class T>
+  KOKKOS_INLINE_FUNCTION static T deduce_reduce_type(
+      tag_type, void (FunctorType::*)(tag_type, ArgMember, ArgMember, ArgMember,
+                                      ArgMember, ArgMember, T&, bool) const) {}
+
+  template <class ArgMember, class T>
+  KOKKOS_INLINE_FUNCTION static T deduce_reduce_type(
+      tag_type,
+      void (FunctorType::*)(tag_type, ArgMember, ArgMember, ArgMember,
+                            ArgMember, ArgMember, ArgMember, T&, bool) const) {}
+
+  template <class ArgMember, class T>
+  KOKKOS_INLINE_FUNCTION static T deduce_reduce_type(
+      tag_type, void (FunctorType::*)(tag_type, ArgMember, ArgMember, ArgMember,
+                                      ArgMember, ArgMember, ArgMember,
+                                      ArgMember, T&, bool) const) {}
+
+  template <class ArgMember, class T>
+  KOKKOS_INLINE_FUNCTION static T deduce_reduce_type(
+      tag_type, void (FunctorType::*)(tag_type, ArgMember, ArgMember, ArgMember,
+                                      ArgMember, ArgMember, ArgMember,
+                                      ArgMember, ArgMember, T&, bool) const) {}
+
+  template <class ArgMember, class T>
+  KOKKOS_INLINE_FUNCTION static T deduce_reduce_type(
+      tag_type, void (FunctorType::*)(const tag_type&, ArgMember, ArgMember, T&,
+                                      bool) const) {}
+
+  template <class ArgMember, class T>
+  KOKKOS_INLINE_FUNCTION static T deduce_reduce_type(
+      tag_type, void (FunctorType::*)(const tag_type&, ArgMember, ArgMember,
+                                      ArgMember, T&, bool) const) {}
+
+  template <class ArgMember, class T>
+  KOKKOS_INLINE_FUNCTION static T deduce_reduce_type(
+      tag_type, void (FunctorType::*)(const tag_type&, ArgMember, ArgMember,
+                                      ArgMember, ArgMember, T&, bool) const) {}
+
+  template <class ArgMember, class T>
+  KOKKOS_INLINE_FUNCTION static T deduce_reduce_type(
+      tag_type,
+      void (FunctorType::*)(const tag_type&, ArgMember, ArgMember, ArgMember,
+                            ArgMember, ArgMember, T&, bool) const) {}
+
+  template <class ArgMember, class T>
+  KOKKOS_INLINE_FUNCTION static T deduce_reduce_type(
+      tag_type, void (FunctorType::*)(const tag_type&, ArgMember, ArgMember,
+                                      ArgMember, ArgMember, ArgMember,
+                                      ArgMember, T&, bool) const) {}
+
+  template <class ArgMember, class T>
+  KOKKOS_INLINE_FUNCTION static T deduce_reduce_type(
+      tag_type, void (FunctorType::*)(const tag_type&, ArgMember, ArgMember,
+                                      ArgMember, ArgMember, ArgMember,
+                                      ArgMember, ArgMember, T&, bool) const) {}
+
+  template <class ArgMember, class T>
+  KOKKOS_INLINE_FUNCTION static T deduce_reduce_type(
+      tag_type, void (FunctorType::*)(const tag_type&, ArgMember, ArgMember,
+                                      ArgMember, ArgMember, ArgMember,
+                                      ArgMember, ArgMember, ArgMember, T&, bool)
+                   const) {}
+  //----------------------------------------
 
   using ValueType =
       decltype(deduce_reduce_type(tag_type(), &FunctorType::operator()));
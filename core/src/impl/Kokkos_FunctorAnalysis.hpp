@@ -268,6 +268,35 @@ struct FunctorAnalysis {
     template <typename M, typename A, typename I>
     KOKKOS_INLINE_FUNCTION static A deduce(void (Functor::*)(M, A&, I) const);
 
+    template <typename M, typename A, typename I>
+    KOKKOS_INLINE_FUNCTION static A deduce(void (Functor::*)(M, M, A&, I)
+                                               const);
+
+    template <typename M, typename A, typename I>
+    KOKKOS_INLINE_FUNCTION static A deduce(void (Functor::*)(M, M, M, A&, I)
+                                               const);
+
+    template <typename M, typename A, typename I>
+    KOKKOS_INLINE_FUNCTION static A deduce(void (Functor::*)(M, M, M, M, A&, I)
+                                               const);
+
+    template <typename M, typename A, typename I>
+    KOKKOS_INLINE_FUNCTION static A deduce(void (Functor::*)(M, M, M, M, M, A&,
+                                                             I) const);
+
+    template <typename M, typename A, typename I>
+    KOKKOS_INLINE_FUNCTION static A deduce(void (Functor::*)(M, M, M, M, M, M,
+                                                             A&, I) const);
+
+    template <typename M, typename A, typename I>
+    KOKKOS_INLINE_FUNCTION static A deduce(void (Functor::*)(M, M, M, M, M, M,
+                                                             M, A&, I) const);
+
+    template <typename M, typename A, typename I>
+    KOKKOS_INLINE_FUNCTION static A deduce(void (Functor::*)(M, M, M, M, M, M,
+                                                             M, M, A&, I)
+                                               const);
+
     using type = decltype(deduce(&F::operator()));
   };
 
@@ -277,10 +306,74 @@ struct FunctorAnalysis {
     KOKKOS_INLINE_FUNCTION static A deduce(void (Functor::*)(WTag, M, A&, I)
                                                const);
 
+    template <typename M, typename A, typename I>
+    KOKKOS_INLINE_FUNCTION static A deduce(void (Functor::*)(WTag, M, M, A&, I)
+                                               const);
+
+    template <typename M, typename A, typename I>
+    KOKKOS_INLINE_FUNCTION static A deduce(void (Functor::*)(WTag, M, M, M, A&,
+                                                             I) const);
+
+    template <typename M, typename A, typename I>
+    KOKKOS_INLINE_FUNCTION static A deduce(void (Functor::*)(WTag, M, M, M, M,
+                                                             A&, I) const);
+
+    template <typename M, typename A, typename I>
+    KOKKOS_INLINE_FUNCTION static A deduce(void (Functor::*)(WTag, M, M, M, M,
+                                                             M, A&, I) const);
+
+    template <typename M, typename A, typename I>
+    KOKKOS_INLINE_FUNCTION static A deduce(void (Functor::*)(WTag, M, M, M, M,
+                                                             M, M, A&, I)
+                                               const);
+
+    template <typename M, typename A, typename I>
+    KOKKOS_INLINE_FUNCTION static A deduce(void (Functor::*)(WTag, M, M, M, M,
+                                                             M, M, M, A&, I)
+                                               const);
+
+    template <typename M, typename A, typename I>
+    KOKKOS_INLINE_FUNCTION static A deduce(void (Functor::*)(WTag, M, M, M, M,
+                                                             M, M, M, M, A&, I)
+                                               const);
+
     template <typename M, typename A, typename I>
     KOKKOS_INLINE_FUNCTION static A deduce(void (Functor::*)(WTag const&, M, A&,
                                                              I) const);
 
+    template <typename M, typename A, typename I>
+    KOKKOS_INLINE_FUNCTION static A deduce(void (Functor::*)(WTag const&, M, M,
+                                                             A&, I) const);
+
+    template <typename M, typename A, typename I>
+    KOKKOS_INLINE_FUNCTION static A deduce(void (Functor::*)(WTag const&, M, M,
+                                                             M, A&, I) const);
+
+    template <typename M, typename A, typename I>
+    KOKKOS_INLINE_FUNCTION static A deduce(void (Functor::*)(WTag const&, M, M,
+                                                             M, M, A&, I)
+                                               const);
+
+    template <typename M, typename A, typename I>
+    KOKKOS_INLINE_FUNCTION static A deduce(void (Functor::*)(WTag const&, M, M,
+                                                             M, M, M, A&, I)
+                                               const);
+
+    template <typename M, typename A, typename I>
+    KOKKOS_INLINE_FUNCTION static A deduce(void (Functor::*)(WTag const&, M, M,
+                                                             M, M, M, M, A&, I)
+                                               const);
+
+    template <typename M, typename A, typename I>
+    KOKKOS_INLINE_FUNCTION static A deduce(void (Functor::*)(WTag const&, M, M,
+                                                             M, M, M, M, M, A&,
+                                                             I) const);
+
+    template <typename M, typename A, typename I>
+    KOKKOS_INLINE_FUNCTION static A deduce(void (Functor::*)(WTag const&, M, M,
+                                                             M, M, M, M, M, M,
+                                                             A&, I) const);
+
     using type = decltype(deduce(&F::operator()));
   };
 
@@ -207,7 +207,7 @@ SharedAllocationRecord<Kokkos::Experimental::HBWSpace,
 #endif
 {
 
-  m_space.deallocate(RecordBase::m_alloc_ptr->m_label,
+  m_space.deallocate(RecordBase::m_alloc_ptr->label(),
                      SharedAllocationRecord<void, void>::m_alloc_ptr,
                      SharedAllocationRecord<void, void>::m_alloc_size,
                      (SharedAllocationRecord<void, void>::m_alloc_size -
@@ -234,11 +234,7 @@ SharedAllocationRecord<Kokkos::Experimental::HBWSpace, void>::
   RecordBase::m_alloc_ptr->m_record =
       static_cast<SharedAllocationRecord<void, void> *>(this);
 
-  strncpy(RecordBase::m_alloc_ptr->m_label, arg_label.c_str(),
-          SharedAllocationHeader::maximum_label_length);
-  // Set last element zero, in case c_str is too long
-  RecordBase::m_alloc_ptr
-      ->m_label[SharedAllocationHeader::maximum_label_length - 1] = (char)0;
+  RecordBase::m_alloc_ptr->set_label(arg_label);
 }
 
 //----------------------------------------------------------------------------
@@ -46,8 +46,7 @@
 
 #include <impl/Kokkos_HostBarrier.hpp>
 #include <impl/Kokkos_BitOps.hpp>
-
-#include <impl/Kokkos_HostBarrier.hpp>
+#include <impl/Kokkos_Spinwait.hpp>
 
 #if !defined(_WIN32)
 #include <sched.h>
@@ -68,9 +67,17 @@ void HostBarrier::impl_backoff_wait_until_equal(
   req.tv_sec     = 0;
   unsigned count = 0u;
 
+  const WaitPolicy policy = host_wait_policy();
+
   while (!test_equal(ptr, v)) {
     const int c = ::Kokkos::log2(++count);
-    if (!active_wait || c > log2_iterations_till_sleep) {
+    if (policy == WaitPolicy::PASSIVE ||
+        (policy == WaitPolicy::HYBRID && c > log2_iterations_till_yield)) {
+      // sleep until the barrier word changes, woken by 'wake'
+      const int current = Kokkos::atomic_fetch_add(ptr, 0);
+      if (current != v) host_futex_wait(ptr, current);
+      continue;
+    } else if (!active_wait || c > log2_iterations_till_sleep) {
       req.tv_nsec = c < 16 ? 256 * c : 4096;
       nanosleep(&req, nullptr);
     } else if (c > log2_iterations_till_yield) {
@@ -47,6 +47,7 @@
 
 #include <Kokkos_Macros.hpp>
 #include <Kokkos_Atomic.hpp>
+#include <impl/Kokkos_Spinwait.hpp>
 
 namespace Kokkos {
 namespace Impl {
@@ -108,6 +109,7 @@ class HostBarrier {
 
     if (master_wait && result) {
       Kokkos::atomic_fetch_add(buffer + master_idx, 1);
+      wake(buffer + master_idx);
     }
 
     return result;
@@ -123,6 +125,7 @@ class HostBarrier {
     Kokkos::memory_fence();
     Kokkos::atomic_fetch_sub(buffer + arrive_idx, size);
     Kokkos::atomic_fetch_add(buffer + wait_idx, 1);
+    wake(buffer + wait_idx);
   }
 
   // should only be called by the master thread, will allow the master thread to
@@ -204,6 +207,17 @@ class HostBarrier {
     return result;
   }
 
+  // wake threads which the passive wait policies put to sleep on 'ptr',
+  // called right after an atomic update of '*ptr'
+  KOKKOS_INLINE_FUNCTION
+  static void wake(int* ptr) noexcept {
+#if defined(KOKKOS_ACTIVE_EXECUTION_MEMORY_SPACE_HOST)
+    host_futex_wake_after_atomic(ptr);
+#else
+    (void)ptr;
+#endif
+  }
+
   KOKKOS_INLINE_FUNCTION
   static void wait_until_equal(int* ptr, const int v,
                                bool active_wait = true) noexcept {
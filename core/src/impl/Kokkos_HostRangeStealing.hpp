@@ -0,0 +1,251 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_IMPL_HOSTRANGESTEALING_HPP
+#define KOKKOS_IMPL_HOSTRANGESTEALING_HPP
+
+#include <Kokkos_Macros.hpp>
+#ifdef KOKKOS_ENABLE_TASKDAG
+
+#include <Kokkos_Atomic.hpp>
+#include <impl/Kokkos_ChaseLev.hpp>
+#include <impl/Kokkos_LinkedListNode.hpp>
+#include <impl/Kokkos_Spinwait.hpp>
+
+#include <cstdint>
+#include <utility>
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+// class HostRangeStealing
+//
+// Per-thread work stealing scheduler for the chunks [ 0 .. num_chunks ) of a
+// dynamically scheduled range policy.
+//
+// Each thread starts with its static partition of the chunks.  The owning
+// thread splits its current range in half, pushing the upper half onto the
+// bottom of its ChaseLevDeque, until a single chunk remains to be executed.
+// When the current range is exhausted the owner pops the most recently
+// pushed (smallest) range.  An idle thread steals from the top of the deque
+// of a randomly selected victim, which holds the oldest and therefore
+// largest range, so each successful steal takes half of the victim's
+// remaining work.
+//
+// Termination is detected with a count of outstanding chunks kept in the
+// pool's root (rank 0) scheduler.  Threads only subtract the chunks they
+// executed once they run out of local work, so the count is not touched
+// in the common path.
+//
+// A pool of schedulers is accessed through a callable 'pool' such that
+// pool(r) returns the scheduler of the thread with pool rank r.
+class HostRangeStealing {
+ public:
+  // Splitting in half bounds the number of ranges a thread has in flight
+  // by log2 of the number of chunks, well within the deque capacity.
+  enum : int { deque_capacity = 64 };
+
+ private:
+  enum : int { node_free = 0, node_queued = 1 };
+
+  struct range_node : SimpleSinglyLinkedListNode<> {
+    int64_t begin = 0;
+    int64_t end   = 0;
+    int state     = node_free;
+  };
+
+  using deque_type =
+      ChaseLevDeque<range_node,
+                    fixed_size_circular_buffer<SimpleSinglyLinkedListNode<>,
+                                               deque_capacity, int32_t>,
+                    int32_t>;
+
+  deque_type m_deque;
+  range_node m_nodes[deque_capacity];
+  int64_t m_begin     = 0;  // range currently owned by this thread
+  int64_t m_end       = 0;
+  int64_t m_executed  = 0;  // chunks executed, not yet subtracted from root
+  int64_t m_remaining = 0;  // root only: chunks not yet executed
+  uint32_t m_seed     = 1;
+  int m_next_node     = 0;
+
+  // A node may be reused once its range has been copied out, either by the
+  // owner in pop or by a thief in steal.  A thief may still be reading a
+  // node after it has left the deque, so the owner cannot infer this from
+  // the deque indices alone.
+  range_node* acquire_node() noexcept {
+    for (int i = 0; i < deque_capacity; ++i) {
+      range_node& node = m_nodes[m_next_node];
+      m_next_node      = (m_next_node + 1) % deque_capacity;
+      if (node_free == *((int volatile*)&node.state)) {
+        Kokkos::load_fence();
+        return &node;
+      }
+    }
+    return nullptr;
+  }
+
+  static void release_node(range_node& node) noexcept {
+    Kokkos::memory_fence();
+    *((int volatile*)&node.state) = node_free;
+  }
+
+  // Split the owned range down to a single chunk, publishing upper halves.
+  void split() noexcept {
+    while (1 < m_end - m_begin) {
+      range_node* const node = acquire_node();
+      if (nullptr == node) return;
+
+      const int64_t mid = m_begin + (m_end - m_begin) / 2;
+
+      node->begin = mid;
+      node->end   = m_end;
+      node->state = node_queued;
+
+      if (!m_deque.push(*node)) {
+        node->state = node_free;
+        return;
+      }
+
+      m_end = mid;
+    }
+  }
+
+  bool pop() noexcept {
+    auto node = m_deque.pop();
+    if (!node) return false;
+    m_begin = node->begin;
+    m_end   = node->end;
+    release_node(*node);
+    return true;
+  }
+
+  bool steal_from(HostRangeStealing& victim) noexcept {
+    auto node = victim.m_deque.steal();
+    if (!node) return false;
+    m_begin = node->begin;
+    m_end   = node->end;
+    release_node(*node);
+    return true;
+  }
+
+  int random_victim(int const pool_rank, int const pool_size) noexcept {
+    // xorshift32
+    m_seed ^= m_seed << 13;
+    m_seed ^= m_seed >> 17;
+    m_seed ^= m_seed << 5;
+    const int victim = int(m_seed % uint32_t(pool_size - 1));
+    return victim < pool_rank ? victim : victim + 1;
+  }
+
+  template <class PoolAccess>
+  bool steal(PoolAccess const& pool, int const pool_rank,
+             int const pool_size) noexcept {
+    HostRangeStealing& root = pool(0);
+
+    if (m_executed) {
+      Kokkos::atomic_fetch_sub(&root.m_remaining, m_executed);
+      m_executed = 0;
+    }
+
+    // A pool of one thread has no victim to steal from
+    if (pool_size < 2) return false;
+
+    for (uint32_t i = 0;;) {
+      if (steal_from(pool(random_victim(pool_rank, pool_size)))) return true;
+      if (0 == *((int64_t volatile*)&root.m_remaining)) return false;
+      host_thread_yield(++i, WaitMode::ACTIVE);
+    }
+  }
+
+ public:
+  HostRangeStealing()                         = default;
+  HostRangeStealing(HostRangeStealing const&) = delete;
+  HostRangeStealing& operator=(HostRangeStealing const&) = delete;
+
+  // Set this thread's initial range of chunks [ begin .. end ) out of
+  // a total of num_chunks.  Must be called by every thread of the pool,
+  // followed by a pool rendezvous, before any thread calls 'next'.
+  void reset(int64_t const begin, int64_t const end, int64_t const num_chunks,
+             int const pool_rank) noexcept {
+    m_deque     = deque_type();
+    m_begin     = begin < num_chunks ? begin : num_chunks;
+    m_end       = end < num_chunks ? end : num_chunks;
+    m_executed  = 0;
+    m_remaining = num_chunks;
+    m_next_node = 0;
+    m_seed      = 2654435761u * uint32_t(pool_rank + 1);
+  }
+
+  // Claim the next range of chunks [ first .. second ) to execute.
+  // Return (-1,-1) when all chunks of the pool have been executed.
+  template <class PoolAccess>
+  std::pair<int64_t, int64_t> next(PoolAccess const& pool, int const pool_rank,
+                                   int const pool_size) noexcept {
+    if (m_end <= m_begin && !pop() && !steal(pool, pool_rank, pool_size)) {
+      return std::pair<int64_t, int64_t>(-1, -1);
+    }
+
+    split();
+
+    const std::pair<int64_t, int64_t> range(m_begin, m_end);
+
+    m_executed += m_end - m_begin;
+    m_begin = m_end;
+
+    return range;
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+#endif /* #ifdef KOKKOS_ENABLE_TASKDAG */
+#endif /* #ifndef KOKKOS_IMPL_HOSTRANGESTEALING_HPP */
@@ -48,6 +48,7 @@
 #include <impl/Kokkos_Error.hpp>
 #include <impl/Kokkos_MemorySpace.hpp>
 #include <impl/Kokkos_Tools.hpp>
+#include <impl/Kokkos_HostSpaceCache.hpp>
 
 /*--------------------------------------------------------------------------*/
 
@@ -89,6 +90,26 @@
 
 /*--------------------------------------------------------------------------*/
 
+#if defined(__linux__)
+
+#include <unistd.h>
+#include <sys/mman.h>
+
+// transparent huge pages are requested per address range
+#if defined(MADV_HUGEPAGE)
+#define KOKKOS_IMPL_HOST_HUGE_PAGES
+#endif
+
+// NUMA placement uses the mbind system call without libnuma
+#include <sys/syscall.h>
+#if defined(SYS_mbind) && defined(MAP_ANONYMOUS)
+#define KOKKOS_IMPL_HOST_NUMA
+#endif
+
+#endif
+
+/*--------------------------------------------------------------------------*/
+
 #include <cstddef>
 #include <cstdlib>
 #include <cstdint>
@@ -99,6 +120,7 @@
 #include <cstring>
 
 #include <Kokkos_HostSpace.hpp>
+#include <Kokkos_hwloc.hpp>
 #include <impl/Kokkos_Error.hpp>
 #include <Kokkos_Atomic.hpp>
 
@@ -112,24 +134,140 @@
 
 namespace Kokkos {
 
-/* Default allocation mechanism */
-HostSpace::HostSpace()
-    : m_alloc_mech(
+namespace {
+
+/* Transparent huge pages, see Kokkos::Impl::set_host_huge_pages */
+constexpr size_t host_huge_page_size = size_t(1) << 21;
+
+bool s_host_huge_pages            = false;
+size_t s_host_huge_page_threshold = host_huge_page_size;
+
+size_t s_host_huge_page_allocation_count = 0;
+size_t s_host_huge_page_allocation_bytes = 0;
+size_t s_host_huge_page_advise_failures  = 0;
+
+/* Size to which an allocation is padded and advised to use transparent
+ * huge pages, or zero if the allocation is to use base pages.
+ */
+size_t host_huge_page_alloc_size(const size_t arg_alloc_size) {
+#if defined(KOKKOS_IMPL_HOST_HUGE_PAGES)
+  if (s_host_huge_pages && s_host_huge_page_threshold <= arg_alloc_size) {
+    return (arg_alloc_size + host_huge_page_size - 1) &
+           ~(host_huge_page_size - 1);
+  }
+#else
+  (void)arg_alloc_size;
+#endif
+  return 0;
+}
+
+/* NUMA placement, see Kokkos::HostSpace::NumaPolicy */
+size_t s_host_numa_allocation_count = 0;
+size_t s_host_numa_allocation_bytes = 0;
+size_t s_host_numa_policy_failures  = 0;
+
+/* Map 'arg_alloc_size' bytes aligned to 'arg_align' and set the memory
+ * policy of the mapping before any of its pages is touched.  Like the
+ * huge page mapping of POSIX_MMAP the unaligned head and the tail beyond
+ * the page rounded size are unmapped.  Return nullptr on failure.
+ */
+void *host_numa_map(const HostSpace::NumaPolicy arg_policy,
+                    const unsigned arg_numa_node, const size_t arg_alloc_size,
+                    const size_t arg_align) {
+#if defined(KOKKOS_IMPL_HOST_NUMA)
+  // Memory policy modes and flags of the Linux mbind system call
+  constexpr int mpol_preferred    = 1;
+  constexpr int mpol_bind         = 2;
+  constexpr int mpol_interleave   = 3;
+  constexpr unsigned mpol_mf_move = 1u << 1;
+
+  constexpr unsigned long mask_bits = 8 * sizeof(unsigned long);
+  constexpr size_t mask_words       = 1024 / mask_bits;
+
+  const size_t page_size = sysconf(_SC_PAGESIZE);
+  const size_t align     = arg_align < page_size ? page_size : arg_align;
+  const size_t size      = (arg_alloc_size + page_size - 1) & ~(page_size - 1);
+  const size_t map_size  = size + align - page_size;
+
+  void *const map_ptr = mmap(nullptr, map_size, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (map_ptr == MAP_FAILED) return nullptr;
+
+  const uintptr_t map_begin = reinterpret_cast<uintptr_t>(map_ptr);
+  const uintptr_t begin     = (map_begin + align - 1) & ~(align - 1);
+  const uintptr_t end       = begin + size;
+  if (map_begin < begin) {
+    munmap(map_ptr, begin - map_begin);
+  }
+  if (end < map_begin + map_size) {
+    munmap(reinterpret_cast<void *>(end), map_begin + map_size - end);
+  }
+
+  unsigned long mask[mask_words] = {};
+  int mode                       = mpol_interleave;
+  if (arg_policy == HostSpace::NumaPolicy::INTERLEAVE) {
+    const unsigned count = Kokkos::hwloc::get_memory_numa_count();
+    for (unsigned numa = 0; numa < count; ++numa) {
+      const int id = Kokkos::hwloc::get_memory_numa_id(numa);
+      if (0 <= id && size_t(id) < mask_words * mask_bits) {
+        mask[id / mask_bits] |= 1ul << (id % mask_bits);
+      }
+    }
+  } else {
+    mode = arg_policy == HostSpace::NumaPolicy::BIND ? mpol_bind
+                                                      : mpol_preferred;
+    const int id = Kokkos::hwloc::get_memory_numa_id(arg_numa_node);
+    if (0 <= id && size_t(id) < mask_words * mask_bits) {
+      mask[id / mask_bits] |= 1ul << (id % mask_bits);
+    }
+  }
+
+  Kokkos::atomic_increment(&s_host_numa_allocation_count);
+  Kokkos::atomic_add(&s_host_numa_allocation_bytes, arg_alloc_size);
+
+  // The kernel reads one bit less than 'maxnode'.
+  if (syscall(SYS_mbind, begin, size, mode, mask, mask_words * mask_bits + 1,
+              mpol_mf_move) != 0) {
+    Kokkos::atomic_increment(&s_host_numa_policy_failures);
+  }
+
+  return reinterpret_cast<void *>(begin);
+#else
+  (void)arg_policy;
+  (void)arg_numa_node;
+  (void)arg_alloc_size;
+  (void)arg_align;
+  return nullptr;
+#endif
+}
+
+/* Default allocation mechanism, the only one served by the cache of freed
+ * allocations, see Kokkos::Impl::set_host_cache_capacity.
+ */
+constexpr HostSpace::AllocationMechanism host_default_alloc_mech =
 #if defined(KOKKOS_ENABLE_INTEL_MM_ALLOC)
-          HostSpace::INTEL_MM_ALLOC
+    HostSpace::INTEL_MM_ALLOC;
 #elif defined(KOKKOS_IMPL_POSIX_MMAP_FLAGS)
-          HostSpace::POSIX_MMAP
+    HostSpace::POSIX_MMAP;
 #elif defined(KOKKOS_ENABLE_POSIX_MEMALIGN)
-          HostSpace::POSIX_MEMALIGN
+    HostSpace::POSIX_MEMALIGN;
 #else
-          HostSpace::STD_MALLOC
+    HostSpace::STD_MALLOC;
 #endif
-      ) {
-}
+
+}  // namespace
+
+/* Default allocation mechanism */
+HostSpace::HostSpace()
+    : m_alloc_mech(host_default_alloc_mech),
+      m_numa_policy(NumaPolicy::DEFAULT),
+      m_numa_node(0) {}
 
 /* Default allocation mechanism */
 HostSpace::HostSpace(const HostSpace::AllocationMechanism &arg_alloc_mech)
-    : m_alloc_mech(HostSpace::STD_MALLOC) {
+    : m_alloc_mech(HostSpace::STD_MALLOC),
+      m_numa_policy(NumaPolicy::DEFAULT),
+      m_numa_node(0) {
   if (arg_alloc_mech == STD_MALLOC) {
     m_alloc_mech = HostSpace::STD_MALLOC;
   }
@@ -163,6 +301,28 @@ HostSpace::HostSpace(const HostSpace::AllocationMechanism &arg_alloc_mech)
   }
 }
 
+/* Default allocation mechanism placed by a NUMA policy */
+HostSpace::HostSpace(const HostSpace::NumaPolicy &arg_numa_policy,
+                     const unsigned arg_numa_node)
+    : m_alloc_mech(host_default_alloc_mech),
+      m_numa_policy(arg_numa_policy),
+      m_numa_node(arg_numa_node) {
+  if (m_numa_policy == NumaPolicy::DEFAULT) return;
+
+#if defined(KOKKOS_IMPL_HOST_NUMA)
+  const unsigned numa_count = Kokkos::hwloc::get_memory_numa_count();
+  if (m_numa_policy != NumaPolicy::INTERLEAVE && numa_count <= m_numa_node) {
+    std::ostringstream msg;
+    msg << "Kokkos::HostSpace NUMA node " << m_numa_node
+        << " is out of range, there are " << numa_count << " NUMA nodes";
+    Kokkos::Impl::throw_runtime_exception(msg.str());
+  }
+#else
+  Kokkos::Impl::throw_runtime_exception(
+      "Kokkos::HostSpace NUMA placement is not available");
+#endif
+}
+
 void *HostSpace::allocate(const size_t arg_alloc_size) const {
   return allocate("[unlabeled]", arg_alloc_size);
 }
@@ -185,9 +345,86 @@ void *HostSpace::allocate(const char *arg_label, const size_t arg_alloc_size,
   void *ptr = nullptr;
 
   if (arg_alloc_size) {
-    if (m_alloc_mech == STD_MALLOC) {
+    // Sizes served by the cache of freed allocations are rounded up to
+    // their size class, so that a cached block serves any size of its class.
+    const bool cacheable = m_alloc_mech == host_default_alloc_mech &&
+                           m_numa_policy == NumaPolicy::DEFAULT;
+    const size_t block_size =
+        cacheable ? Impl::host_cache_block_size(arg_alloc_size) : 0;
+    if (block_size) {
+      ptr = Impl::host_cache_pop(block_size);
+      if (ptr == nullptr) ptr = impl_allocate_raw(block_size);
+      if (ptr && !Impl::host_cache_block_allocated(ptr)) {
+        // A block which is not recorded would be freed by the wrong size
+        impl_deallocate_raw(ptr, block_size);
+        ptr = impl_allocate_raw(arg_alloc_size);
+      }
+    } else {
+      ptr = impl_allocate_raw(arg_alloc_size);
+    }
+  }
+
+  if ((ptr == nullptr) || (reinterpret_cast<uintptr_t>(ptr) == ~uintptr_t(0)) ||
+      (reinterpret_cast<uintptr_t>(ptr) & alignment_mask)) {
+    Experimental::RawMemoryAllocationFailure::FailureMode failure_mode =
+        Experimental::RawMemoryAllocationFailure::FailureMode::
+            AllocationNotAligned;
+    if (ptr == nullptr) {
+      failure_mode = Experimental::RawMemoryAllocationFailure::FailureMode::
+          OutOfMemoryError;
+    }
+
+    Experimental::RawMemoryAllocationFailure::AllocationMechanism alloc_mec =
+        Experimental::RawMemoryAllocationFailure::AllocationMechanism::
+            StdMalloc;
+    switch (m_alloc_mech) {
+      case STD_MALLOC: break;  // default
+      case POSIX_MEMALIGN:
+        alloc_mec = Experimental::RawMemoryAllocationFailure::
+            AllocationMechanism::PosixMemAlign;
+        break;
+      case POSIX_MMAP:
+        alloc_mec = Experimental::RawMemoryAllocationFailure::
+            AllocationMechanism::PosixMMap;
+        break;
+      case INTEL_MM_ALLOC:
+        alloc_mec = Experimental::RawMemoryAllocationFailure::
+            AllocationMechanism::IntelMMAlloc;
+        break;
+    }
+
+    throw Kokkos::Experimental::RawMemoryAllocationFailure(
+        arg_alloc_size, alignment, failure_mode, alloc_mec);
+  }
+  if (Kokkos::Profiling::profileLibraryLoaded()) {
+    Kokkos::Profiling::allocateData(
+        Kokkos::Profiling::make_space_handle(name()), arg_label, ptr,
+        reported_size);
+  }
+  return ptr;
+}
+
+void *HostSpace::impl_allocate_raw(const size_t arg_alloc_size) const {
+  constexpr uintptr_t alignment = Kokkos::Impl::MEMORY_ALIGNMENT;
+
+  void *ptr = nullptr;
+
+  if (arg_alloc_size) {
+    // Allocations at or above the huge page threshold are aligned to and
+    // padded to whole huge pages, and advised to use transparent huge pages
+    // once allocated.
+    const size_t huge_size = host_huge_page_alloc_size(arg_alloc_size);
+    const size_t use_align = huge_size ? host_huge_page_size : alignment;
+    const size_t use_size  = huge_size ? huge_size : arg_alloc_size;
+    size_t advise_size     = use_size;
+
+    if (m_numa_policy != NumaPolicy::DEFAULT) {
+      ptr         = host_numa_map(m_numa_policy, m_numa_node, arg_alloc_size,
+                                  huge_size ? host_huge_page_size : alignment);
+      advise_size = arg_alloc_size;
+    } else if (m_alloc_mech == STD_MALLOC) {
       // Over-allocate to and round up to guarantee proper alignment.
-      size_t size_padded = arg_alloc_size + sizeof(void *) + alignment;
+      size_t size_padded = use_size + sizeof(void *) + use_align;
 
       void *alloc_ptr = malloc(size_padded);
 
@@ -196,8 +433,8 @@ void *HostSpace::allocate(const char *arg_label, const size_t arg_alloc_size,
 
         // offset enough to record the alloc_ptr
         address += sizeof(void *);
-        uintptr_t rem    = address % alignment;
-        uintptr_t offset = rem ? (alignment - rem) : 0u;
+        uintptr_t rem    = address % use_align;
+        uintptr_t offset = rem ? (use_align - rem) : 0u;
         address += offset;
         ptr = reinterpret_cast<void *>(address);
         // record the alloc'd pointer
@@ -207,13 +444,13 @@ void *HostSpace::allocate(const char *arg_label, const size_t arg_alloc_size,
     }
 #if defined(KOKKOS_ENABLE_INTEL_MM_ALLOC)
     else if (m_alloc_mech == INTEL_MM_ALLOC) {
-      ptr = _mm_malloc(arg_alloc_size, alignment);
+      ptr = _mm_malloc(use_size, use_align);
     }
 #endif
 
 #if defined(KOKKOS_ENABLE_POSIX_MEMALIGN)
     else if (m_alloc_mech == POSIX_MEMALIGN) {
-      posix_memalign(&ptr, alignment, arg_alloc_size);
+      posix_memalign(&ptr, use_align, use_size);
     }
 #endif
 
@@ -227,64 +464,68 @@ void *HostSpace::allocate(const char *arg_label, const size_t arg_alloc_size,
 
       // read write access to private memory
 
-      ptr =
-          mmap(nullptr /* address hint, if nullptr OS kernel chooses address */
-               ,
-               arg_alloc_size /* size in bytes */
-               ,
-               prot /* memory protection */
-               ,
-               flags /* visibility of updates */
-               ,
-               -1 /* file descriptor */
-               ,
-               0 /* offset */
-          );
+      if (huge_size) {
+        // Map an extra huge page and unmap the unaligned head and the
+        // tail beyond the requested size, so that 'deallocate' unmaps
+        // the whole mapping.  Transparent huge pages do not need the
+        // reserved pages of MAP_HUGETLB.
+        const size_t page_size = sysconf(_SC_PAGESIZE);
+        const size_t map_size  = huge_size + host_huge_page_size;
+        void *const map_ptr    = mmap(nullptr, map_size, prot,
+                                   KOKKOS_IMPL_POSIX_MMAP_FLAGS, -1, 0);
+        if (map_ptr != MAP_FAILED) {
+          const uintptr_t map_begin = reinterpret_cast<uintptr_t>(map_ptr);
+          const uintptr_t begin     = (map_begin + host_huge_page_size - 1) &
+                                  ~(host_huge_page_size - 1);
+          const uintptr_t end =
+              begin + ((arg_alloc_size + page_size - 1) & ~(page_size - 1));
+          if (map_begin < begin) {
+            munmap(map_ptr, begin - map_begin);
+          }
+          if (end < map_begin + map_size) {
+            munmap(reinterpret_cast<void *>(end), map_begin + map_size - end);
+          }
+          ptr         = reinterpret_cast<void *>(begin);
+          advise_size = end - begin;
+        } else {
+          ptr = map_ptr;
+        }
+      } else {
+        ptr = mmap(
+            nullptr /* address hint, if nullptr OS kernel chooses address */
+            ,
+            arg_alloc_size /* size in bytes */
+            ,
+            prot /* memory protection */
+            ,
+            flags /* visibility of updates */
+            ,
+            -1 /* file descriptor */
+            ,
+            0 /* offset */
+        );
+      }
 
       /* Associated reallocation:
              ptr = mremap( old_ptr , old_size , new_size , MREMAP_MAYMOVE );
       */
     }
 #endif
-  }
 
-  if ((ptr == nullptr) || (reinterpret_cast<uintptr_t>(ptr) == ~uintptr_t(0)) ||
-      (reinterpret_cast<uintptr_t>(ptr) & alignment_mask)) {
-    Experimental::RawMemoryAllocationFailure::FailureMode failure_mode =
-        Experimental::RawMemoryAllocationFailure::FailureMode::
-            AllocationNotAligned;
-    if (ptr == nullptr) {
-      failure_mode = Experimental::RawMemoryAllocationFailure::FailureMode::
-          OutOfMemoryError;
-    }
-
-    Experimental::RawMemoryAllocationFailure::AllocationMechanism alloc_mec =
-        Experimental::RawMemoryAllocationFailure::AllocationMechanism::
-            StdMalloc;
-    switch (m_alloc_mech) {
-      case STD_MALLOC: break;  // default
-      case POSIX_MEMALIGN:
-        alloc_mec = Experimental::RawMemoryAllocationFailure::
-            AllocationMechanism::PosixMemAlign;
-        break;
-      case POSIX_MMAP:
-        alloc_mec = Experimental::RawMemoryAllocationFailure::
-            AllocationMechanism::PosixMMap;
-        break;
-      case INTEL_MM_ALLOC:
-        alloc_mec = Experimental::RawMemoryAllocationFailure::
-            AllocationMechanism::IntelMMAlloc;
-        break;
+#if defined(KOKKOS_IMPL_HOST_HUGE_PAGES)
+    if (huge_size && (ptr != nullptr) &&
+        (reinterpret_cast<uintptr_t>(ptr) != ~uintptr_t(0))) {
+      Kokkos::atomic_increment(&s_host_huge_page_allocation_count);
+      Kokkos::atomic_add(&s_host_huge_page_allocation_bytes, arg_alloc_size);
+      if (madvise(ptr, advise_size, MADV_HUGEPAGE) != 0) {
+        Kokkos::atomic_increment(&s_host_huge_page_advise_failures);
+      }
     }
-
-    throw Kokkos::Experimental::RawMemoryAllocationFailure(
-        arg_alloc_size, alignment, failure_mode, alloc_mec);
-  }
-  if (Kokkos::Profiling::profileLibraryLoaded()) {
-    Kokkos::Profiling::allocateData(
-        Kokkos::Profiling::make_space_handle(name()), arg_label, ptr,
-        reported_size);
+#else
+    (void)advise_size;
+#endif
   }
+
   return ptr;
 }
 
@@ -306,7 +547,27 @@ void HostSpace::deallocate(const char *arg_label, void *const arg_alloc_ptr,
           Kokkos::Profiling::make_space_handle(name()), arg_label,
           arg_alloc_ptr, reported_size);
     }
-    if (m_alloc_mech == STD_MALLOC) {
+    // Blocks of the size classes of the cache are kept while it has room.
+    const size_t block_size =
+        (m_alloc_mech == host_default_alloc_mech &&
+         m_numa_policy == NumaPolicy::DEFAULT)
+            ? Impl::host_cache_freed_block_size(arg_alloc_ptr, arg_alloc_size)
+            : 0;
+    if (!block_size || !Impl::host_cache_push(arg_alloc_ptr, block_size)) {
+      impl_deallocate_raw(arg_alloc_ptr,
+                          block_size ? block_size : arg_alloc_size);
+    }
+  }
+}
+
+void HostSpace::impl_deallocate_raw(void *const arg_alloc_ptr,
+                                    const size_t arg_alloc_size) const {
+  if (arg_alloc_ptr) {
+    if (m_numa_policy != NumaPolicy::DEFAULT) {
+#if defined(KOKKOS_IMPL_HOST_NUMA)
+      munmap(arg_alloc_ptr, arg_alloc_size);
+#endif
+    } else if (m_alloc_mech == STD_MALLOC) {
       void *alloc_ptr = *(reinterpret_cast<void **>(arg_alloc_ptr) - 1);
       free(alloc_ptr);
     }
@@ -328,6 +589,9 @@ void HostSpace::deallocate(const char *arg_label, void *const arg_alloc_ptr,
     }
 #endif
   }
+#if !defined(KOKKOS_IMPL_POSIX_MMAP_FLAGS) && !defined(KOKKOS_IMPL_HOST_NUMA)
+  (void)arg_alloc_size;
+#endif
 }
 
 }  // namespace Kokkos
@@ -355,7 +619,7 @@ SharedAllocationRecord<Kokkos::HostSpace, void>::~SharedAllocationRecord()
 #endif
 {
 
-  m_space.deallocate(RecordBase::m_alloc_ptr->m_label,
+  m_space.deallocate(RecordBase::m_alloc_ptr->label(),
                      SharedAllocationRecord<void, void>::m_alloc_ptr,
                      SharedAllocationRecord<void, void>::m_alloc_size,
                      (SharedAllocationRecord<void, void>::m_alloc_size -
@@ -402,11 +666,7 @@ SharedAllocationRecord<Kokkos::HostSpace, void>::SharedAllocationRecord(
   RecordBase::m_alloc_ptr->m_record =
       static_cast<SharedAllocationRecord<void, void> *>(this);
 
-  strncpy(RecordBase::m_alloc_ptr->m_label, arg_label.c_str(),
-          SharedAllocationHeader::maximum_label_length);
-  // Set last element zero, in case c_str is too long
-  RecordBase::m_alloc_ptr
-      ->m_label[SharedAllocationHeader::maximum_label_length - 1] = (char)0;
+  RecordBase::m_alloc_ptr->set_label(arg_label);
 }
 
 //----------------------------------------------------------------------------
@@ -494,6 +754,7 @@ namespace {
 const unsigned HOST_SPACE_ATOMIC_MASK     = 0xFFFF;
 const unsigned HOST_SPACE_ATOMIC_XOR_MASK = 0x5A39;
 static int HOST_SPACE_ATOMIC_LOCKS[HOST_SPACE_ATOMIC_MASK + 1];
+bool s_host_first_touch = false;
 }  // namespace
 
 namespace Impl {
@@ -557,5 +818,47 @@ void unlock_address_host_space(void *ptr) {
 #endif
 }
 
+bool host_first_touch() noexcept { return s_host_first_touch; }
+
+void set_host_first_touch(const bool enable) noexcept {
+  s_host_first_touch = enable;
+}
+
+bool host_huge_pages() noexcept { return s_host_huge_pages; }
+
+void set_host_huge_pages(const bool enable) noexcept {
+  s_host_huge_pages = enable;
+}
+
+size_t host_huge_page_threshold() noexcept {
+  return s_host_huge_page_threshold;
+}
+
+void set_host_huge_page_threshold(const size_t threshold) noexcept {
+  s_host_huge_page_threshold = threshold ? threshold : host_huge_page_size;
+}
+
+HostHugePageStatistics host_huge_page_statistics() noexcept {
+  HostHugePageStatistics stats;
+  stats.allocation_count =
+      *static_cast<volatile size_t *>(&s_host_huge_page_allocation_count);
+  stats.allocation_bytes =
+      *static_cast<volatile size_t *>(&s_host_huge_page_allocation_bytes);
+  stats.advise_failures =
+      *static_cast<volatile size_t *>(&s_host_huge_page_advise_failures);
+  return stats;
+}
+
+HostNumaStatistics host_numa_statistics() noexcept {
+  HostNumaStatistics stats;
+  stats.allocation_count =
+      *static_cast<volatile size_t *>(&s_host_numa_allocation_count);
+  stats.allocation_bytes =
+      *static_cast<volatile size_t *>(&s_host_numa_allocation_bytes);
+  stats.policy_failures =
+      *static_cast<volatile size_t *>(&s_host_numa_policy_failures);
+  return stats;
+}
+
 }  // namespace Impl
 }  // namespace Kokkos
@@ -0,0 +1,345 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <unordered_set>
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_Atomic.hpp>
+#include <Kokkos_HostSpace.hpp>
+#include <impl/Kokkos_BitOps.hpp>
+#include <impl/Kokkos_HostSpaceCache.hpp>
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+namespace {
+
+/* Size classes: 64 bytes and four classes per power of two up to 64 MiB */
+enum : int {
+  host_cache_min_lg2     = 6,
+  host_cache_max_lg2     = 26,
+  host_cache_sub_lg2     = 2,
+  host_cache_class_count = ((host_cache_max_lg2 - host_cache_min_lg2)
+                            << host_cache_sub_lg2) +
+                           1
+};
+
+/* The front caches are 64 buckets, selected by a hash of the calling
+ * thread's id and so shared by the threads which hash to the same bucket.
+ * A thread only uses its bucket if the bucket's try-lock succeeds, and
+ * otherwise goes to the shared bins.  Buckets hold a few blocks of each
+ * class up to 1 MiB, larger blocks always go to the shared bins.
+ */
+enum : int {
+  host_cache_front_count     = 64,
+  host_cache_front_depth     = 4,
+  host_cache_front_max_class = ((20 - host_cache_min_lg2)
+                                << host_cache_sub_lg2)
+};
+
+/* Intrusive list of free blocks, the first word of a block is the link */
+struct HostCacheList {
+  void* head;
+  size_t count;
+};
+
+/* Hit and miss counts are kept under the lock of the front or the bins */
+struct alignas(64) HostCacheFront {
+  int lock;
+  size_t hits;
+  HostCacheList list[host_cache_front_max_class + 1];
+};
+
+struct HostCacheBins {
+  int lock;
+  size_t hits;
+  size_t misses;
+  HostCacheList list[host_cache_class_count];
+};
+
+/* The blocks handed out by the cache are recorded until they are freed,
+ * in sets selected by a hash of the block's address, so that a freed
+ * allocation is only taken for a block of its class if it was allocated as
+ * one; whether the cache was enabled at the time does not matter.  The sets
+ * are never destroyed since allocations may outlive static destruction.
+ */
+enum : int { host_cache_block_set_count = 64 };
+
+struct HostCacheBlockSet {
+  int lock;
+  std::unordered_set<void*> blocks;
+};
+
+size_t s_host_cache_capacity = 0;
+size_t s_host_cache_bytes    = 0;
+size_t s_host_cache_blocks   = 0;
+
+HostCacheFront s_host_cache_front[host_cache_front_count];
+HostCacheBins s_host_cache_bins;
+
+inline bool host_cache_try_lock(int* const lock) {
+  return 0 == Kokkos::atomic_compare_exchange(lock, 0, 1);
+}
+
+inline void host_cache_lock(int* const lock) {
+  while (!host_cache_try_lock(lock)) {
+  }
+}
+
+inline void host_cache_unlock(int* const lock) {
+  Kokkos::atomic_exchange(lock, 0);
+}
+
+inline void host_cache_list_push(HostCacheList& list, void* const ptr) {
+  *reinterpret_cast<void**>(ptr) = list.head;
+  list.head                      = ptr;
+  ++list.count;
+}
+
+inline void* host_cache_list_pop(HostCacheList& list) {
+  void* const ptr = list.head;
+  if (ptr) {
+    list.head = *reinterpret_cast<void**>(ptr);
+    --list.count;
+  }
+  return ptr;
+}
+
+/* Class of a size in ( 2^(lg-1) , 2^lg ] is found from the bits below
+ * the leading bit of ( size - 1 ).
+ */
+inline int host_cache_class(const size_t size) {
+  if (size <= (size_t(1) << host_cache_min_lg2)) return 0;
+  const unsigned s = unsigned(size - 1);
+  const int lg2    = Kokkos::log2(s);
+  const int sub    = int(s >> (lg2 - host_cache_sub_lg2)) &
+                  ((1 << host_cache_sub_lg2) - 1);
+  return ((lg2 - host_cache_min_lg2) << host_cache_sub_lg2) + sub + 1;
+}
+
+inline size_t host_cache_class_size(const int c) {
+  if (c == 0) return size_t(1) << host_cache_min_lg2;
+  const int lg2 = ((c - 1) >> host_cache_sub_lg2) + host_cache_min_lg2;
+  const size_t sub = ((c - 1) & ((1 << host_cache_sub_lg2) - 1)) + 1;
+  return (size_t(1) << lg2) + (sub << (lg2 - host_cache_sub_lg2));
+}
+
+inline HostCacheBlockSet& host_cache_block_set(void* const ptr) {
+  static HostCacheBlockSet* const sets =
+      new HostCacheBlockSet[host_cache_block_set_count]();
+  // Blocks are at least 64 byte aligned, hash the remaining bits.
+  const uint64_t h = uint64_t(reinterpret_cast<uintptr_t>(ptr)) >> 6;
+  return sets[(h * 0x9E3779B97F4A7C15ull) >> 58];
+}
+
+inline HostCacheFront& host_cache_this_front() {
+  // Thread ids are often aligned addresses, use the high bits of a
+  // multiplicative hash.
+  const uint64_t h = std::hash<std::thread::id>()(std::this_thread::get_id());
+  return s_host_cache_front[(h * 0x9E3779B97F4A7C15ull) >> 58];
+}
+
+void host_cache_release_all() {
+  Kokkos::HostSpace space;
+  for (int i = 0; i < host_cache_front_count; ++i) {
+    HostCacheFront& front = s_host_cache_front[i];
+    host_cache_lock(&front.lock);
+    for (int c = 0; c <= host_cache_front_max_class; ++c) {
+      const size_t size = host_cache_class_size(c);
+      while (void* const ptr = host_cache_list_pop(front.list[c])) {
+        Kokkos::atomic_fetch_sub(&s_host_cache_bytes, size);
+        space.impl_deallocate_raw(ptr, size);
+      }
+    }
+    host_cache_unlock(&front.lock);
+  }
+  host_cache_lock(&s_host_cache_bins.lock);
+  for (int c = 0; c < host_cache_class_count; ++c) {
+    const size_t size = host_cache_class_size(c);
+    while (void* const ptr = host_cache_list_pop(s_host_cache_bins.list[c])) {
+      Kokkos::atomic_fetch_sub(&s_host_cache_bytes, size);
+      space.impl_deallocate_raw(ptr, size);
+    }
+  }
+  host_cache_unlock(&s_host_cache_bins.lock);
+}
+
+}  // namespace
+
+size_t host_cache_block_size(const size_t size) noexcept {
+  if (0 == *static_cast<volatile size_t*>(&s_host_cache_capacity) ||
+      (size_t(1) << host_cache_max_lg2) < size) {
+    return 0;
+  }
+  return host_cache_class_size(host_cache_class(size));
+}
+
+bool host_cache_block_allocated(void* const ptr) noexcept {
+  HostCacheBlockSet& set = host_cache_block_set(ptr);
+  bool recorded          = false;
+  host_cache_lock(&set.lock);
+  try {
+    recorded = set.blocks.insert(ptr).second;
+  } catch (...) {
+  }
+  host_cache_unlock(&set.lock);
+  if (recorded) Kokkos::atomic_increment(&s_host_cache_blocks);
+  return recorded;
+}
+
+size_t host_cache_freed_block_size(void* const ptr,
+                                   const size_t size) noexcept {
+  // A block is recorded before its allocation returns, so the count
+  // includes it when it is freed.
+  if (0 == *static_cast<volatile size_t*>(&s_host_cache_blocks) ||
+      (size_t(1) << host_cache_max_lg2) < size) {
+    return 0;
+  }
+  HostCacheBlockSet& set = host_cache_block_set(ptr);
+  host_cache_lock(&set.lock);
+  const bool block = 0 != set.blocks.erase(ptr);
+  host_cache_unlock(&set.lock);
+  if (!block) return 0;
+  Kokkos::atomic_decrement(&s_host_cache_blocks);
+  return host_cache_class_size(host_cache_class(size));
+}
+
+void* host_cache_pop(const size_t block_size) noexcept {
+  const int c = host_cache_class(block_size);
+
+  void* ptr = nullptr;
+
+  if (c <= host_cache_front_max_class) {
+    HostCacheFront& front = host_cache_this_front();
+    if (host_cache_try_lock(&front.lock)) {
+      ptr = host_cache_list_pop(front.list[c]);
+      if (ptr) ++front.hits;
+      host_cache_unlock(&front.lock);
+    }
+  }
+
+  if (ptr == nullptr) {
+    host_cache_lock(&s_host_cache_bins.lock);
+    ptr = host_cache_list_pop(s_host_cache_bins.list[c]);
+    if (ptr) {
+      ++s_host_cache_bins.hits;
+    } else {
+      ++s_host_cache_bins.misses;
+    }
+    host_cache_unlock(&s_host_cache_bins.lock);
+  }
+
+  if (ptr) Kokkos::atomic_fetch_sub(&s_host_cache_bytes, block_size);
+
+  return ptr;
+}
+
+bool host_cache_push(void* const ptr, const size_t block_size) noexcept {
+  const size_t capacity =
+      *static_cast<volatile size_t*>(&s_host_cache_capacity);
+
+  if (capacity <
+      Kokkos::atomic_fetch_add(&s_host_cache_bytes, block_size) + block_size) {
+    Kokkos::atomic_fetch_sub(&s_host_cache_bytes, block_size);
+    return false;
+  }
+
+  const int c = host_cache_class(block_size);
+
+  if (c <= host_cache_front_max_class) {
+    HostCacheFront& front = host_cache_this_front();
+    if (host_cache_try_lock(&front.lock)) {
+      HostCacheList& list = front.list[c];
+      if (list.count == host_cache_front_depth) {
+        // Spill the full front list to the shared bin.
+        host_cache_lock(&s_host_cache_bins.lock);
+        while (void* const p = host_cache_list_pop(list)) {
+          host_cache_list_push(s_host_cache_bins.list[c], p);
+        }
+        host_cache_unlock(&s_host_cache_bins.lock);
+      }
+      host_cache_list_push(list, ptr);
+      host_cache_unlock(&front.lock);
+      return true;
+    }
+  }
+
+  host_cache_lock(&s_host_cache_bins.lock);
+  host_cache_list_push(s_host_cache_bins.list[c], ptr);
+  host_cache_unlock(&s_host_cache_bins.lock);
+  return true;
+}
+
+void host_cache_finalize() { set_host_cache_capacity(0); }
+
+size_t host_cache_capacity() noexcept { return s_host_cache_capacity; }
+
+void set_host_cache_capacity(const size_t capacity) {
+  const size_t previous =
+      Kokkos::atomic_exchange(&s_host_cache_capacity, capacity);
+  if (capacity < previous) host_cache_release_all();
+}
+
+void host_cache_release() { host_cache_release_all(); }
+
+HostCacheStatistics host_cache_statistics() noexcept {
+  HostCacheStatistics stats;
+  stats.hit_count    = *static_cast<volatile size_t*>(&s_host_cache_bins.hits);
+  stats.miss_count   = *static_cast<volatile size_t*>(&s_host_cache_bins.misses);
+  stats.cached_bytes = *static_cast<volatile size_t*>(&s_host_cache_bytes);
+  for (int i = 0; i < host_cache_front_count; ++i) {
+    stats.hit_count +=
+        *static_cast<volatile size_t*>(&s_host_cache_front[i].hits);
+  }
+  return stats;
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
@@ -0,0 +1,99 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_IMPL_HOSTSPACECACHE_HPP
+#define KOKKOS_IMPL_HOSTSPACECACHE_HPP
+
+#include <cstddef>
+
+/*--------------------------------------------------------------------------*/
+/*  Cache of freed HostSpace allocations, see
+ *  Kokkos::Impl::set_host_cache_capacity.
+ *
+ *  Allocations of the default HostSpace allocation mechanism are rounded
+ *  up to one of four size classes per power of two while the cache is
+ *  enabled, and recorded as blocks of the cache until they are freed.
+ *  Freed blocks are kept on intrusive lists, first in one of the front
+ *  caches, selected by a hash of the calling thread's id, and then in a
+ *  shared bin per size class, until the byte capacity is reached.
+ */
+
+namespace Kokkos {
+namespace Impl {
+
+/** \brief  Size of the block which serves an allocation of 'size' bytes,
+ *          or zero if the allocation bypasses the cache.
+ */
+size_t host_cache_block_size(const size_t size) noexcept;
+
+/** \brief  Record the allocated block at 'ptr' as handed out by the cache
+ *          until it is freed.  Return false if it could not be recorded,
+ *          in which case it must not be handed out as a block.
+ */
+bool host_cache_block_allocated(void* const ptr) noexcept;
+
+/** \brief  Size of the block at 'ptr' freed with 'size' bytes, or zero
+ *          if it was not handed out as a block of the cache.
+ */
+size_t host_cache_freed_block_size(void* const ptr,
+                                   const size_t size) noexcept;
+
+/** \brief  Take a cached block of 'block_size' bytes, or nullptr. */
+void* host_cache_pop(const size_t block_size) noexcept;
+
+/** \brief  Keep a freed block of 'block_size' bytes.
+ *          Return false if the block must be released instead.
+ */
+bool host_cache_push(void* const ptr, const size_t block_size) noexcept;
+
+/** \brief  Release all cached blocks and disable the cache,
+ *          called by Kokkos::finalize.  Blocks still handed out
+ *          are freed by their class size when they are deallocated.
+ */
+void host_cache_finalize();
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_IMPL_HOSTSPACECACHE_HPP */
@@ -43,7 +43,9 @@
 */
 
 #include <limits>
+#include <algorithm>
 #include <Kokkos_Macros.hpp>
+#include <Kokkos_hwloc.hpp>
 #include <impl/Kokkos_HostThreadTeam.hpp>
 #include <impl/Kokkos_Error.hpp>
 #include <impl/Kokkos_Spinwait.hpp>
@@ -54,6 +56,14 @@
 namespace Kokkos {
 namespace Impl {
 
+namespace {
+int s_pool_domain_size = 0;
+}
+
+void HostThreadTeamData::set_pool_domain_size(const int size) noexcept {
+  s_pool_domain_size = size;
+}
+
 void HostThreadTeamData::organize_pool(HostThreadTeamData *members[],
                                        const int size) {
   bool ok = true;
@@ -67,6 +77,15 @@ void HostThreadTeamData::organize_pool(HostThreadTeamData *members[],
   }
 
   if (ok) {
+    static const int topology_domain_size =
+        Kokkos::hwloc::get_available_threads_per_domain();
+
+    int domain_size =
+        0 < s_pool_domain_size ? s_pool_domain_size : topology_domain_size;
+
+    // A pool within a single domain is joined by the root as before.
+    if (domain_size <= 0 || size <= domain_size) domain_size = 1;
+
     int64_t *const root_scratch = members[0]->m_scratch;
 
     for (int i = m_pool_rendezvous; i < m_pool_reduce; ++i) {
@@ -81,6 +100,7 @@ void HostThreadTeamData::organize_pool(HostThreadTeamData *members[],
 
       for (int rank = 0; rank < size; ++rank) {
         HostThreadTeamData *const mem = members[rank];
+        const int domain_base         = rank - rank % domain_size;
         mem->m_pool_scratch           = root_scratch;
         mem->m_team_scratch           = mem->m_scratch;
         mem->m_pool_rank              = rank;
@@ -92,8 +112,19 @@ void HostThreadTeamData::organize_pool(HostThreadTeamData *members[],
         mem->m_league_rank            = rank;
         mem->m_league_size            = size;
         mem->m_team_rendezvous_step   = 0;
+        mem->m_domain_base            = domain_base;
+        mem->m_domain_size = std::min(domain_size, size - domain_base);
+        mem->m_domain_scratch         = members[domain_base]->m_scratch;
+        mem->m_domain_rendezvous_step = 0;
         pool[rank]                    = mem;
       }
+
+      for (int rank = 0; rank < size; rank += domain_size) {
+        int64_t *const domain_scratch = members[rank]->m_scratch;
+        for (int i = m_domain_rendezvous; i < m_team_rendezvous; ++i) {
+          domain_scratch[i] = 0;
+        }
+      }
     }
 
     Kokkos::memory_fence();
@@ -105,19 +136,23 @@ void HostThreadTeamData::organize_pool(HostThreadTeamData *members[],
 }
 
 void HostThreadTeamData::disband_pool() {
-  m_work_range.first     = -1;
-  m_work_range.second    = -1;
-  m_pool_scratch         = nullptr;
-  m_team_scratch         = nullptr;
-  m_pool_rank            = 0;
-  m_pool_size            = 1;
-  m_team_base            = 0;
-  m_team_rank            = 0;
-  m_team_size            = 1;
-  m_team_alloc           = 1;
-  m_league_rank          = 0;
-  m_league_size          = 1;
-  m_team_rendezvous_step = 0;
+  m_work_range.first       = -1;
+  m_work_range.second      = -1;
+  m_pool_scratch           = nullptr;
+  m_team_scratch           = nullptr;
+  m_domain_scratch         = nullptr;
+  m_pool_rank              = 0;
+  m_pool_size              = 1;
+  m_team_base              = 0;
+  m_team_rank              = 0;
+  m_team_size              = 1;
+  m_team_alloc             = 1;
+  m_league_rank            = 0;
+  m_league_size            = 1;
+  m_team_rendezvous_step   = 0;
+  m_domain_base            = 0;
+  m_domain_size            = 1;
+  m_domain_rendezvous_step = 0;
 }
 
 int HostThreadTeamData::organize_team(const int team_size) {
@@ -307,5 +342,49 @@ fflush(stdout);
   return w.first;
 }
 
+std::pair<int64_t, int64_t>
+HostThreadTeamData::get_team_work_stealing_chunk() noexcept {
+#ifdef KOKKOS_ENABLE_TASKDAG
+  std::pair<int64_t, int64_t> x(-1, -1);
+
+  if (1 == m_team_size || team_rendezvous()) {
+    // The teams form the work stealing pool, each represented by the
+    // scheduler of its leader: team 't' is led by pool rank 't * m_team_alloc'
+    HostThreadTeamData *const *const pool =
+        (HostThreadTeamData **)(m_pool_scratch + m_pool_members);
+    const int team_alloc = m_team_alloc;
+
+    x = m_range_stealing.next(
+        [pool, team_alloc](int t) -> HostRangeStealing & {
+          return pool[t * team_alloc]->m_range_stealing;
+        },
+        m_league_rank, m_league_size);
+
+    if (0 <= x.first) {
+      x.first *= m_work_chunk;
+      x.second *= m_work_chunk;
+      if (m_work_end < x.second) x.second = m_work_end;
+    }
+
+    if (1 < m_team_size) {
+      // Share the range, the release fences this store
+      m_team_work.first  = x.first;
+      m_team_work.second = x.second;
+
+      team_rendezvous_release();
+    }
+  } else {
+    pair_int_t const volatile &w = team_member(0)->m_team_work;
+
+    x.first  = w.first;
+    x.second = w.second;
+  }
+
+  return x;
+#else
+  return get_work_stealing_chunk();
+#endif
+}
+
 }  // namespace Impl
 }  // namespace Kokkos
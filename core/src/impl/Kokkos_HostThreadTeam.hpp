@@ -52,6 +52,7 @@
 #include <impl/Kokkos_FunctorAdapter.hpp>
 #include <impl/Kokkos_FunctorAnalysis.hpp>
 #include <impl/Kokkos_HostBarrier.hpp>
+#include <impl/Kokkos_HostRangeStealing.hpp>
 
 #include <limits>     // std::numeric_limits
 #include <algorithm>  // std::max
@@ -77,31 +78,38 @@ class HostThreadTeamData {
   enum : int { max_pool_members = 1024 };
   enum : int { max_team_members = 64 };
   enum : int { max_pool_rendezvous = HostBarrier::required_buffer_size };
+  enum : int { max_domain_rendezvous = HostBarrier::required_buffer_size };
   enum : int { max_team_rendezvous = HostBarrier::required_buffer_size };
 
  private:
   // per-thread scratch memory buffer chunks:
   //
-  //   [ pool_members ]     = [ m_pool_members    .. m_pool_rendezvous )
-  //   [ pool_rendezvous ]  = [ m_pool_rendezvous .. m_team_rendezvous )
-  //   [ team_rendezvous ]  = [ m_team_rendezvous .. m_pool_reduce )
-  //   [ pool_reduce ]      = [ m_pool_reduce     .. m_team_reduce )
-  //   [ team_reduce ]      = [ m_team_reduce     .. m_team_shared )
-  //   [ team_shared ]      = [ m_team_shared     .. m_thread_local )
-  //   [ thread_local ]     = [ m_thread_local    .. m_scratch_size )
+  //   [ pool_members ]      = [ m_pool_members      .. m_pool_rendezvous )
+  //   [ pool_rendezvous ]   = [ m_pool_rendezvous   .. m_domain_rendezvous )
+  //   [ domain_rendezvous ] = [ m_domain_rendezvous .. m_team_rendezvous )
+  //   [ team_rendezvous ]   = [ m_team_rendezvous   .. m_pool_reduce )
+  //   [ pool_reduce ]       = [ m_pool_reduce       .. m_team_reduce )
+  //   [ team_reduce ]       = [ m_team_reduce       .. m_team_shared )
+  //   [ team_shared ]       = [ m_team_shared       .. m_thread_local )
+  //   [ thread_local ]      = [ m_thread_local      .. m_scratch_size )
 
   enum : int { m_pool_members = 0 };
   enum : int { m_pool_rendezvous = m_pool_members + max_pool_members };
-  enum : int { m_team_rendezvous = m_pool_rendezvous + max_pool_rendezvous };
+  enum : int { m_domain_rendezvous = m_pool_rendezvous + max_pool_rendezvous };
+  enum : int {
+    m_team_rendezvous = m_domain_rendezvous + max_domain_rendezvous
+  };
   enum : int { m_pool_reduce = m_team_rendezvous + max_team_rendezvous };
 
   using pair_int_t = Kokkos::pair<int64_t, int64_t>;
 
   pair_int_t m_work_range;
+  pair_int_t m_team_work;  // team leader: range shared with the team
   int64_t m_work_end;
-  int64_t* m_scratch;       // per-thread buffer
-  int64_t* m_pool_scratch;  // == pool[0]->m_scratch
-  int64_t* m_team_scratch;  // == pool[ 0 + m_team_base ]->m_scratch
+  int64_t* m_scratch;         // per-thread buffer
+  int64_t* m_pool_scratch;    // == pool[0]->m_scratch
+  int64_t* m_team_scratch;    // == pool[ 0 + m_team_base ]->m_scratch
+  int64_t* m_domain_scratch;  // == pool[ 0 + m_domain_base ]->m_scratch
   int m_pool_rank;
   int m_pool_size;
   int m_team_reduce;
@@ -116,8 +124,14 @@ class HostThreadTeamData {
   int m_league_size;
   int m_work_chunk;
   int m_steal_rank;  // work stealing rank
+  int m_domain_base;
+  int m_domain_size;
   int mutable m_pool_rendezvous_step;
+  int mutable m_domain_rendezvous_step;
   int mutable m_team_rendezvous_step;
+#ifdef KOKKOS_ENABLE_TASKDAG
+  HostRangeStealing m_range_stealing;
+#endif
 
   HostThreadTeamData* team_member(int r) const noexcept {
     return ((HostThreadTeamData**)(m_pool_scratch +
@@ -184,14 +198,41 @@ class HostThreadTeamData {
                                m_pool_size, m_pool_rendezvous_step);
   }
 
+  // Rendezvous of the pool members within this thread's locality domain.
+  // Return true on the first member of the domain, which must then
+  // call domain_rendezvous_release.
+  inline bool domain_rendezvous() const noexcept {
+    if (1 == m_domain_size) return true;
+
+    int* ptr = (int*)(m_domain_scratch + m_domain_rendezvous);
+    HostBarrier::split_arrive(ptr, m_domain_size, m_domain_rendezvous_step);
+    if (m_pool_rank != m_domain_base) {
+      HostBarrier::wait(ptr, m_domain_size, m_domain_rendezvous_step);
+    } else {
+      HostBarrier::split_master_wait(ptr, m_domain_size,
+                                     m_domain_rendezvous_step);
+    }
+
+    return m_pool_rank == m_domain_base;
+  }
+
+  inline void domain_rendezvous_release() const noexcept {
+    if (1 == m_domain_size) return;
+
+    HostBarrier::split_release((int*)(m_domain_scratch + m_domain_rendezvous),
+                               m_domain_size, m_domain_rendezvous_step);
+  }
+
   //----------------------------------------
 
-  constexpr HostThreadTeamData() noexcept
+  HostThreadTeamData() noexcept
       : m_work_range(-1, -1),
+        m_team_work(-1, -1),
         m_work_end(0),
         m_scratch(nullptr),
         m_pool_scratch(nullptr),
         m_team_scratch(nullptr),
+        m_domain_scratch(nullptr),
         m_pool_rank(0),
         m_pool_size(1),
         m_team_reduce(0),
@@ -206,7 +247,10 @@ class HostThreadTeamData {
         m_league_size(1),
         m_work_chunk(0),
         m_steal_rank(0),
+        m_domain_base(0),
+        m_domain_size(1),
         m_pool_rendezvous_step(0),
+        m_domain_rendezvous_step(0),
         m_team_rendezvous_step(0) {}
 
   //----------------------------------------
@@ -216,8 +260,15 @@ class HostThreadTeamData {
   // Requires: called by one thread.
   // Pool members are ordered as "close" - sorted by NUMA and then CORE
   // Each thread is its own team with team_size == 1.
+  // Consecutive members are grouped into locality domains of
+  // hwloc::get_available_threads_per_domain() threads, if the pool
+  // spans more than one domain, and otherwise into domains of one.
   static void organize_pool(HostThreadTeamData* members[], const int size);
 
+  // Override the number of threads per locality domain of subsequently
+  // organized pools, zero restores the detected topology.
+  static void set_pool_domain_size(const int size) noexcept;
+
   // Called by each thread within the pool
   void disband_pool();
 
@@ -246,6 +297,16 @@ class HostThreadTeamData {
     return ((HostThreadTeamData**)(m_pool_scratch + m_pool_members))[r];
   }
 
+  // Pool reductions first join the contributions within each locality
+  // domain into the domain's first member, which is a pool member with
+  // domain_rank() == 0, and then join the first members of the domains.
+  constexpr int domain_rank() const { return m_pool_rank - m_domain_base; }
+  constexpr int domain_size() const { return m_domain_size; }
+
+  HostThreadTeamData* domain_member(int r) const noexcept {
+    return pool_member(m_domain_base + r);
+  }
+
   //----------------------------------------
 
  private:
@@ -396,6 +457,11 @@ fflush(stdout);
     m_steal_rank = m_team_base + m_team_alloc + m_team_size <= m_pool_size
                        ? m_team_base + m_team_alloc
                        : 0;
+
+#ifdef KOKKOS_ENABLE_TASKDAG
+    m_range_stealing.reset(m_work_range.first, m_work_range.second, num,
+                           m_pool_rank);
+#endif
   }
 
   std::pair<int64_t, int64_t> get_work_partition() noexcept {
@@ -420,6 +486,46 @@ fflush(stdout);
 
     return x;
   }
+
+  //----------------------------------------
+  // Get a range of league ranks within [ 0 .. m_work_end ) of at most one
+  // chunk for the whole team.  Must be called by every member of the team.
+  // The team leader claims the chunk from the team's work stealing deque,
+  // stealing half of the remaining work of a randomly selected team when the
+  // deque is empty, while the other members wait in the team rendezvous that
+  // separates consecutive league ranks.  Returns (-1,-1) when all work has
+  // been claimed.  Requires a pool rendezvous after 'set_work_partition'.
+  std::pair<int64_t, int64_t> get_team_work_stealing_chunk() noexcept;
+
+  //----------------------------------------
+  // Get a range of work within [ 0 .. m_work_end ) of at most one chunk
+  // from this thread's work stealing deque, stealing half of the remaining
+  // work of a randomly selected pool member when the deque is empty.
+  // Requires a pool rendezvous after 'set_work_partition'.
+  // Only valid for teams of one thread, i.e. range policies.
+
+  std::pair<int64_t, int64_t> get_work_stealing_range() noexcept {
+#ifdef KOKKOS_ENABLE_TASKDAG
+    HostThreadTeamData* const* const pool =
+        (HostThreadTeamData**)(m_pool_scratch + m_pool_members);
+
+    std::pair<int64_t, int64_t> x = m_range_stealing.next(
+        [pool](int r) -> HostRangeStealing& {
+          return pool[r]->m_range_stealing;
+        },
+        m_pool_rank, m_pool_size);
+
+    if (0 <= x.first) {
+      x.first *= m_work_chunk;
+      x.second *= m_work_chunk;
+      if (m_work_end < x.second) x.second = m_work_end;
+    }
+
+    return x;
+#else
+    return get_work_stealing_chunk();
+#endif
+  }
 };
 
 //----------------------------------------------------------------------------
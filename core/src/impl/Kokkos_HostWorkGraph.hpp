@@ -0,0 +1,196 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_IMPL_HOSTWORKGRAPH_HPP
+#define KOKKOS_IMPL_HOSTWORKGRAPH_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_Atomic.hpp>
+#include <impl/Kokkos_Spinwait.hpp>
+
+#include <cstdint>
+#include <memory>
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+// class HostWorkGraphQueues
+//
+// Distributed ready lists for the host implementations of WorkGraphPolicy.
+//
+// Each thread of the pool owns a ready list, a LIFO stack linked through
+// a 'next' index per work item.  A work item that becomes ready when a
+// thread completes its last predecessor is pushed onto that thread's list,
+// so it is executed next by the thread that just produced its input.
+// The work items ready before execution begins are taken from the
+// policy's shared queue.  A thread without work pops the head of the list
+// of a randomly selected thread.
+//
+// Each work item is pushed exactly once per execution, so removing the
+// head of a list with a compare-and-swap cannot suffer from the ABA
+// problem even when owner and thieves race for it.
+//
+// Termination is detected as in HostRangeStealing: threads subtract the
+// number of work items they executed from a count of remaining work only
+// once they run out of work, so the count is not touched in the common path.
+class HostWorkGraphQueues {
+ private:
+  enum : std::int32_t { empty = -1 };
+
+  // One list per cache line
+  struct list_type {
+    std::int32_t head;
+    std::uint32_t seed;
+    char pad[64 - sizeof(std::int32_t) - sizeof(std::uint32_t)];
+  };
+
+  std::unique_ptr<std::int32_t[]> m_next;
+  std::unique_ptr<list_type[]> m_lists;
+  std::int64_t m_remaining;
+  int m_pool_size;
+
+  void push(int const rank, std::int32_t const w) noexcept {
+    std::int32_t volatile* const head = &m_lists[rank].head;
+
+    for (std::int32_t h = *head;;) {
+      m_next[w]              = h;
+      const std::int32_t old = Kokkos::atomic_compare_exchange(head, h, w);
+      if (old == h) return;
+      h = old;
+    }
+  }
+
+  std::int32_t pop(int const rank) noexcept {
+    std::int32_t volatile* const head = &m_lists[rank].head;
+    std::int32_t volatile* const next = m_next.get();
+
+    for (std::int32_t h = *head; empty != h;) {
+      const std::int32_t old =
+          Kokkos::atomic_compare_exchange(head, h, next[h]);
+      if (old == h) return h;
+      h = old;
+    }
+    return empty;
+  }
+
+  std::int32_t steal(int const rank) noexcept {
+    if (m_pool_size < 2) return empty;
+
+    // xorshift32
+    std::uint32_t& seed = m_lists[rank].seed;
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    const int victim = int(seed % std::uint32_t(m_pool_size - 1));
+
+    return pop(victim < rank ? victim : victim + 1);
+  }
+
+ public:
+  HostWorkGraphQueues(std::int32_t const num_work, int const pool_size)
+      : m_next(new std::int32_t[num_work > 0 ? num_work : 1]),
+        m_lists(new list_type[pool_size]),
+        m_remaining(num_work),
+        m_pool_size(pool_size) {
+    for (int i = 0; i < pool_size; ++i) {
+      m_lists[i].head = empty;
+      m_lists[i].seed = 2654435761u * std::uint32_t(i + 1);
+    }
+  }
+
+  HostWorkGraphQueues(HostWorkGraphQueues const&) = delete;
+  HostWorkGraphQueues& operator=(HostWorkGraphQueues const&) = delete;
+
+  // Execute work items of 'policy' with 'exec(w)' on the thread with pool
+  // rank 'rank' until all work items of the graph have been executed.
+  // Must be called by every thread of the pool.
+  template <class Policy, class Exec>
+  void run(Policy const& policy, Exec const& exec, int const rank) noexcept {
+    std::int64_t executed = 0;
+
+    for (std::uint32_t spin = 0;;) {
+      std::int32_t w = pop(rank);
+
+      if (empty == w) {
+        // Work items that were ready before execution began;
+        // END_TOKEN or COMPLETED_TOKEN once they are all claimed.
+        w = policy.pop_work();
+      }
+
+      if (w < 0) {
+        if (executed) {
+          Kokkos::atomic_fetch_sub(&m_remaining, executed);
+          executed = 0;
+        }
+        if (0 == *((std::int64_t volatile*)&m_remaining)) return;
+
+        w = steal(rank);
+
+        if (empty == w) {
+          host_thread_yield(++spin, WaitMode::ACTIVE);
+          continue;
+        }
+      }
+
+      spin = 0;
+
+      exec(w);
+
+      policy.completed_work(w, [this, rank](std::int32_t j) { push(rank, j); });
+
+      ++executed;
+    }
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+#endif /* #ifndef KOKKOS_IMPL_HOSTWORKGRAPH_HPP */
@@ -80,10 +80,15 @@ struct LockBasedLIFOCommon {
   OwningRawPtr<node_type> m_head = (node_type*)EndTag;
 
   KOKKOS_INLINE_FUNCTION
-  bool _try_push_node(node_type& node) {
-    KOKKOS_EXPECTS(!node.is_enqueued());
+  bool _try_push_node(node_type& node) { return _try_push_chain(node, node); }
 
-    auto* volatile& next = LinkedListNodeAccess::next_ptr(node);
+  // Push the nodes from 'first' to 'last', already linked to each other
+  // through their next pointers, with a single compare exchange on the head
+  KOKKOS_INLINE_FUNCTION
+  bool _try_push_chain(node_type& first, node_type& last) {
+    KOKKOS_EXPECTS(!last.is_enqueued());
+
+    auto* volatile& next = LinkedListNodeAccess::next_ptr(last);
 
     // store the head of the queue in a local variable
     auto* old_head = m_head;
@@ -110,7 +115,7 @@ struct LockBasedLIFOCommon {
       //     m_head = &node;
       //   }
       //   old_head = m_head;
-      old_head = ::Kokkos::atomic_compare_exchange(&m_head, old_head, &node);
+      old_head = ::Kokkos::atomic_compare_exchange(&m_head, old_head, &first);
 
       if (old_head_tmp == old_head) return true;
     }
@@ -120,7 +125,7 @@ struct LockBasedLIFOCommon {
 
     // TODO @tasking @memory_order DSH this should have a memory order and not a
     // memory fence
-    LinkedListNodeAccess::mark_as_not_enqueued(node);
+    LinkedListNodeAccess::mark_as_not_enqueued(last);
 
     // fence to emulate acquire semantics on next
     // Do not proceed until 'next' has been stored.
@@ -269,6 +274,24 @@ class LockBasedLIFO : private LockBasedLIFOCommon<T> {
     // Just forward to the lvalue version
     return push(node);
   }
+
+  /// Push `n_nodes` nodes at once, so that `nodes[0]` is popped first.  The
+  /// nodes are linked to each other privately and the whole chain is
+  /// published with a single compare exchange on the head of the queue.
+  template <class NodePtr>
+  KOKKOS_INLINE_FUNCTION bool push_n(NodePtr const nodes[], int n_nodes) {
+    if (n_nodes < 1) return true;
+    for (int i = 0; i < n_nodes - 1; ++i) {
+      node_type& node = *nodes[i];
+      KOKKOS_EXPECTS(!node.is_enqueued());
+      LinkedListNodeAccess::next_ptr(node) =
+          static_cast<node_type*>(nodes[i + 1]);
+    }
+    while (!this->_try_push_chain(*nodes[0], *nodes[n_nodes - 1])) {
+      /* retry until success */
+    }
+    return true;
+  }
 };
 
 /** @brief A Multiple Producer, Single Consumer Queue with some special
@@ -334,6 +357,23 @@ class SingleConsumeOperationLIFO : private LockBasedLIFOCommon<T> {
     // Ensures: (return value is true) || (node.is_enqueued() == false);
   }
 
+  // Call `f` on each node in the queue without removing it.  Nodes are only
+  // ever pushed onto the head, so the chain from a snapshot of the head stays
+  // intact; the caller must ensure the queue is not consumed concurrently.
+  template <class Function>
+  KOKKOS_INLINE_FUNCTION void for_each(Function&& f) {
+    // Acquire pairs with the fence before the compare exchange of the head
+    // in '_try_push_chain', so the links of the chain are visible.
+    node_type* node =
+        Impl::atomic_load(&(this->m_head), Impl::memory_order_acquire);
+    if (node == (node_type*)ConsumedTag) return;
+    while (node != (node_type*)base_t::EndTag) {
+      auto* const next = LinkedListNodeAccess::next_ptr(*node);
+      f(*static_cast<T*>(node));
+      node = next;
+    }
+  }
+
   template <class Function>
   KOKKOS_INLINE_FUNCTION void consume(Function&& f) {
     auto* const consumed_tag = (node_type*)ConsumedTag;
@@ -0,0 +1,471 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <Kokkos_Macros.hpp>
+
+#ifdef KOKKOS_ENABLE_MMAPSPACE
+
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <Kokkos_MmapSpace.hpp>
+#include <Kokkos_Atomic.hpp>
+#include <impl/Kokkos_Error.hpp>
+#include <impl/Kokkos_Tools.hpp>
+
+#if defined(MAP_ANONYMOUS)
+#define KOKKOS_IMPL_MMAP_SPACE_ANON (MAP_PRIVATE | MAP_ANONYMOUS)
+#else
+#define KOKKOS_IMPL_MMAP_SPACE_ANON (MAP_PRIVATE | MAP_ANON)
+#endif
+
+// Reserving the address range of a file larger than the physical memory
+// must not be charged against the swap space.
+#if defined(MAP_NORESERVE)
+#define KOKKOS_IMPL_MMAP_SPACE_RESERVE \
+  (KOKKOS_IMPL_MMAP_SPACE_ANON | MAP_NORESERVE)
+#else
+#define KOKKOS_IMPL_MMAP_SPACE_RESERVE KOKKOS_IMPL_MMAP_SPACE_ANON
+#endif
+
+/*--------------------------------------------------------------------------*/
+
+namespace {
+
+size_t mmap_space_page_size() {
+  static const size_t page = size_t(sysconf(_SC_PAGESIZE));
+  return page;
+}
+
+size_t mmap_space_prefix_size(const size_t header_size) {
+  const size_t page = mmap_space_page_size();
+  return (header_size + page - 1) & ~(page - 1);
+}
+
+// ReadWrite mappings which Kokkos::fence writes back to their files.
+struct MmapSpaceMapping {
+  void* ptr;
+  size_t size;
+};
+
+std::vector<MmapSpaceMapping> s_mmap_space_mappings;
+std::mutex s_mmap_space_mutex;
+int s_mmap_space_count = 0;
+
+void mmap_space_register(void* const ptr, const size_t size) {
+  std::lock_guard<std::mutex> lock(s_mmap_space_mutex);
+  s_mmap_space_mappings.push_back(MmapSpaceMapping{ptr, size});
+  s_mmap_space_count = int(s_mmap_space_mappings.size());
+}
+
+void mmap_space_unregister(void* const ptr) {
+  std::lock_guard<std::mutex> lock(s_mmap_space_mutex);
+  auto const it = std::find_if(
+      s_mmap_space_mappings.begin(), s_mmap_space_mappings.end(),
+      [ptr](const MmapSpaceMapping& m) { return m.ptr == ptr; });
+  if (it != s_mmap_space_mappings.end()) s_mmap_space_mappings.erase(it);
+  s_mmap_space_count = int(s_mmap_space_mappings.size());
+}
+
+void mmap_space_error(const char* what,
+                      const Kokkos::Experimental::MmapSpace& space,
+                      const size_t size, const int err) {
+  std::ostringstream msg;
+  msg << "Kokkos::Experimental::MmapSpace::allocate( " << size << " ) of '"
+      << space.path() << "' at offset " << space.offset() << " FAILED: "
+      << what;
+  if (err) msg << " ( " << strerror(err) << " )";
+  Kokkos::Impl::throw_runtime_exception(msg.str());
+}
+
+}  // namespace
+
+/*--------------------------------------------------------------------------*/
+
+namespace Kokkos {
+namespace Experimental {
+
+MmapSpace::MmapSpace()
+    : m_path(), m_mode(Mode::ReadWrite), m_advice(Advice::Normal),
+      m_offset(0) {}
+
+MmapSpace::MmapSpace(const std::string &arg_path, const Mode arg_mode,
+                     const Advice arg_advice, const size_t arg_offset)
+    : m_path(arg_path), m_mode(arg_mode), m_advice(arg_advice),
+      m_offset(arg_offset) {
+  if (m_offset % mmap_space_page_size()) {
+    std::ostringstream msg;
+    msg << "Kokkos::Experimental::MmapSpace offset " << m_offset
+        << " of '" << m_path << "' is not a multiple of the page size "
+        << mmap_space_page_size();
+    Kokkos::Impl::throw_runtime_exception(msg.str());
+  }
+}
+
+void *MmapSpace::allocate(const size_t arg_alloc_size) const {
+  return allocate("[unlabeled]", arg_alloc_size);
+}
+void *MmapSpace::allocate(const char *arg_label, const size_t arg_alloc_size,
+                          const size_t arg_logical_size) const {
+  void *const ptr = impl_allocate_mapped(nullptr, 0, arg_alloc_size);
+
+  if (ptr && Kokkos::Profiling::profileLibraryLoaded()) {
+    const size_t reported_size =
+        (arg_logical_size > 0) ? arg_logical_size : arg_alloc_size;
+    Kokkos::Profiling::allocateData(
+        Kokkos::Profiling::make_space_handle(name()), arg_label, ptr,
+        reported_size);
+  }
+
+  return ptr;
+}
+
+void MmapSpace::deallocate(void *const arg_alloc_ptr,
+                           const size_t arg_alloc_size) const {
+  deallocate("[unlabeled]", arg_alloc_ptr, arg_alloc_size);
+}
+void MmapSpace::deallocate(const char *arg_label, void *const arg_alloc_ptr,
+                           const size_t arg_alloc_size,
+                           const size_t arg_logical_size) const {
+  if (arg_alloc_ptr && Kokkos::Profiling::profileLibraryLoaded()) {
+    const size_t reported_size =
+        (arg_logical_size > 0) ? arg_logical_size : arg_alloc_size;
+    Kokkos::Profiling::deallocateData(
+        Kokkos::Profiling::make_space_handle(name()), arg_label, arg_alloc_ptr,
+        reported_size);
+  }
+  impl_deallocate_mapped(nullptr, arg_alloc_ptr, 0, arg_alloc_size);
+}
+
+void *MmapSpace::impl_allocate_mapped(const char *arg_label,
+                                      const size_t arg_header_size,
+                                      const size_t arg_alloc_size) const {
+  const size_t prefix = mmap_space_prefix_size(arg_header_size);
+
+  if (prefix + arg_alloc_size == 0) return nullptr;
+
+  const bool file = !m_path.empty() && arg_alloc_size;
+
+  int fd = -1;
+
+  if (file) {
+    fd = open(m_path.c_str(),
+              m_mode == Mode::ReadWrite ? (O_RDWR | O_CREAT) : O_RDONLY, 0644);
+    if (fd < 0) mmap_space_error("open", *this, arg_alloc_size, errno);
+
+    struct stat st;
+    if (fstat(fd, &st)) {
+      const int err = errno;
+      close(fd);
+      mmap_space_error("fstat", *this, arg_alloc_size, err);
+    }
+
+    // Pages beyond the end of the file would fault with SIGBUS.
+    const size_t required = m_offset + arg_alloc_size;
+    if (size_t(st.st_size) < required) {
+      if (m_mode != Mode::ReadWrite) {
+        close(fd);
+        mmap_space_error("file is too short", *this, arg_alloc_size, 0);
+      }
+      if (ftruncate(fd, off_t(required))) {
+        const int err = errno;
+        close(fd);
+        mmap_space_error("ftruncate", *this, arg_alloc_size, err);
+      }
+    }
+  }
+
+  // Reserve the header pages and the data together so that the data follows
+  // the header and begins at a page boundary.
+  void *const base =
+      mmap(nullptr, prefix + arg_alloc_size,
+           file ? PROT_NONE : (PROT_READ | PROT_WRITE),
+           file ? KOKKOS_IMPL_MMAP_SPACE_RESERVE : KOKKOS_IMPL_MMAP_SPACE_ANON,
+           -1, 0);
+
+  if (base == MAP_FAILED) {
+    const int err = errno;
+    if (0 <= fd) close(fd);
+    mmap_space_error("mmap", *this, arg_alloc_size, err);
+  }
+
+  char *const data = static_cast<char *>(base) + prefix;
+
+  if (file) {
+    const int prot = m_mode == Mode::ReadOnly ? PROT_READ
+                                               : (PROT_READ | PROT_WRITE);
+    const int flags = m_mode == Mode::ReadWrite ? MAP_SHARED : MAP_PRIVATE;
+
+    int err = 0;
+    if (prefix && mprotect(base, prefix, PROT_READ | PROT_WRITE)) err = errno;
+    if (!err && MAP_FAILED == mmap(data, arg_alloc_size, prot,
+                                   flags | MAP_FIXED, fd, off_t(m_offset))) {
+      err = errno;
+    }
+    // The mapping keeps a reference to the file.
+    close(fd);
+
+    if (err) {
+      munmap(base, prefix + arg_alloc_size);
+      mmap_space_error("mmap", *this, arg_alloc_size, err);
+    }
+
+    int advice = MADV_NORMAL;
+    switch (m_advice) {
+      case Advice::Sequential: advice = MADV_SEQUENTIAL; break;
+      case Advice::Random: advice = MADV_RANDOM; break;
+      case Advice::WillNeed: advice = MADV_WILLNEED; break;
+      default: break;
+    }
+    if (advice != MADV_NORMAL) madvise(data, arg_alloc_size, advice);
+
+    if (m_mode == Mode::ReadWrite) mmap_space_register(data, arg_alloc_size);
+  }
+
+  (void)arg_label;
+
+  return data - arg_header_size;
+}
+
+void MmapSpace::impl_deallocate_mapped(const char *arg_label,
+                                       void *const arg_alloc_ptr,
+                                       const size_t arg_header_size,
+                                       const size_t arg_alloc_size) const {
+  if (!arg_alloc_ptr) return;
+
+  const size_t prefix = mmap_space_prefix_size(arg_header_size);
+
+  char *const data = static_cast<char *>(arg_alloc_ptr) + arg_header_size;
+
+  if (!m_path.empty() && arg_alloc_size && m_mode == Mode::ReadWrite) {
+    mmap_space_unregister(data);
+    msync(data, arg_alloc_size, MS_SYNC);
+  }
+
+  munmap(data - prefix, prefix + arg_alloc_size);
+
+  (void)arg_label;
+}
+
+void MmapSpace::impl_sync_all() {
+  if (0 == Kokkos::volatile_load(&s_mmap_space_count)) return;
+
+  // Write back outside of the lock so that a blocking msync does not hold
+  // up allocations.  A mapping released meanwhile is synchronized by its
+  // deallocation; msync of its unmapped range merely fails.
+  std::vector<MmapSpaceMapping> mappings;
+  {
+    std::lock_guard<std::mutex> lock(s_mmap_space_mutex);
+    mappings = s_mmap_space_mappings;
+  }
+  for (auto const &m : mappings) {
+    msync(m.ptr, m.size, MS_SYNC);
+  }
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+#ifdef KOKKOS_DEBUG
+SharedAllocationRecord<void, void> SharedAllocationRecord<
+    Kokkos::Experimental::MmapSpace, void>::s_root_record;
+#endif
+
+void SharedAllocationRecord<Kokkos::Experimental::MmapSpace, void>::deallocate(
+    SharedAllocationRecord<void, void> *arg_rec) {
+  delete static_cast<SharedAllocationRecord *>(arg_rec);
+}
+
+SharedAllocationRecord<Kokkos::Experimental::MmapSpace,
+                       void>::~SharedAllocationRecord()
+#if defined( \
+    KOKKOS_IMPL_INTEL_WORKAROUND_NOEXCEPT_SPECIFICATION_VIRTUAL_FUNCTION)
+    noexcept
+#endif
+{
+  if (Kokkos::Profiling::profileLibraryLoaded()) {
+    Kokkos::Profiling::deallocateData(
+        Kokkos::Profiling::make_space_handle(
+            Kokkos::Experimental::MmapSpace::name()),
+        RecordBase::m_alloc_ptr->label(), RecordBase::m_alloc_ptr, size());
+  }
+
+  m_space.impl_deallocate_mapped(
+      RecordBase::m_alloc_ptr->label(),
+      SharedAllocationRecord<void, void>::m_alloc_ptr,
+      sizeof(SharedAllocationHeader),
+      SharedAllocationRecord<void, void>::m_alloc_size -
+          sizeof(SharedAllocationHeader));
+}
+
+SharedAllocationRecord<Kokkos::Experimental::MmapSpace, void>::
+    SharedAllocationRecord(
+        const Kokkos::Experimental::MmapSpace &arg_space,
+        const std::string &arg_label, const size_t arg_alloc_size,
+        const SharedAllocationRecord<void, void>::function_type arg_dealloc)
+    // Pass through allocated [ SharedAllocationHeader , user_memory ]
+    // Pass through deallocation function
+    : SharedAllocationRecord<void, void>(
+#ifdef KOKKOS_DEBUG
+          &SharedAllocationRecord<Kokkos::Experimental::MmapSpace,
+                                  void>::s_root_record,
+#endif
+          reinterpret_cast<SharedAllocationHeader *>(
+              arg_space.impl_allocate_mapped(arg_label.c_str(),
+                                             sizeof(SharedAllocationHeader),
+                                             arg_alloc_size)),
+          sizeof(SharedAllocationHeader) + arg_alloc_size, arg_dealloc),
+      m_space(arg_space) {
+  if (Kokkos::Profiling::profileLibraryLoaded()) {
+    Kokkos::Profiling::allocateData(
+        Kokkos::Profiling::make_space_handle(
+            Kokkos::Experimental::MmapSpace::name()),
+        arg_label, RecordBase::m_alloc_ptr, arg_alloc_size);
+  }
+
+  // Fill in the Header information
+  RecordBase::m_alloc_ptr->m_record =
+      static_cast<SharedAllocationRecord<void, void> *>(this);
+
+  RecordBase::m_alloc_ptr->set_label(arg_label);
+}
+
+//----------------------------------------------------------------------------
+
+void *SharedAllocationRecord<Kokkos::Experimental::MmapSpace, void>::
+    allocate_tracked(const Kokkos::Experimental::MmapSpace &arg_space,
+                     const std::string &arg_alloc_label,
+                     const size_t arg_alloc_size) {
+  if (!arg_alloc_size) return (void *)0;
+
+  SharedAllocationRecord *const r =
+      allocate(arg_space, arg_alloc_label, arg_alloc_size);
+
+  RecordBase::increment(r);
+
+  return r->data();
+}
+
+void SharedAllocationRecord<Kokkos::Experimental::MmapSpace,
+                            void>::deallocate_tracked(void *const
+                                                          arg_alloc_ptr) {
+  if (arg_alloc_ptr != 0) {
+    SharedAllocationRecord *const r = get_record(arg_alloc_ptr);
+
+    RecordBase::decrement(r);
+  }
+}
+
+void *SharedAllocationRecord<Kokkos::Experimental::MmapSpace, void>::
+    reallocate_tracked(void *const arg_alloc_ptr, const size_t arg_alloc_size) {
+  SharedAllocationRecord *const r_old = get_record(arg_alloc_ptr);
+  SharedAllocationRecord *const r_new =
+      allocate(r_old->m_space, r_old->get_label(), arg_alloc_size);
+
+  Kokkos::Impl::DeepCopy<Kokkos::Experimental::MmapSpace,
+                         Kokkos::Experimental::MmapSpace>(
+      r_new->data(), r_old->data(), std::min(r_old->size(), r_new->size()));
+
+  RecordBase::increment(r_new);
+  RecordBase::decrement(r_old);
+
+  return r_new->data();
+}
+
+SharedAllocationRecord<Kokkos::Experimental::MmapSpace, void>
+    *SharedAllocationRecord<Kokkos::Experimental::MmapSpace, void>::get_record(
+        void *alloc_ptr) {
+  using Header = SharedAllocationHeader;
+  using RecordMmap =
+      SharedAllocationRecord<Kokkos::Experimental::MmapSpace, void>;
+
+  SharedAllocationHeader const *const head =
+      alloc_ptr ? Header::get_header(alloc_ptr) : (SharedAllocationHeader *)0;
+  RecordMmap *const record =
+      head ? static_cast<RecordMmap *>(head->m_record) : (RecordMmap *)0;
+
+  if (!alloc_ptr || record->m_alloc_ptr != head) {
+    Kokkos::Impl::throw_runtime_exception(std::string(
+        "Kokkos::Impl::SharedAllocationRecord< Kokkos::Experimental::MmapSpace "
+        ", void >::get_record ERROR"));
+  }
+
+  return record;
+}
+
+// Iterate records to print orphaned memory ...
+void SharedAllocationRecord<Kokkos::Experimental::MmapSpace, void>::
+    print_records(std::ostream &s, const Kokkos::Experimental::MmapSpace &,
+                  bool detail) {
+#ifdef KOKKOS_DEBUG
+  SharedAllocationRecord<void, void>::print_host_accessible_records(
+      s, "MmapSpace", &s_root_record, detail);
+#else
+  (void)s;
+  (void)detail;
+  throw_runtime_exception(
+      "SharedAllocationRecord<MmapSpace>::print_records"
+      " only works with KOKKOS_DEBUG enabled");
+#endif
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
@@ -116,6 +116,10 @@ struct MultipleTaskQueueTeamEntry {
 
   task_base_type* m_failed_heads[NumPriorities][2];
 
+  // Where the team associated with this entry runs, and the tasks it stole
+  TaskQueueLocality m_locality;
+  TaskStealCounts m_steals;
+
   KOKKOS_INLINE_FUNCTION
   task_base_type*& failed_head_for(runnable_task_base_type const& task) {
     return m_failed_heads[int(task.get_priority())][int(task.get_task_type())];
@@ -176,6 +180,24 @@ struct MultipleTaskQueueTeamEntry {
     return return_value;
   }
 
+  KOKKOS_INLINE_FUNCTION
+  TaskQueueLocality const& locality() const noexcept { return m_locality; }
+
+  KOKKOS_INLINE_FUNCTION
+  void set_locality(TaskQueueLocality const& locality) noexcept {
+    m_locality = locality;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  TaskStealCounts const& steal_counts() const noexcept { return m_steals; }
+
+  KOKKOS_INLINE_FUNCTION
+  void count_steal(int distance) noexcept {
+    Kokkos::atomic_increment(distance < TaskQueueLocality::Remote
+                                 ? &m_steals.local
+                                 : &m_steals.remote);
+  }
+
   KOKKOS_INLINE_FUNCTION
   OptionalRef<task_base_type> pop_ready_task() {
     auto return_value = OptionalRef<task_base_type>{};
@@ -291,6 +313,23 @@ struct MultipleTaskQueueTeamEntry {
     // the use of move semantics)
     flush_failed_insertions((int)priority, (int)task_type);
   }
+
+  template <class TeamSchedulerInfo, class ExecutionSpace, class MemorySpace,
+            class MemoryPool>
+  KOKKOS_INLINE_FUNCTION void do_schedule_runnable_batch(
+      MultipleTaskQueue<ExecutionSpace, MemorySpace, TaskQueueTraits,
+                        MemoryPool>& queue,
+      TaskNode<TaskQueueTraits>* const tasks[], int32_t n_tasks,
+      TeamSchedulerInfo const& info) {
+    auto const& first = tasks[0]->as_runnable_task();
+    auto& team_queue  = team_queue_for(first);
+    auto priority     = first.get_priority();
+    auto task_type    = first.get_task_type();
+
+    queue.schedule_ready_batch_to_queue(tasks, n_tasks, team_queue, info);
+
+    flush_failed_insertions((int)priority, (int)task_type);
+  }
 };
 
 //----------------------------------------------------------------------------
@@ -408,6 +447,8 @@ class MultipleTaskQueue final
   KOKKOS_FUNCTION
   void schedule_runnable(runnable_task_base_type&& task,
                          team_scheduler_info_type const& info) {
+    // The ready queue is chosen by priority, so raise it first
+    this->inherit_waiting_priority(task);
     auto team_association = info.team_association;
     // Should only not be assigned if this is a host spawn...
     if (team_association == team_scheduler_info_type::NoAssociatedTeam) {
@@ -419,6 +460,18 @@ class MultipleTaskQueue final
     // the use of move semantics)
   }
 
+  // All of the tasks in a batch have the same priority and task type
+  KOKKOS_FUNCTION
+  void schedule_runnable_batch(task_base_type* const tasks[], int32_t n_tasks,
+                               team_scheduler_info_type const& info) {
+    auto team_association = info.team_association;
+    if (team_association == team_scheduler_info_type::NoAssociatedTeam) {
+      team_association = 0;
+    }
+    this->vla_value_at(team_association)
+        .do_schedule_runnable_batch(*this, tasks, n_tasks, info);
+  }
+
   KOKKOS_FUNCTION
   OptionalRef<task_base_type> pop_ready_task(
       team_scheduler_info_type const& info) {
@@ -439,13 +492,24 @@ class MultipleTaskQueue final
     return_value = team_queue_info.pop_ready_task();
 
     if (!return_value) {
-      // loop through the rest of the teams and try to steal
-      for (auto isteal = (team_association + 1) % this->n_queues();
-           isteal != team_association;
-           isteal = (isteal + 1) % this->n_queues()) {
-        return_value = this->vla_value_at(isteal).try_to_steal_ready_task();
-        if (return_value) {
-          break;
+      // loop through the rest of the teams and try to steal, nearest teams
+      // first: those sharing this team's core, then its last level cache,
+      // then its package, and finally the remote or unknown ones
+      auto const& locality = team_queue_info.locality();
+      for (int distance = locality.is_known() ? TaskQueueLocality::SameCore
+                                              : TaskQueueLocality::Remote;
+           distance <= TaskQueueLocality::Remote && !return_value;
+           ++distance) {
+        for (auto isteal = (team_association + 1) % this->n_queues();
+             isteal != team_association;
+             isteal = (isteal + 1) % this->n_queues()) {
+          auto& victim = this->vla_value_at(isteal);
+          if (locality.distance(victim.locality()) != distance) continue;
+          return_value = victim.try_to_steal_ready_task();
+          if (return_value) {
+            team_queue_info.count_steal(distance);
+            break;
+          }
         }
       }
 
@@ -455,6 +519,27 @@ class MultipleTaskQueue final
     return return_value;
   }
 
+  // Record where the team of `info` runs; must happen-before any other team
+  // steals using this queue
+  KOKKOS_INLINE_FUNCTION
+  void set_team_locality(team_scheduler_info_type const& info,
+                         TaskQueueLocality const& locality) noexcept {
+    KOKKOS_EXPECTS(info.team_association !=
+                   team_scheduler_info_type::NoAssociatedTeam);
+    this->vla_value_at(info.team_association).set_locality(locality);
+  }
+
+  // Tasks stolen by all teams so far
+  KOKKOS_INLINE_FUNCTION
+  TaskStealCounts steal_counts() const noexcept {
+    TaskStealCounts counts;
+    for (int iteam = 0; iteam < int(n_queues()); ++iteam) {
+      counts.local += this->vla_value_at(iteam).steal_counts().local;
+      counts.remote += this->vla_value_at(iteam).steal_counts().remote;
+    }
+    return counts;
+  }
+
   // TODO @tasking @generalization DSH make this a property-based customization
   // point
   KOKKOS_INLINE_FUNCTION
@@ -44,12 +44,57 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <cstring>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#if defined(KOKKOS_ENABLE_COMPACT_ALLOCATION_HEADER)
+#include <unordered_set>
+#endif
+
 namespace Kokkos {
 namespace Impl {
 
 KOKKOS_THREAD_LOCAL int SharedAllocationRecord<void, void>::t_tracking_enabled =
     1;
 
+#if defined(KOKKOS_ENABLE_COMPACT_ALLOCATION_HEADER)
+namespace {
+
+/* Interned labels of compact allocation headers.  The table is never
+ * destroyed since allocations may outlive static destruction.  Elements of
+ * an unordered_set are not moved by insertions.
+ */
+std::unordered_set<std::string>& shared_allocation_labels() {
+  static std::unordered_set<std::string>* const labels =
+      new std::unordered_set<std::string>();
+  return *labels;
+}
+
+int s_shared_allocation_labels_lock = 0;
+
+}  // namespace
+
+void SharedAllocationHeader::set_label(const std::string& arg_label) {
+  const std::string label =
+      arg_label.size() < maximum_label_length
+          ? arg_label
+          : arg_label.substr(0, maximum_label_length - 1);
+
+  while (0 != Kokkos::atomic_compare_exchange(&s_shared_allocation_labels_lock,
+                                              0, 1))
+    ;
+  m_label = shared_allocation_labels().insert(label).first->c_str();
+  Kokkos::atomic_exchange(&s_shared_allocation_labels_lock, 0);
+}
+#else
+void SharedAllocationHeader::set_label(const std::string& arg_label) {
+  strncpy(m_label, arg_label.c_str(), maximum_label_length);
+  // Set last element zero, in case c_str is too long
+  m_label[maximum_label_length - 1] = (char)0;
+}
+#endif
+
 #ifdef KOKKOS_DEBUG
 bool SharedAllocationRecord<void, void>::is_sane(
     SharedAllocationRecord<void, void>* arg_record) {
@@ -288,7 +333,7 @@ SharedAllocationRecord<void, void>* SharedAllocationRecord<
     fprintf(stderr,
             "Kokkos::Impl::SharedAllocationRecord '%s' failed decrement count "
             "= %d\n",
-            arg_record->m_alloc_ptr->m_label, old_count);
+            arg_record->m_alloc_ptr->label(), old_count);
     fflush(stderr);
     Kokkos::Impl::throw_runtime_exception(
         "Kokkos::Impl::SharedAllocationRecord failed decrement count");
@@ -326,7 +371,7 @@ void SharedAllocationRecord<void, void>::print_host_accessible_records(
                reinterpret_cast<uintptr_t>(r->m_next),
                reinterpret_cast<uintptr_t>(r->m_alloc_ptr), r->m_alloc_size,
                r->use_count(), reinterpret_cast<uintptr_t>(r->m_dealloc),
-               r->m_alloc_ptr->m_label);
+               r->m_alloc_ptr->label());
       s << buffer;
       r = r->m_next;
     } while (r != root);
@@ -344,7 +389,7 @@ void SharedAllocationRecord<void, void>::print_host_accessible_records(
 
         snprintf(buffer, 256, format_string, space_name,
                  reinterpret_cast<uintptr_t>(r->data()), r->size(),
-                 r->m_alloc_ptr->m_label);
+                 r->m_alloc_ptr->label());
       } else {
         snprintf(buffer, 256, "%s [ 0 + 0 ]\n", space_name);
       }
@@ -365,3 +410,213 @@ void SharedAllocationRecord<void, void>::print_host_accessible_records(
 
 } /* namespace Impl */
 } /* namespace Kokkos */
+
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace {
+
+/* Memory usage counters, one row per memory space and in each row one
+ * column for all allocations followed by one per tracked label prefix.
+ * Space names are claimed with a compare-exchange and prefixes are
+ * appended under a lock and published by incrementing their count, so
+ * that the counting in allocation and deallocation never locks.
+ */
+enum : int { memory_usage_max_spaces = 16, memory_usage_max_prefixes = 31 };
+
+struct MemoryUsageCounter {
+  size_t live_bytes;
+  size_t peak_bytes;
+  size_t live_count;
+  size_t allocation_count;
+};
+
+const char* s_memory_usage_spaces[memory_usage_max_spaces] = {};
+std::string s_memory_usage_prefixes[memory_usage_max_prefixes];
+int s_memory_usage_prefix_count = 0;
+int s_memory_usage_prefix_lock  = 0;
+bool s_memory_usage_print       = false;
+
+MemoryUsageCounter s_memory_usage[memory_usage_max_spaces]
+                                 [memory_usage_max_prefixes + 1] = {};
+
+int memory_usage_prefix_count() {
+  return *static_cast<volatile int*>(&s_memory_usage_prefix_count);
+}
+
+/* Index of the space named 'name', claiming a free row if 'insert' */
+int memory_usage_space(const char* const name, const bool insert) {
+  for (int i = 0; i < memory_usage_max_spaces; ++i) {
+    const char* space =
+        *static_cast<const char* volatile*>(&s_memory_usage_spaces[i]);
+    if (space == nullptr) {
+      if (!insert) return -1;
+      space = Kokkos::atomic_compare_exchange(&s_memory_usage_spaces[i],
+                                              (const char*)nullptr, name);
+      if (space == nullptr) return i;
+    }
+    if (space == name || 0 == strcmp(space, name)) return i;
+  }
+  return -1;
+}
+
+}  // namespace
+
+namespace Impl {
+
+MemoryUsageTag memory_usage_allocate(const char* const space_name,
+                                     const std::string& label,
+                                     const size_t size) {
+  MemoryUsageTag tag = {memory_usage_space(space_name, true), 0u};
+
+  if (tag.space < 0) return tag;
+
+  const int nprefix = memory_usage_prefix_count();
+  for (int i = 0; i < nprefix; ++i) {
+    const std::string& prefix = s_memory_usage_prefixes[i];
+    if (0 == label.compare(0, prefix.size(), prefix)) {
+      tag.prefixes |= 1u << i;
+    }
+  }
+
+  memory_usage_allocate(tag, size);
+
+  return tag;
+}
+
+void memory_usage_allocate(const MemoryUsageTag tag, const size_t size) {
+  if (tag.space < 0) return;
+
+  MemoryUsageCounter* const row = s_memory_usage[tag.space];
+  for (int i = 0; i <= memory_usage_max_prefixes; ++i) {
+    if (i == 0 || (tag.prefixes & (1u << (i - 1)))) {
+      MemoryUsageCounter& c = row[i];
+      const size_t live = Kokkos::atomic_fetch_add(&c.live_bytes, size) + size;
+      Kokkos::atomic_fetch_max(&c.peak_bytes, live);
+      Kokkos::atomic_increment(&c.live_count);
+      Kokkos::atomic_increment(&c.allocation_count);
+    }
+  }
+}
+
+void memory_usage_deallocate(const MemoryUsageTag tag, const size_t size) {
+  if (tag.space < 0) return;
+
+  MemoryUsageCounter* const row = s_memory_usage[tag.space];
+  for (int i = 0; i <= memory_usage_max_prefixes; ++i) {
+    if (i == 0 || (tag.prefixes & (1u << (i - 1)))) {
+      Kokkos::atomic_fetch_sub(&row[i].live_bytes, size);
+      Kokkos::atomic_decrement(&row[i].live_count);
+    }
+  }
+}
+
+bool memory_usage_print() noexcept { return s_memory_usage_print; }
+
+void set_memory_usage_print(const bool print) noexcept {
+  s_memory_usage_print = print;
+}
+
+} /* namespace Impl */
+} /* namespace Kokkos */
+
+namespace Kokkos {
+namespace Experimental {
+
+MemoryUsage memory_usage(const std::string& space_name,
+                         const std::string& label_prefix) {
+  MemoryUsage usage = {0, 0, 0, 0};
+
+  const int space = memory_usage_space(space_name.c_str(), false);
+  if (space < 0) return usage;
+
+  int column = 0;
+  if (!label_prefix.empty()) {
+    const int nprefix = memory_usage_prefix_count();
+    while (column < nprefix && s_memory_usage_prefixes[column] != label_prefix)
+      ++column;
+    if (column == nprefix) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::memory_usage label prefix '" + label_prefix +
+          "' is not tracked");
+    }
+    ++column;
+  }
+
+  MemoryUsageCounter& c = s_memory_usage[space][column];
+
+  usage.live_bytes       = Kokkos::atomic_fetch_add(&c.live_bytes, size_t(0));
+  usage.peak_bytes       = Kokkos::atomic_fetch_add(&c.peak_bytes, size_t(0));
+  usage.live_count       = Kokkos::atomic_fetch_add(&c.live_count, size_t(0));
+  usage.allocation_count =
+      Kokkos::atomic_fetch_add(&c.allocation_count, size_t(0));
+  return usage;
+}
+
+void track_memory_usage(const std::string& label_prefix) {
+  if (label_prefix.empty()) return;
+
+  while (0 != Kokkos::atomic_compare_exchange(&s_memory_usage_prefix_lock, 0,
+                                              1))
+    ;
+  const int nprefix = s_memory_usage_prefix_count;
+  bool found        = false;
+  for (int i = 0; i < nprefix && !found; ++i) {
+    found = s_memory_usage_prefixes[i] == label_prefix;
+  }
+  if (!found && nprefix < memory_usage_max_prefixes) {
+    s_memory_usage_prefixes[nprefix] = label_prefix;
+    Kokkos::memory_fence();
+    Kokkos::atomic_increment(&s_memory_usage_prefix_count);
+  }
+  Kokkos::atomic_exchange(&s_memory_usage_prefix_lock, 0);
+
+  if (!found && nprefix == memory_usage_max_prefixes) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::track_memory_usage cannot track more label "
+        "prefixes");
+  }
+}
+
+void reset_memory_usage() {
+  for (int i = 0; i < memory_usage_max_spaces; ++i) {
+    for (int j = 0; j <= memory_usage_max_prefixes; ++j) {
+      MemoryUsageCounter& c = s_memory_usage[i][j];
+      Kokkos::atomic_exchange(&c.allocation_count, size_t(0));
+      Kokkos::atomic_exchange(
+          &c.peak_bytes, Kokkos::atomic_fetch_add(&c.live_bytes, size_t(0)));
+      // An allocation concurrent with the exchange may have raised the
+      // peak before it and the live bytes after the above read.
+      Kokkos::atomic_fetch_max(
+          &c.peak_bytes, Kokkos::atomic_fetch_add(&c.live_bytes, size_t(0)));
+    }
+  }
+}
+
+void print_memory_usage(std::ostream& s) {
+  std::ostringstream out;
+  out << "Kokkos memory usage [ live bytes / count , peak bytes , "
+         "allocations ]"
+      << std::endl;
+
+  const int nprefix = memory_usage_prefix_count();
+  for (int i = 0; i < memory_usage_max_spaces; ++i) {
+    const char* const space = s_memory_usage_spaces[i];
+    if (space == nullptr) break;
+    for (int j = 0; j <= nprefix; ++j) {
+      const MemoryUsage usage = memory_usage(
+          space, j == 0 ? std::string() : s_memory_usage_prefixes[j - 1]);
+      if (j != 0 && usage.peak_bytes == 0) continue;
+      std::string name(space);
+      if (j != 0) name += " '" + s_memory_usage_prefixes[j - 1] + "'";
+      out << "  " << std::left << std::setw(32) << name << std::right
+          << std::setw(14) << usage.live_bytes << " / " << usage.live_count
+          << " , " << usage.peak_bytes << " , " << usage.allocation_count
+          << std::endl;
+    }
+  }
+  s << out.str();
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
@@ -66,6 +66,16 @@ namespace Impl {
 template <class MemorySpace = void, class DestroyFunctor = void>
 class SharedAllocationRecord;
 
+/*
+ *  The header of a tracked allocation preceding the user's memory.
+ *
+ *  By default the header is 128 bytes holding a copy of the label.  With
+ *  KOKKOS_ENABLE_COMPACT_ALLOCATION_HEADER the label is interned in a
+ *  global table of labels, which lives until the end of the program, and
+ *  the header only holds the record and label pointers, padded to the
+ *  memory alignment so that the user's memory stays aligned.  The label is
+ *  then not readable in device code.
+ */
 class SharedAllocationHeader {
  private:
   using Record = SharedAllocationRecord<void, void>;
@@ -76,8 +86,13 @@ class SharedAllocationHeader {
   template <class, class>
   friend class SharedAllocationRecord;
 
+#if defined(KOKKOS_ENABLE_COMPACT_ALLOCATION_HEADER)
+  alignas(KOKKOS_MEMORY_ALIGNMENT) Record* m_record;
+  const char* m_label;
+#else
   Record* m_record;
   char m_label[maximum_label_length];
+#endif
 
  public:
   /* Given user memory get pointer to the header */
@@ -88,14 +103,31 @@ class SharedAllocationHeader {
   }
 
   KOKKOS_INLINE_FUNCTION
-  const char* label() const { return m_label; }
+  const char* label() const {
+#if defined(KOKKOS_ENABLE_COMPACT_ALLOCATION_HEADER) && \
+    !defined(KOKKOS_ACTIVE_EXECUTION_MEMORY_SPACE_HOST)
+    // The interned labels reside in host memory
+    return "";
+#else
+    return m_label;
+#endif
+  }
+
+  /* Copy, or intern, the label truncated to the maximum label length */
+  void set_label(const std::string& arg_label);
 };
 
 template <>
 class SharedAllocationRecord<void, void> {
  protected:
+#if defined(KOKKOS_ENABLE_COMPACT_ALLOCATION_HEADER)
+  static_assert(
+      sizeof(SharedAllocationHeader) % KOKKOS_MEMORY_ALIGNMENT == 0,
+      "sizeof(SharedAllocationHeader) % KOKKOS_MEMORY_ALIGNMENT != 0");
+#else
   static_assert(sizeof(SharedAllocationHeader) == (1u << 7 /* 128 */),
                 "sizeof(SharedAllocationHeader) != 128");
+#endif
 
   template <class, class>
   friend class SharedAllocationRecord;
@@ -229,6 +261,34 @@ class SharedAllocationRecord<void, void> {
       const SharedAllocationRecord* const root, const bool detail);
 };
 
+/*  Memory usage counters of the allocations of a memory space,
+ *  queried with Kokkos::Experimental::memory_usage.  Records created
+ *  with a destroy functor count their allocation on construction and
+ *  release it on deallocation with the tag returned by the former.
+ */
+struct MemoryUsageTag {
+  int space;          // index of the memory space, negative if not counted
+  unsigned prefixes;  // bit mask of the tracked label prefixes matched
+};
+
+MemoryUsageTag memory_usage_allocate(const char* const space_name,
+                                     const std::string& label,
+                                     const size_t size);
+
+/*  Count another allocation, such as a MemoryPool slab, under the tag
+ *  of an allocation of the same memory space.
+ */
+void memory_usage_allocate(const MemoryUsageTag tag, const size_t size);
+
+void memory_usage_deallocate(const MemoryUsageTag tag, const size_t size);
+
+/*  Print the memory usage to std::cout in Kokkos::finalize, set by
+ *  '--kokkos-memory-usage' or the KOKKOS_MEMORY_USAGE environment variable.
+ */
+bool memory_usage_print() noexcept;
+
+void set_memory_usage_print(const bool) noexcept;
+
 namespace {
 
 /* Taking the address of this function so make sure it is unique */
@@ -242,6 +302,8 @@ void deallocate(SharedAllocationRecord<void, void>* record_ptr) {
 
   ptr->m_destroy.destroy_shared_allocation();
 
+  memory_usage_deallocate(ptr->m_usage, ptr->size());
+
   delete ptr;
 }
 
@@ -269,7 +331,9 @@ class SharedAllocationRecord
       : SharedAllocationRecord<MemorySpace, void>(
             arg_space, arg_label, arg_alloc,
             &Kokkos::Impl::deallocate<MemorySpace, DestroyFunctor>),
-        m_destroy() {}
+        m_destroy(),
+        m_usage(memory_usage_allocate(MemorySpace::name(), arg_label,
+                                      arg_alloc)) {}
 
   SharedAllocationRecord()                              = delete;
   SharedAllocationRecord(const SharedAllocationRecord&) = delete;
@@ -277,6 +341,7 @@ class SharedAllocationRecord
 
  public:
   DestroyFunctor m_destroy;
+  const MemoryUsageTag m_usage;
 
   // Allocate with a zero use count.  Incrementing the use count from zero to
   // one inserts the record into the tracking list.  Decrementing the count from
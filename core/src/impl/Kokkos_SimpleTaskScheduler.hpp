@@ -273,6 +273,70 @@ class SimpleTaskScheduler
     return rv;
   }
 
+  template <int TaskEnum, class GeneratorType>
+  KOKKOS_FUNCTION future_type<void> _spawn_batch_impl(
+      TaskPriority arg_priority,
+      typename runnable_task_base_type::function_type apply_function_ptr,
+      int n_tasks, GeneratorType const& generator) {
+    KOKKOS_EXPECTS(m_queue != nullptr);
+
+    using functor_type = typename std::decay<decltype(generator(0))>::type;
+    using task_type =
+        typename task_queue_type::template runnable_task_type<functor_type,
+                                                              scheduler_type>;
+    using aggregate_type = typename task_queue_type::aggregate_task_type;
+
+    future_type<void> rv;
+
+    if (n_tasks < 1) return rv;
+
+    auto& q = *m_queue;
+
+    // The aggregate holds the tasks of the batch as its predecessors and
+    // doubles as the array they are pushed to the ready queue from
+    auto* aggregate_task_ptr =
+        q.template allocate_and_construct_with_vla_emulation<aggregate_type,
+                                                             task_base_type*>(
+            /* n_vla_entries = */ n_tasks,
+            /* aggregate_predecessor_count = */ n_tasks,
+            /* queue_base = */ &q,
+            /* initial_reference_count = */ 2);
+
+    rv = future_type<void>(aggregate_task_ptr);
+
+    for (int i_task = 0; i_task < n_tasks; ++i_task) {
+      // Reference count starts at two:
+      //   +1 for the matching decrement when task is complete
+      //   +1 for the aggregate, released when the aggregate is scheduled
+      auto& runnable_task = *q.template allocate_and_construct<task_type>(
+          /* functor = */ generator(i_task),
+          /* apply_function_ptr = */ apply_function_ptr,
+          /* task_type = */ static_cast<Impl::TaskType>(TaskEnum),
+          /* priority = */ arg_priority,
+          /* queue_base = */ &q,
+          /* initial_reference_count = */ 2);
+
+      q.initialize_scheduling_info_from_team_scheduler_info(
+          runnable_task, team_scheduler_info());
+
+      aggregate_task_ptr->vla_value_at(i_task) = &runnable_task;
+    }
+
+    Kokkos::memory_fence();  // fence to ensure dependent stores are visible
+
+    q.schedule_runnable_batch(aggregate_task_ptr->begin(), n_tasks,
+                              team_scheduler_info());
+    // the tasks may be run at any time, but the aggregate's references keep
+    // them alive until it is scheduled
+
+    q.schedule_aggregate(std::move(*aggregate_task_ptr),
+                         team_scheduler_info());
+    // the aggregate may be processed at any time, so don't touch it after
+    // this
+
+    return rv;
+  }
+
  public:
   //----------------------------------------------------------------------------
   // <editor-fold desc="Constructors, destructor, and assignment"> {{{2
@@ -354,6 +418,15 @@ class SimpleTaskScheduler
     return this->execution_space_instance();
   }
 
+  /// Tasks stolen so far by the teams executing this scheduler, from teams
+  /// in the same package and from other packages.  Always zero for queues
+  /// without per-team ready queues.
+  KOKKOS_INLINE_FUNCTION
+  Impl::TaskStealCounts steal_counts() const noexcept {
+    KOKKOS_EXPECTS(m_queue != nullptr);
+    return m_queue->steal_counts();
+  }
+
   KOKKOS_INLINE_FUNCTION
   team_scheduler_info_type& team_scheduler_info() & {
     return this->team_scheduler_info_storage::no_unique_address_data_member();
@@ -418,6 +491,17 @@ class SimpleTaskScheduler
     task.set_respawn_flag(true);
   }
 
+  template <int TaskEnum, typename GeneratorType>
+  KOKKOS_FUNCTION static future_type<void> spawn_batch(
+      Impl::TaskPolicyWithScheduler<TaskEnum, scheduler_type>&& arg_policy,
+      typename runnable_task_base_type::function_type arg_function,
+      typename runnable_task_base_type::destroy_type /*arg_destroy*/,
+      int arg_count, GeneratorType const& arg_generator) {
+    return std::move(arg_policy.scheduler())
+        .template _spawn_batch_impl<TaskEnum>(
+            arg_policy.priority(), arg_function, arg_count, arg_generator);
+  }
+
   template <class FunctorType>
   KOKKOS_FUNCTION static void respawn(
       FunctorType* functor, scheduler_type const&,
@@ -144,6 +144,8 @@ class SingleTaskQueue
   KOKKOS_FUNCTION
   void schedule_runnable(runnable_task_base_type&& task,
                          team_scheduler_info_type const& info) {
+    // The ready queue is chosen by priority, so raise it first
+    this->inherit_waiting_priority(task);
     this->schedule_runnable_to_queue(
         std::move(task),
         m_ready_queues[int(task.get_priority())][int(task.get_task_type())],
@@ -152,6 +154,17 @@ class SingleTaskQueue
     // the use of move semantics)
   }
 
+  // All of the tasks in a batch have the same priority and task type
+  KOKKOS_FUNCTION
+  void schedule_runnable_batch(task_base_type* const tasks[], int32_t n_tasks,
+                               team_scheduler_info_type const& info) {
+    auto const& first = tasks[0]->as_runnable_task();
+    this->schedule_ready_batch_to_queue(
+        tasks, n_tasks,
+        m_ready_queues[int(first.get_priority())][int(first.get_task_type())],
+        info);
+  }
+
   KOKKOS_FUNCTION
   OptionalRef<task_base_type> pop_ready_task(
       team_scheduler_info_type const& /*info*/) {
@@ -49,6 +49,8 @@
 #include <impl/Kokkos_Spinwait.hpp>
 #include <impl/Kokkos_BitOps.hpp>
 
+#include <climits>
+
 #if defined(KOKKOS_ENABLE_STDTHREAD) || defined(_WIN32)
 #include <thread>
 #elif !defined(_WIN32)
@@ -60,6 +62,14 @@
 #include <windows.h>
 #endif
 
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <time.h>
+#define KOKKOS_IMPL_HOST_FUTEX
+#endif
+
 /*--------------------------------------------------------------------------*/
 
 namespace Kokkos {
@@ -151,6 +161,52 @@ void host_thread_yield(const uint32_t i, const WaitMode mode) {
 #endif /* defined( KOKKOS_ENABLE_ASM ) */
 }
 
+WaitPolicy g_host_wait_policy = WaitPolicy::ACTIVE;
+
+int volatile g_host_futex_sleepers = 0;
+
+void set_host_wait_policy(const WaitPolicy policy) noexcept {
+  g_host_wait_policy = policy;
+}
+
+void host_futex_wait(int volatile* addr, const int value) noexcept {
+#if defined(KOKKOS_IMPL_HOST_FUTEX)
+  // Bound the sleep so that a transition which is not followed by a wake
+  // (e.g. during initialization or finalization) only delays the waiter.
+  timespec timeout;
+  timeout.tv_sec  = 0;
+  timeout.tv_nsec = 4000000;
+
+  // Announce the sleeper before the kernel re-tests '*addr', pairs with
+  // the fence in 'host_futex_wake' or the atomic update preceding
+  // 'host_futex_wake_after_atomic'.
+  Kokkos::atomic_increment(&g_host_futex_sleepers);
+  Kokkos::memory_fence();
+
+  syscall(SYS_futex, const_cast<int*>(addr), FUTEX_WAIT_PRIVATE, value,
+          &timeout, nullptr, 0);
+
+  Kokkos::atomic_decrement(&g_host_futex_sleepers);
+#else
+  (void)addr;
+  (void)value;
+#if defined(KOKKOS_ENABLE_STDTHREAD) || defined(_WIN32)
+  std::this_thread::yield();
+#else
+  sched_yield();
+#endif
+#endif
+}
+
+void host_futex_wake_all(int volatile* addr) noexcept {
+#if defined(KOKKOS_IMPL_HOST_FUTEX)
+  syscall(SYS_futex, const_cast<int*>(addr), FUTEX_WAKE_PRIVATE, INT_MAX,
+          nullptr, nullptr, 0);
+#else
+  (void)addr;
+#endif
+}
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -65,6 +65,62 @@ enum class WaitMode : int {
 
 void host_thread_yield(const uint32_t i, const WaitMode mode);
 
+/** \brief  How host threads wait for work or for each other.
+ *
+ *  ACTIVE  : spin and yield, never block in the kernel (default)
+ *  HYBRID  : spin for a short while and then block on a futex
+ *  PASSIVE : block on a futex immediately
+ *
+ *  Set by the '--kokkos-wait-policy' argument or the KOKKOS_WAIT_POLICY
+ *  environment variable.
+ */
+enum class WaitPolicy : int { ACTIVE, HYBRID, PASSIVE };
+
+/** \brief  Current wait policy, read through 'host_wait_policy()' */
+extern WaitPolicy g_host_wait_policy;
+
+inline WaitPolicy host_wait_policy() noexcept { return g_host_wait_policy; }
+
+void set_host_wait_policy(const WaitPolicy policy) noexcept;
+
+/** \brief  Block the calling thread while '*addr == value'.
+ *
+ *  May return spuriously; callers must re-test their condition.
+ *  Without futex support this only yields the thread.
+ */
+void host_futex_wait(int volatile* addr, const int value) noexcept;
+
+/** \brief  Wake all threads blocked in 'host_futex_wait(addr, ...)' */
+void host_futex_wake_all(int volatile* addr) noexcept;
+
+/** \brief  Number of threads currently blocked in 'host_futex_wait' */
+extern int volatile g_host_futex_sleepers;
+
+/** \brief  Wake threads blocked on 'addr' after a plain store to it.
+ *
+ *  Nothing is done under the ACTIVE policy, where no thread sleeps.
+ *  Otherwise the wake system call is skipped when no thread is sleeping.
+ */
+inline void host_futex_wake(int volatile* addr) noexcept {
+  if (WaitPolicy::ACTIVE == g_host_wait_policy) return;
+  // order the store to '*addr' before reading the sleeper count
+  Kokkos::memory_fence();
+  if (0 < g_host_futex_sleepers) host_futex_wake_all(addr);
+}
+
+/** \brief  As 'host_futex_wake' after an atomic read-modify-write of 'addr'.
+ *
+ *  The sequentially consistent update already orders the sleeper count
+ *  read, so no additional fence is issued.
+ */
+inline void host_futex_wake_after_atomic(int volatile* addr) noexcept {
+  if (WaitPolicy::ACTIVE == g_host_wait_policy) return;
+  if (0 < Kokkos::Impl::atomic_load(&g_host_futex_sleepers,
+                                    Kokkos::Impl::memory_order_acquire)) {
+    host_futex_wake_all(addr);
+  }
+}
+
 template <typename T>
 typename std::enable_if<std::is_integral<T>::value, void>::type
 root_spinwait_while_equal(T const volatile& flag, const T value) {
@@ -220,6 +220,16 @@ class TaskBase {
   int32_t reference_count() const {
     return *((int32_t volatile*)(&m_ref_count));
   }
+
+  // Raise the priority of this task, which a task of priority
+  // 'successor_priority' is about to wait on, so that tasks on the path
+  // to a high priority task are made ready in a high priority queue.
+  // Only a task that is not yet in a ready queue is affected.
+  // Concurrent raises may lose to each other; either result is valid.
+  KOKKOS_INLINE_FUNCTION
+  void inherit_priority(int16_t successor_priority) volatile {
+    if (successor_priority < m_priority) m_priority = successor_priority;
+  }
 };
 
 //------------------------------------------------------------------------------
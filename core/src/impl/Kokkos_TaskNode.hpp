@@ -312,6 +312,13 @@ class TaskNode
     m_wait_queue.consume(std::forward<Function>(f));
   }
 
+  // Only valid while this node is incomplete, i.e., before its wait queue is
+  // consumed; the waiting nodes cannot be rescheduled until then.
+  template <class Function>
+  KOKKOS_INLINE_FUNCTION void for_each_waiting(Function&& f) {
+    m_wait_queue.for_each(std::forward<Function>(f));
+  }
+
   KOKKOS_INLINE_FUNCTION
   bool wait_queue_is_consumed() const noexcept {
     // TODO @tasking @memory_order DSH memory order
@@ -340,6 +347,18 @@ class TaskNode
     return (TaskPriority)m_priority;
   }
 
+  // Raise the priority of this node, which a task or aggregate of priority
+  // `successor_priority` is about to wait on, so that tasks on the path to a
+  // high priority task are made ready in a high priority queue.  Only a node
+  // that is not yet in a ready queue is affected.  Concurrent raises may lose
+  // to each other; either result is a valid priority.
+  KOKKOS_INLINE_FUNCTION
+  void inherit_priority(TaskPriority successor_priority) volatile noexcept {
+    if ((priority_type)successor_priority < m_priority) {
+      m_priority = (priority_type)successor_priority;
+    }
+  }
+
   KOKKOS_INLINE_FUNCTION
   bool get_respawn_flag() const { return m_is_respawning; }
 
@@ -417,7 +436,9 @@ class alignas(16) AggregateTask final
   KOKKOS_INLINE_FUNCTION constexpr explicit AggregateTask(
       int32_t aggregate_predecessor_count, Args&&... args)
       : base_t(TaskType::Aggregate,
-               TaskPriority::Regular,  // all aggregates are regular priority
+               // aggregates never run; they take the priority of the tasks
+               // waiting on them
+               TaskPriority::Low,
                std::forward<Args>(args)...),
         vla_base_t(aggregate_predecessor_count) {}
 
@@ -57,6 +57,7 @@
 
 #include <impl/Kokkos_TaskBase.hpp>
 #include <impl/Kokkos_TaskResult.hpp>
+#include <impl/Kokkos_TaskQueueLocality.hpp>
 
 #include <impl/Kokkos_Memory_Fence.hpp>
 #include <impl/Kokkos_Atomic_Increment.hpp>
@@ -134,6 +135,17 @@ class TaskQueue : public TaskQueueBase {
   KOKKOS_FUNCTION void schedule_runnable(task_root_type*);
   KOKKOS_FUNCTION void schedule_aggregate(task_root_type*);
 
+  // Raise a task to the highest priority of the tasks waiting on it,
+  // directly or through a chain of other waiting tasks.  An aggregate passes
+  // the priority on to the dependences it has not waited on yet.
+  //   Precondition:
+  //     task is not complete
+  KOKKOS_FUNCTION
+  static void inherit_waiting_priority(task_root_type*);
+  KOKKOS_FUNCTION
+  static void inherit_waiting_priority(task_root_type*, int depth,
+                                       int& budget);
+
   // Reschedule a task
   //   Precondition:
   //     task is in Executing state
@@ -176,6 +188,14 @@ class TaskQueue : public TaskQueueBase {
   KOKKOS_INLINE_FUNCTION
   team_queue_type& get_team_queue(int /*team_rank*/) { return *this; }
 
+  KOKKOS_INLINE_FUNCTION
+  void set_team_locality(int /*league_rank*/,
+                         TaskQueueLocality const& /*locality*/) const
+      noexcept {}
+
+  KOKKOS_INLINE_FUNCTION
+  TaskStealCounts steal_counts() const noexcept { return TaskStealCounts{}; }
+
   // void execute() { specialization::execute( this ); }
 
   template <typename FunctorType>
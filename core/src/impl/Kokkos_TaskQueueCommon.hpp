@@ -57,6 +57,7 @@
 #include <impl/Kokkos_TaskResult.hpp>
 
 #include <impl/Kokkos_TaskQueueMemoryManager.hpp>
+#include <impl/Kokkos_TaskQueueLocality.hpp>
 #include <impl/Kokkos_Memory_Fence.hpp>
 #include <impl/Kokkos_Atomic_Increment.hpp>
 #include <impl/Kokkos_OptionalRef.hpp>
@@ -161,6 +162,16 @@ class TaskQueueCommonMixin {
     Kokkos::atomic_increment(&this->m_ready_count);
   }
 
+  KOKKOS_INLINE_FUNCTION
+  void _increment_ready_count(int32_t n) {
+    // Release: device atomics are relaxed, so fence to order the construction
+    // of the batch before the count is published.  The fence in the push that
+    // follows orders the count before the tasks, so a consumer which pops one
+    // of them also observes the count that accounts for it.
+    Kokkos::memory_fence();
+    Kokkos::atomic_add(&this->m_ready_count, n);
+  }
+
   KOKKOS_INLINE_FUNCTION
   void _decrement_ready_count() {
     // TODO @tasking @memory_order DSH memory order
@@ -247,6 +258,10 @@ class TaskQueueCommonMixin {
       // making this a release store would also do this
       ((RunnableTaskBase<TaskQueueTraits> volatile&)task).clear_predecessor();
 
+      // Tasks on the path to this task run at least at its priority
+      ((TaskNode<TaskQueueTraits> volatile&)predecessor)
+          .inherit_priority(task.get_priority());
+
       // TODO @tasking @memory_order DSH remove this fence in favor of memory
       // orders
       Kokkos::memory_fence();  // for now
@@ -309,6 +324,29 @@ class TaskQueueCommonMixin {
     // the use of move semantics)
   }
 
+  // Schedule a batch of new tasks with no predecessors that all go to the
+  // same ready queue.  The ready count is updated once for the whole batch
+  // and the tasks are pushed together; only if the queue can't take all of
+  // them at once are they pushed one at a time.
+  template <class TaskQueueTraits, class ReadyQueueType,
+            class TeamSchedulerInfo>
+  KOKKOS_INLINE_FUNCTION void schedule_ready_batch_to_queue(
+      TaskNode<TaskQueueTraits>* const tasks[], int32_t n_tasks,
+      ReadyQueueType& ready_queue, TeamSchedulerInfo const& info) {
+    _self()._increment_ready_count(n_tasks);
+    bool push_success = ready_queue.push_n(tasks, n_tasks);
+    if (!push_success) {
+      for (int32_t i = 0; i < n_tasks; ++i) {
+        auto& task = tasks[i]->as_runnable_task();
+        if (!ready_queue.push(task)) {
+          _self().handle_failed_ready_queue_insertion(std::move(task),
+                                                      ready_queue, info);
+        }
+      }
+    }
+    // Tasks may be run at any point; don't touch them
+  }
+
   template <class TaskQueueTraits, class ReadyQueueType,
             class TeamSchedulerInfo>
   KOKKOS_INLINE_FUNCTION void handle_failed_ready_queue_insertion(
@@ -317,6 +355,62 @@ class TaskQueueCommonMixin {
     Kokkos::abort("Unhandled failure of ready task queue insertion!\n");
   }
 
+  // Raise `node` to the highest priority of the tasks waiting on it, directly
+  // or through a chain of other waiting tasks, so that the whole path to a
+  // high priority task is made ready at that priority.  An aggregate passes
+  // its priority on to the predecessors it has not waited on yet.  Every node
+  // reachable through the wait queues of an incomplete node is itself
+  // waiting, so none of them can be rescheduled or deallocated meanwhile.
+  // The search is bounded so that scheduling stays cheap for wide graphs.
+  template <class TaskQueueTraits>
+  KOKKOS_FUNCTION void inherit_waiting_priority(
+      TaskNode<TaskQueueTraits>& node) {
+    int budget = 64;
+    _inherit_waiting_priority(node, /* depth = */ 8, budget);
+  }
+
+  template <class TaskQueueTraits>
+  KOKKOS_FUNCTION void _inherit_waiting_priority(
+      TaskNode<TaskQueueTraits>& node, int depth, int& budget) {
+    using task_node_type = TaskNode<TaskQueueTraits>;
+    using task_scheduling_info_type =
+        typename Derived::task_scheduling_info_type;
+
+    node.for_each_waiting(_inherit_waiting_priority_operation<TaskQueueTraits>{
+        node, *this, depth, budget});
+
+    if (node.is_aggregate()) {
+      for (auto* predecessor_ptr :
+           node.template as_aggregate<task_scheduling_info_type>()) {
+        if (predecessor_ptr != nullptr) {
+          ((task_node_type volatile&)*predecessor_ptr)
+              .inherit_priority(node.get_priority());
+        }
+      }
+    }
+  }
+
+ private:
+  // Helper functor for the above, for the same reasons as
+  // _schedule_waiting_tasks_operation
+  template <class TaskQueueTraits>
+  struct _inherit_waiting_priority_operation {
+    TaskNode<TaskQueueTraits>& m_node;
+    TaskQueueCommonMixin& m_queue;
+    int m_depth;
+    int& m_budget;
+    KOKKOS_INLINE_FUNCTION
+    void operator()(TaskNode<TaskQueueTraits>& waiting) const noexcept {
+      if (0 < m_depth && 0 < m_budget) {
+        --m_budget;
+        m_queue._inherit_waiting_priority(waiting, m_depth - 1, m_budget);
+      }
+      ((TaskNode<TaskQueueTraits> volatile&)m_node)
+          .inherit_priority(waiting.get_priority());
+    }
+  };
+
+ public:
   // This isn't actually generic; the template parameters are just to keep
   // Derived from having to be complete
   template <class TaskQueueTraits, class SchedulingInfo,
@@ -334,6 +428,10 @@ class TaskQueueCommonMixin {
         std::is_same<TeamSchedulerInfo, team_scheduler_info_type>::value,
         "SchedulingInfo type mismatch!");
 
+    // Tasks on the paths to this aggregate run at least at the priority of
+    // the tasks waiting on it
+    inherit_waiting_priority(aggregate);
+
     bool incomplete_dependence_found = false;
 
     for (auto*& predecessor_ptr_ref : aggregate) {
@@ -494,6 +592,24 @@ class TaskQueueCommonMixin {
 
   // </editor-fold> end Scheduling }}}2
   //----------------------------------------------------------------------------
+
+  //----------------------------------------------------------------------------
+  // <editor-fold desc="Work stealing locality"> {{{2
+
+  // Queues without per-team ready queues never steal, so there is nothing
+  // to record or count by default
+  template <class TeamSchedulerInfo>
+  KOKKOS_INLINE_FUNCTION void set_team_locality(
+      TeamSchedulerInfo const& /*info*/,
+      TaskQueueLocality const& /*locality*/) noexcept {
+    /* do nothing by default */
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  TaskStealCounts steal_counts() const noexcept { return TaskStealCounts{}; }
+
+  // </editor-fold> end Work stealing locality }}}2
+  //----------------------------------------------------------------------------
 };
 
 } /* namespace Impl */
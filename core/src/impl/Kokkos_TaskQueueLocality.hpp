@@ -0,0 +1,111 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_IMPL_TASKQUEUELOCALITY_HPP
+#define KOKKOS_IMPL_TASKQUEUELOCALITY_HPP
+
+#include <Kokkos_Macros.hpp>
+#if defined(KOKKOS_ENABLE_TASKDAG)
+
+#include <Kokkos_hwloc.hpp>
+
+#include <cstdint>
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+/// @brief Hardware location of the team owning a task queue, used to try
+/// nearby queues first when stealing
+///
+/// Stealing from a team that shares a core or a last level cache finds the
+/// stolen task's data still in cache; stealing across packages pulls it
+/// over the interconnect.  A default constructed locality is unknown and
+/// is remote to every other locality.
+struct TaskQueueLocality {
+  enum : int { SameCore = 0, SameCache = 1, SamePackage = 2, Remote = 3 };
+
+  int core    = -1;
+  int cache   = -1;
+  int package = -1;
+
+  KOKKOS_INLINE_FUNCTION
+  bool is_known() const noexcept { return 0 <= package; }
+
+  KOKKOS_INLINE_FUNCTION
+  int distance(TaskQueueLocality const& other) const noexcept {
+    if (!is_known() || !other.is_known() || package != other.package) {
+      return Remote;
+    }
+    if (0 <= core && core == other.core) return SameCore;
+    if (0 <= cache && cache == other.cache) return SameCache;
+    return SamePackage;
+  }
+
+  // Locality of the hardware thread the calling host thread runs on
+  static TaskQueueLocality this_thread() {
+    TaskQueueLocality locality;
+    Kokkos::hwloc::get_this_thread_locality(locality.core, locality.cache,
+                                            locality.package);
+    return locality;
+  }
+};
+
+/// @brief Number of tasks stolen from a queue in the same package (local)
+/// and from a queue in another or an unknown package (remote)
+struct TaskStealCounts {
+  uint64_t local  = 0;
+  uint64_t remote = 0;
+};
+
+} /* namespace Impl */
+} /* namespace Kokkos */
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+#endif /* #if defined( KOKKOS_ENABLE_TASKDAG ) */
+#endif /* #ifndef KOKKOS_IMPL_TASKQUEUELOCALITY_HPP */
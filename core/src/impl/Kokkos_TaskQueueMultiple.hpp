@@ -89,6 +89,10 @@ class TaskQueueMultiple : public TaskQueue<ExecSpace, MemorySpace> {
   // This pointer is owning only if m_league_rank == 0
   queue_collection_t* m_other_queues = nullptr;
 
+  // Where the team of m_league_rank runs, and the tasks stolen into this queue
+  TaskQueueLocality m_locality;
+  TaskStealCounts m_steals;
+
  public:
   struct Destroy {
     TaskQueueMultiple* m_queue;
@@ -134,6 +138,28 @@ class TaskQueueMultiple : public TaskQueue<ExecSpace, MemorySpace> {
       return m_other_queues->get_team_queue(arg_league_rank);
   }
 
+  // Record where the team of arg_league_rank runs; must happen-before any
+  // other team steals.  Teams beyond the number of queues share a queue,
+  // which keeps the locality of the team it was created for.
+  KOKKOS_INLINE_FUNCTION
+  void set_team_locality(int arg_league_rank,
+                         TaskQueueLocality const& arg_locality) noexcept {
+    if (arg_league_rank < m_other_queues->size()) {
+      get_team_queue(arg_league_rank).m_locality = arg_locality;
+    }
+  }
+
+  // Tasks stolen by all teams so far
+  KOKKOS_INLINE_FUNCTION
+  TaskStealCounts steal_counts() noexcept {
+    TaskStealCounts counts;
+    for (int iteam = 0; iteam < m_other_queues->size(); ++iteam) {
+      counts.local += get_team_queue(iteam).m_steals.local;
+      counts.remote += get_team_queue(iteam).m_steals.remote;
+    }
+    return counts;
+  }
+
   KOKKOS_INLINE_FUNCTION
   typename base_t::task_root_type* attempt_to_steal_task() noexcept {
     TaskBase* rv        = nullptr;
@@ -143,25 +169,38 @@ class TaskQueueMultiple : public TaskQueue<ExecSpace, MemorySpace> {
       Kokkos::abort("attempted to steal task before queues were initialized!");
     }
 
-    // Loop by priority and then type, and then team
+    // Loop by priority and then type, and then team, nearest teams first:
+    // those sharing this team's core, then its last level cache, then its
+    // package, and finally the remote or unknown ones
+    const int first_distance = m_locality.is_known()
+                                   ? int(TaskQueueLocality::SameCore)
+                                   : int(TaskQueueLocality::Remote);
     for (int i = 0; i < base_t::NumQueue; ++i) {
       for (int j = 0; j < 2; ++j) {
-        // for now, always start by trying to steal from team zero
-        for (int iteam = 0; iteam < m_other_queues->size(); ++iteam) {
-          if (iteam == m_league_rank) continue;
-          auto& steal_from = get_team_queue(iteam);
-          if (*((volatile int*)&steal_from.m_ready_count) > 0) {
-            // we've found at least one queue that's not done, so even if we
-            // can't pop something off of it we shouldn't return a nullptr
-            // indicating completion.  rv will be end_tag when the pop fails
-            rv = base_t::pop_ready_task(&steal_from.m_ready[i][j]);
-            if (rv != end_tag) {
-              // task stolen.
-              // first increment our ready count, then decrement the ready count
-              // on the other queue:
-              Kokkos::atomic_increment(&this->m_ready_count);
-              Kokkos::atomic_decrement(&steal_from.m_ready_count);
-              return rv;
+        for (int distance = first_distance;
+             distance <= TaskQueueLocality::Remote; ++distance) {
+          for (int iteam = 0; iteam < m_other_queues->size(); ++iteam) {
+            if (iteam == m_league_rank) continue;
+            auto& steal_from = get_team_queue(iteam);
+            if (m_locality.distance(steal_from.m_locality) != distance) {
+              continue;
+            }
+            if (*((volatile int*)&steal_from.m_ready_count) > 0) {
+              // we've found at least one queue that's not done, so even if we
+              // can't pop something off of it we shouldn't return a nullptr
+              // indicating completion.  rv will be end_tag when the pop fails
+              rv = base_t::pop_ready_task(&steal_from.m_ready[i][j]);
+              if (rv != end_tag) {
+                // task stolen.
+                // first increment our ready count, then decrement the ready
+                // count on the other queue:
+                Kokkos::atomic_increment(&this->m_ready_count);
+                Kokkos::atomic_decrement(&steal_from.m_ready_count);
+                Kokkos::atomic_increment(distance < TaskQueueLocality::Remote
+                                             ? &m_steals.local
+                                             : &m_steals.remote);
+                return rv;
+              }
             }
           }
         }
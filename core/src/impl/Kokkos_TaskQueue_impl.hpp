@@ -377,6 +377,9 @@ KOKKOS_FUNCTION void TaskQueue<ExecSpace, MemorySpace>::schedule_runnable(
   task_root_type *dep = t.m_next;
   t.m_next            = zero;
 
+  // Tasks on the path to this task run at least at its priority.
+  if (nullptr != dep) dep->inherit_priority(t.m_priority);
+
   Kokkos::memory_fence();
 
   // If we don't have a dependency, or if pushing onto the wait queue of that
@@ -402,6 +405,9 @@ KOKKOS_FUNCTION void TaskQueue<ExecSpace, MemorySpace>::schedule_runnable(
 
     Kokkos::atomic_increment(&m_ready_count);
 
+    // The ready queue is chosen by priority, so raise it first.
+    inherit_waiting_priority(task);
+
     task_root_type *volatile *const ready_queue =
         &m_ready[t.m_priority][t.m_task_type];
 
@@ -481,6 +487,10 @@ KOKKOS_FUNCTION void TaskQueue<ExecSpace, MemorySpace>::schedule_aggregate(
 
   task_root_type *volatile *const aggr = t.aggregate_dependences();
 
+  // Tasks on the paths to this when_all run at least at the priority
+  // of the tasks waiting on it.
+  inherit_waiting_priority(task);
+
   // Assume the 'when_all' is complete until a dependence is
   // found that is not complete.
 
@@ -540,6 +550,60 @@ KOKKOS_FUNCTION void TaskQueue<ExecSpace, MemorySpace>::schedule_aggregate(
 
 //----------------------------------------------------------------------------
 
+template <typename ExecSpace, typename MemorySpace>
+KOKKOS_FUNCTION void
+TaskQueue<ExecSpace, MemorySpace>::inherit_waiting_priority(
+    TaskQueue<ExecSpace, MemorySpace>::task_root_type *const task) {
+  // Bound the search so that scheduling stays cheap for wide graphs.
+  int budget = 64;
+  inherit_waiting_priority(task, 8, budget);
+}
+
+template <typename ExecSpace, typename MemorySpace>
+KOKKOS_FUNCTION void
+TaskQueue<ExecSpace, MemorySpace>::inherit_waiting_priority(
+    TaskQueue<ExecSpace, MemorySpace>::task_root_type *const task, int depth,
+    int &budget) {
+  // Precondition:
+  // - task is not complete, so neither are the tasks waiting on it;
+  //   none of them can be rescheduled or deallocated during this call
+  //   and their wait lists are not locked.
+
+  task_root_type *const zero = nullptr;
+  task_root_type *const lock = (task_root_type *)task_root_type::LockTag;
+  task_root_type *const end  = (task_root_type *)task_root_type::EndTag;
+
+  task_root_type volatile &t = *task;
+
+  // Tasks are only pushed onto the head of a wait list,
+  // so the list from a snapshot of the head stays intact.
+  task_root_type *x = t.m_wait;
+
+  while (x != end && x != lock && x != zero) {
+    if (0 < depth && 0 < budget) {
+      --budget;
+      inherit_waiting_priority(x, depth - 1, budget);
+    }
+
+    task_root_type volatile &vx = *x;
+
+    t.inherit_priority(vx.m_priority);
+
+    x = vx.m_next;
+  }
+
+  if (task_root_type::Aggregate == t.m_task_type) {
+    task_root_type *volatile *const aggr = t.aggregate_dependences();
+
+    for (int i = 0; i < t.m_dep_count; ++i) {
+      task_root_type *const dep = aggr[i];
+      if (zero != dep) dep->inherit_priority(t.m_priority);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+
 template <typename ExecSpace, typename MemorySpace>
 KOKKOS_FUNCTION void TaskQueue<ExecSpace, MemorySpace>::reschedule(
     task_root_type *task) {
@@ -74,6 +74,7 @@ namespace Impl {
 
 struct WithoutInitializing_t {};
 struct AllowPadding_t {};
+struct FirstTouch_t {};
 struct NullSpace_t {};
 
 //----------------------------------------------------------------------------
@@ -135,7 +136,8 @@ struct ViewCtorProp<void, std::integral_constant<unsigned, I> > {
 template <typename P>
 struct ViewCtorProp<typename std::enable_if<
                         std::is_same<P, AllowPadding_t>::value ||
-                        std::is_same<P, WithoutInitializing_t>::value>::type,
+                        std::is_same<P, WithoutInitializing_t>::value ||
+                        std::is_same<P, FirstTouch_t>::value>::type,
                     P> {
   ViewCtorProp()                     = default;
   ViewCtorProp(const ViewCtorProp &) = default;
@@ -248,6 +250,7 @@ struct ViewCtorProp : public ViewCtorProp<void, P>... {
   enum {
     initialize = !Kokkos::Impl::has_type<WithoutInitializing_t, P...>::value
   };
+  enum { first_touch = Kokkos::Impl::has_type<FirstTouch_t, P...>::value };
 
   using memory_space    = typename var_memory_space::type;
   using execution_space = typename var_execution_space::type;
@@ -2931,6 +2931,66 @@ struct ViewValueFunctor<ExecSpace, ValueType, true /* is_scalar */> {
   void destroy_shared_allocation() {}
 };
 
+/*
+ *  Touch one byte of every page of an uninitialized HostSpace allocation
+ *  with the same RangePolicy partition that ViewValueFunctor uses, so that
+ *  a first touch page placement policy places each page in the NUMA region
+ *  of the thread which later works on the corresponding entries.
+ *  A no-op unless the memory space is HostSpace and is accessible from
+ *  the execution space.
+ */
+template <class ExecSpace, class MemorySpace, class ValueType,
+          bool IsHost =
+              std::is_same<MemorySpace, Kokkos::HostSpace>::value&&
+                  Kokkos::Impl::SpaceAccessibility<
+                      ExecSpace, Kokkos::HostSpace>::accessible>
+struct ViewFirstTouchFunctor {
+  static void execute(ExecSpace const&, ValueType* const, size_t const,
+                      std::string const&) {}
+};
+
+template <class ExecSpace, class MemorySpace, class ValueType>
+struct ViewFirstTouchFunctor<ExecSpace, MemorySpace, ValueType, true> {
+  using PolicyType = Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<int64_t>>;
+
+  enum : uintptr_t { page_size = 4096 };
+
+  char* ptr;
+
+  // Touch the page boundaries which fall within the i-th entry.
+  // The page holding the first entry also holds the allocation header
+  // and has already been touched by the allocating thread.
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t i) const {
+    const uintptr_t begin =
+        reinterpret_cast<uintptr_t>(ptr) + i * sizeof(ValueType);
+    const uintptr_t end = begin + sizeof(ValueType);
+    for (uintptr_t page = (begin + page_size - 1) & ~uintptr_t(page_size - 1);
+         page < end; page += page_size) {
+      *reinterpret_cast<char volatile*>(page) = 0;
+    }
+  }
+
+  static void execute(ExecSpace const& space, ValueType* const arg_ptr,
+                      size_t const n, std::string const& name) {
+    if (space.in_parallel()) return;
+
+    uint64_t kpID = 0;
+    if (Kokkos::Profiling::profileLibraryLoaded()) {
+      Kokkos::Profiling::beginParallelFor(
+          "Kokkos::View::first_touch [" + name + "]", 0, &kpID);
+    }
+    const ViewFirstTouchFunctor functor{reinterpret_cast<char*>(arg_ptr)};
+    const Kokkos::Impl::ParallelFor<ViewFirstTouchFunctor, PolicyType> closure(
+        functor, PolicyType(space, 0, n));
+    closure.execute();
+    space.fence();
+    if (Kokkos::Profiling::profileLibraryLoaded()) {
+      Kokkos::Profiling::endParallelFor(kpID);
+    }
+  }
+};
+
 //----------------------------------------------------------------------------
 /** \brief  View mapping for non-specialized data type and standard layout */
 template <class Traits>
@@ -3257,6 +3317,15 @@ class ViewMapping<
 
       // Construct values
       record->m_destroy.construct_shared_allocation();
+    } else if (alloc_size &&
+               (alloc_prop::first_touch || Kokkos::Impl::host_first_touch())) {
+      // Construction touches the pages in parallel, uninitialized
+      // allocations are only touched on request.
+      ViewFirstTouchFunctor<execution_space, memory_space, value_type>::
+          execute(static_cast<Kokkos::Impl::ViewCtorProp<
+                      void, execution_space> const&>(arg_prop)
+                      .value,
+                  (value_type*)m_impl_handle, m_impl_offset.span(), alloc_name);
     }
 
     return record;
@@ -44,10 +44,18 @@
 
 #define DEBUG_PRINT 0
 
+#include <cstdint>
 #include <iostream>
 #include <sstream>
+#include <fstream>
+#include <string>
+#include <vector>
 #include <algorithm>
 
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
 #include <Kokkos_Macros.hpp>
 #include <Kokkos_Core.hpp>
 #include <Kokkos_hwloc.hpp>
@@ -224,6 +232,98 @@ unsigned thread_mapping(const char* const label, const bool allow_async,
   return thread_spawn_synchronous;
 }
 
+namespace {
+
+/* Parse a Linux cpu list such as "0-15,32-47" into 'cpus'.
+ * Return false if the list is malformed.
+ */
+bool parse_cpu_list(const std::string& list, std::vector<unsigned>& cpus) {
+  std::istringstream ranges(list);
+  std::string range;
+  while (std::getline(ranges, range, ',')) {
+    unsigned first = 0, last = 0;
+    char dash      = 0;
+    std::istringstream bounds(range);
+    if (!(bounds >> first)) return false;
+    last = first;
+    if (bounds >> dash && !(dash == '-' && bounds >> last)) return false;
+    if (last < first) return false;
+    for (unsigned cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+  }
+  return true;
+}
+
+/* Number of hardware threads sharing the last level cache of cpu0
+ * as reported by Linux sysfs, 0 if not available.
+ */
+unsigned sysfs_threads_per_last_level_cache() {
+  const std::string cache("/sys/devices/system/cpu/cpu0/cache/index");
+
+  int last_level = 0;
+  std::string shared_cpu_list;
+
+  for (int index = 0; index < 16; ++index) {
+    std::ifstream level_file(cache + std::to_string(index) + "/level");
+    std::ifstream list_file(cache + std::to_string(index) + "/shared_cpu_list");
+    int level = 0;
+    std::string list;
+    if (!(level_file >> level) || !(list_file >> list)) break;
+    if (last_level < level) {
+      last_level      = level;
+      shared_cpu_list = list;
+    }
+  }
+
+  std::vector<unsigned> cpus;
+  return parse_cpu_list(shared_cpu_list, cpus) ? cpus.size() : 0;
+}
+
+}  // namespace
+
+unsigned get_available_threads_per_domain() {
+  if (available() && 1 < get_available_numa_count()) {
+    return get_available_cores_per_numa() * get_available_threads_per_core();
+  }
+  return sysfs_threads_per_last_level_cache();
+}
+
+namespace {
+
+/* Operating system ids of the NUMA nodes with memory as reported by
+ * Linux sysfs, empty if not available.
+ */
+std::vector<unsigned> sysfs_memory_numa_ids() {
+  const char* const lists[] = {"/sys/devices/system/node/has_memory",
+                               "/sys/devices/system/node/online"};
+  for (const char* const name : lists) {
+    std::ifstream list_file(name);
+    std::string list;
+    std::vector<unsigned> nodes;
+    if ((list_file >> list) && parse_cpu_list(list, nodes) && !nodes.empty()) {
+      return nodes;
+    }
+  }
+  return std::vector<unsigned>();
+}
+
+const std::vector<unsigned>& memory_numa_ids() {
+  static const std::vector<unsigned> ids = sysfs_memory_numa_ids();
+  return ids;
+}
+
+}  // namespace
+
+unsigned get_memory_numa_count() {
+  const std::vector<unsigned>& ids = memory_numa_ids();
+  return ids.empty() ? get_available_numa_count() : unsigned(ids.size());
+}
+
+int get_memory_numa_id(const unsigned numa) {
+  const std::vector<unsigned>& ids = memory_numa_ids();
+  if (ids.empty()) return numa < get_available_numa_count() ? int(numa) : -1;
+  return numa < ids.size() ? int(ids[numa]) : -1;
+}
+
 } /* namespace hwloc */
 } /* namespace Kokkos */
 
@@ -680,6 +780,30 @@ bool unbind_this_thread() {
 #undef HWLOC_DEBUG_PRINT
 }
 
+namespace {
+
+/* Bind the current thread to all cores of a NUMA region. */
+bool bind_this_thread_to_numa(const unsigned numa) {
+  if (!sentinel() || s_core_topology.first <= numa) return false;
+
+  hwloc_bitmap_t region = hwloc_bitmap_alloc();
+
+  for (unsigned i = 0; i < s_core_topology.second; ++i) {
+    hwloc_bitmap_or(region, region,
+                    s_core[i + numa * s_core_topology.second]);
+  }
+
+  const bool result =
+      0 == hwloc_set_cpubind(s_hwloc_topology, region,
+                             HWLOC_CPUBIND_THREAD | HWLOC_CPUBIND_STRICT);
+
+  hwloc_bitmap_free(region);
+
+  return result;
+}
+
+}  // namespace
+
 //----------------------------------------------------------------------------
 
 std::pair<unsigned, unsigned> get_this_thread_coordinate() {
@@ -738,6 +862,12 @@ std::pair<unsigned, unsigned> get_this_thread_coordinate() {
   return std::pair<unsigned, unsigned>(0, 0);
 }
 
+namespace {
+
+bool bind_this_thread_to_numa(const unsigned) { return false; }
+
+}  // namespace
+
 }  // namespace hwloc
 }  // namespace Kokkos
 
@@ -745,3 +875,314 @@ std::pair<unsigned, unsigned> get_this_thread_coordinate() {
 //----------------------------------------------------------------------------
 
 #endif
+
+//----------------------------------------------------------------------------
+// Placement of the persistent threads of host thread pools.
+
+namespace Kokkos {
+namespace hwloc {
+namespace {
+
+BindPolicy s_bind_policy = BindPolicy::NONE;
+
+/* Block of 'count' equal blocks containing rank 'pool_rank'. */
+unsigned pool_block(const unsigned pool_rank, const unsigned pool_size,
+                    const unsigned count) {
+  return (uint64_t(pool_rank) * count) / pool_size;
+}
+
+/* Core, out of 'core_count' cores ordered by NUMA region, on which
+ * the thread of rank 'pool_rank' is placed.
+ */
+unsigned pool_core(const BindPolicy policy, const unsigned pool_rank,
+                   const unsigned pool_size, const unsigned core_count,
+                   const unsigned threads_per_core) {
+  return BindPolicy::COMPACT == policy
+             ? (pool_rank / std::max(threads_per_core, 1u)) % core_count
+             : pool_block(pool_rank, pool_size, core_count);
+}
+
+#if defined(__linux__)
+
+/* Cores and NUMA regions available to the process as reported by
+ * Linux sysfs, used when hwloc cannot bind threads.
+ */
+struct SysfsTopology {
+  std::vector<std::vector<unsigned> > cores;  // cpus of each core
+  std::vector<std::vector<unsigned> > numa;   // cpus of each NUMA region
+  unsigned threads_per_core;
+  cpu_set_t process;  // binding of the process before any placement
+};
+
+SysfsTopology load_sysfs_topology() {
+  SysfsTopology topology;
+
+  topology.threads_per_core = 0;
+
+  CPU_ZERO(&topology.process);
+
+  if (sched_getaffinity(0, sizeof(cpu_set_t), &topology.process)) {
+    return topology;
+  }
+
+  const std::string cpu("/sys/devices/system/cpu/cpu");
+  const std::string node("/sys/devices/system/node/node");
+
+  // All cpus form one region if the kernel does not report NUMA regions
+  std::vector<std::vector<unsigned> > regions;
+  {
+    std::ifstream online_file("/sys/devices/system/node/online");
+    std::string online;
+    std::vector<unsigned> nodes;
+    if ((online_file >> online) && parse_cpu_list(online, nodes)) {
+      for (const unsigned n : nodes) {
+        std::ifstream list_file(node + std::to_string(n) + "/cpulist");
+        std::string list;
+        std::vector<unsigned> cpus;
+        if ((list_file >> list) && parse_cpu_list(list, cpus)) {
+          regions.push_back(cpus);
+        }
+      }
+    }
+    if (regions.empty()) {
+      regions.resize(1);
+      for (unsigned c = 0; c < CPU_SETSIZE; ++c) regions[0].push_back(c);
+    }
+  }
+
+  for (const std::vector<unsigned>& region : regions) {
+    std::vector<unsigned> region_cpus;
+    std::vector<std::pair<int, int> > core_ids;
+    const size_t core_begin = topology.cores.size();
+
+    for (const unsigned c : region) {
+      if (CPU_SETSIZE <= c || !CPU_ISSET(c, &topology.process)) continue;
+
+      // Hyperthreads of a core share the package and core id,
+      // a cpu without topology information is its own core.
+      std::ifstream package_file(cpu + std::to_string(c) +
+                                 "/topology/physical_package_id");
+      std::ifstream core_file(cpu + std::to_string(c) + "/topology/core_id");
+      std::pair<int, int> id(-1, int(c));
+      if (!(package_file >> id.first) || !(core_file >> id.second)) {
+        id = std::pair<int, int>(-1, int(c));
+      }
+
+      const size_t k =
+          std::find(core_ids.begin(), core_ids.end(), id) - core_ids.begin();
+      if (k == core_ids.size()) {
+        core_ids.push_back(id);
+        topology.cores.push_back(std::vector<unsigned>());
+      }
+      topology.cores[core_begin + k].push_back(c);
+      region_cpus.push_back(c);
+    }
+
+    if (!region_cpus.empty()) topology.numa.push_back(region_cpus);
+  }
+
+  for (const std::vector<unsigned>& core : topology.cores) {
+    if (!topology.threads_per_core || core.size() < topology.threads_per_core)
+      topology.threads_per_core = core.size();
+  }
+
+  return topology;
+}
+
+const SysfsTopology& sysfs_topology() {
+  static const SysfsTopology topology = load_sysfs_topology();
+  return topology;
+}
+
+bool sysfs_bind_this_thread(const std::vector<unsigned>& cpus) {
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (const unsigned c : cpus) CPU_SET(c, &set);
+  return 0 == sched_setaffinity(0, sizeof(cpu_set_t), &set);
+}
+
+/* Core, last level cache and package ids of every cpu, -1 if unknown.
+ * A core or cache is identified by the lowest cpu sharing it.
+ */
+struct SysfsLocality {
+  std::vector<int> core;
+  std::vector<int> cache;
+  std::vector<int> package;
+};
+
+int sysfs_lowest_cpu(const std::string& file_name) {
+  std::ifstream list_file(file_name);
+  std::string list;
+  std::vector<unsigned> cpus;
+  if (!(list_file >> list) || !parse_cpu_list(list, cpus) || cpus.empty()) {
+    return -1;
+  }
+  return int(*std::min_element(cpus.begin(), cpus.end()));
+}
+
+SysfsLocality load_sysfs_locality() {
+  SysfsLocality locality;
+
+  locality.core.assign(CPU_SETSIZE, -1);
+  locality.cache.assign(CPU_SETSIZE, -1);
+  locality.package.assign(CPU_SETSIZE, -1);
+
+  const std::string cpu("/sys/devices/system/cpu/cpu");
+
+  // Only probe the online cpus, which are far fewer than CPU_SETSIZE
+  std::ifstream online_file("/sys/devices/system/cpu/online");
+  std::string online;
+  std::vector<unsigned> cpus;
+  if (!(online_file >> online) || !parse_cpu_list(online, cpus)) {
+    return locality;
+  }
+
+  for (const unsigned c : cpus) {
+    if (unsigned(CPU_SETSIZE) <= c) continue;
+
+    const std::string dir = cpu + std::to_string(c);
+
+    std::ifstream package_file(dir + "/topology/physical_package_id");
+    if (!(package_file >> locality.package[c])) {
+      locality.package[c] = -1;
+      continue;
+    }
+
+    locality.core[c] = sysfs_lowest_cpu(dir + "/topology/thread_siblings_list");
+
+    int last_level = 0;
+    for (int index = 0; index < 16; ++index) {
+      const std::string cache = dir + "/cache/index" + std::to_string(index);
+      std::ifstream level_file(cache + "/level");
+      int level = 0;
+      if (!(level_file >> level)) break;
+      if (last_level < level) {
+        last_level        = level;
+        locality.cache[c] = sysfs_lowest_cpu(cache + "/shared_cpu_list");
+      }
+    }
+  }
+
+  return locality;
+}
+
+#endif
+
+}  // namespace
+
+BindPolicy get_bind_policy() noexcept { return s_bind_policy; }
+
+void set_bind_policy(const BindPolicy policy) {
+  s_bind_policy = policy;
+
+#if defined(__linux__)
+  // Record the process binding before any thread is placed.
+  if (BindPolicy::NONE != policy && !can_bind_threads()) sysfs_topology();
+#endif
+}
+
+bool bind_pool_thread(const unsigned pool_rank, const unsigned pool_size) {
+  if (BindPolicy::NONE == s_bind_policy || pool_size <= pool_rank) {
+    return false;
+  }
+
+  if (can_bind_threads()) {
+    const unsigned numa_count     = get_available_numa_count();
+    const unsigned cores_per_numa = get_available_cores_per_numa();
+
+    if (!numa_count || !cores_per_numa) return false;
+
+    if (BindPolicy::NUMA == s_bind_policy) {
+      return bind_this_thread_to_numa(
+          pool_block(pool_rank, pool_size, numa_count));
+    }
+
+    const unsigned core =
+        pool_core(s_bind_policy, pool_rank, pool_size,
+                  numa_count * cores_per_numa, get_available_threads_per_core());
+
+    return bind_this_thread(std::pair<unsigned, unsigned>(
+        core / cores_per_numa, core % cores_per_numa));
+  }
+
+#if defined(__linux__)
+  const SysfsTopology& topology = sysfs_topology();
+
+  if (topology.cores.empty()) return false;
+
+  if (BindPolicy::NUMA == s_bind_policy) {
+    return sysfs_bind_this_thread(
+        topology.numa[pool_block(pool_rank, pool_size, topology.numa.size())]);
+  }
+
+  return sysfs_bind_this_thread(
+      topology.cores[pool_core(s_bind_policy, pool_rank, pool_size,
+                               topology.cores.size(),
+                               topology.threads_per_core)]);
+#else
+  return false;
+#endif
+}
+
+bool unbind_pool_thread() {
+  if (BindPolicy::NONE == s_bind_policy) return false;
+
+  if (can_bind_threads()) return unbind_this_thread();
+
+#if defined(__linux__)
+  return 0 == sched_setaffinity(0, sizeof(cpu_set_t),
+                                &sysfs_topology().process);
+#else
+  return false;
+#endif
+}
+
+bool get_this_thread_locality(int& core, int& cache, int& package) {
+#if defined(__linux__)
+  static const SysfsLocality locality = load_sysfs_locality();
+
+  // The cpu the thread currently runs on says nothing about where it will
+  // run next unless the thread is bound, so only report the core, cache
+  // and package shared by every cpu of its affinity mask.
+  cpu_set_t mask;
+  if (0 != sched_getaffinity(0, sizeof(cpu_set_t), &mask)) return false;
+
+  enum : int { Unset = -2, Mixed = -1 };
+
+  int mask_core    = Unset;
+  int mask_cache   = Unset;
+  int mask_package = Unset;
+
+  auto merge = [](int& id, const int cpu_id) {
+    if (Unset == id) {
+      id = cpu_id;
+    } else if (id != cpu_id) {
+      id = Mixed;
+    }
+  };
+
+  for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+    if (!CPU_ISSET(cpu, &mask)) continue;
+    if (locality.package[cpu] < 0) return false;
+    merge(mask_core, locality.core[cpu]);
+    merge(mask_cache, locality.cache[cpu]);
+    merge(mask_package, locality.package[cpu]);
+  }
+
+  if (mask_package < 0) return false;
+
+  core    = mask_core;
+  cache   = mask_cache;
+  package = mask_package;
+
+  return true;
+#else
+  (void)core;
+  (void)cache;
+  (void)package;
+  return false;
+#endif
+}
+
+}  // namespace hwloc
+}  // namespace Kokkos
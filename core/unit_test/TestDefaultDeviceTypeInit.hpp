@@ -45,11 +45,18 @@
 #include <gtest/gtest.h>
 
 #include <Kokkos_Core.hpp>
+#include <impl/Kokkos_Spinwait.hpp>
 
 #ifdef KOKKOS_ENABLE_OPENMP
 #include <omp.h>
 #endif
 
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include <vector>
+
 #if !defined(KOKKOS_ENABLE_CUDA) || defined(__CUDACC__)
 
 namespace Test {
@@ -474,6 +481,311 @@ TEST(defaultdevicetypeinit, initstruct_nthreads_numa_device) {
 }
 #endif
 
+#ifdef KOKKOS_DEFAULTDEVICETYPE_INIT_TEST_17
+TEST(defaultdevicetypeinit, commandline_args_wait_policy) {
+  char arg0[] = "--kokkos-wait-policy=passive";
+  char arg1[] = "--other";
+  char* args[] = {arg0, arg1};
+  int nargs    = 2;
+
+  Kokkos::initialize(nargs, args);
+  ASSERT_EQ(nargs, 1);
+  ASSERT_EQ(std::string(args[0]), std::string("--other"));
+  ASSERT_EQ(Kokkos::Impl::host_wait_policy(),
+            Kokkos::Impl::WaitPolicy::PASSIVE);
+  {
+    // Repeated launches must wake the sleeping threads.
+    const int n = 1000;
+    Kokkos::View<int*, Kokkos::DefaultHostExecutionSpace> v("v", n);
+    for (int r = 0; r < 100; ++r) {
+      Kokkos::parallel_for(
+          Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, n),
+          KOKKOS_LAMBDA(const int i) { v(i) += 1; });
+      int sum = 0;
+      Kokkos::parallel_reduce(
+          Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, n),
+          KOKKOS_LAMBDA(const int i, int& update) { update += v(i); }, sum);
+      ASSERT_EQ(sum, n * (r + 1));
+    }
+  }
+  Kokkos::finalize();
+  ASSERT_EQ(Kokkos::Impl::host_wait_policy(),
+            Kokkos::Impl::WaitPolicy::ACTIVE);
+}
+#endif
+
+#ifdef KOKKOS_DEFAULTDEVICETYPE_INIT_TEST_18
+TEST(defaultdevicetypeinit, commandline_args_bind) {
+  char arg0[] = "--kokkos-bind=scatter";
+  char arg1[] = "--other";
+  char* args[] = {arg0, arg1};
+  int nargs    = 2;
+
+  Kokkos::initialize(nargs, args);
+  ASSERT_EQ(nargs, 1);
+  ASSERT_EQ(std::string(args[0]), std::string("--other"));
+  ASSERT_EQ(Kokkos::hwloc::get_bind_policy(),
+            Kokkos::hwloc::BindPolicy::SCATTER);
+  {
+    // Placed threads must still cover the whole range.
+    const int n = 1000;
+    int sum     = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, n),
+        KOKKOS_LAMBDA(const int i, int& update) { update += i; }, sum);
+    ASSERT_EQ(sum, n * (n - 1) / 2);
+  }
+  Kokkos::finalize();
+  ASSERT_EQ(Kokkos::hwloc::get_bind_policy(), Kokkos::hwloc::BindPolicy::NONE);
+}
+#endif
+
+#ifdef KOKKOS_DEFAULTDEVICETYPE_INIT_TEST_19
+TEST(defaultdevicetypeinit, commandline_args_huge_pages) {
+  char arg0[] = "--kokkos-huge-pages";
+  char arg1[] = "--kokkos-huge-page-threshold=4194304";
+  char arg2[] = "--other";
+  char* args[] = {arg0, arg1, arg2};
+  int nargs    = 3;
+
+  Kokkos::initialize(nargs, args);
+  ASSERT_EQ(nargs, 1);
+  ASSERT_EQ(std::string(args[0]), std::string("--other"));
+  ASSERT_TRUE(Kokkos::Impl::host_huge_pages());
+  ASSERT_EQ(Kokkos::Impl::host_huge_page_threshold(), size_t(4194304));
+  {
+    const size_t huge_page = size_t(1) << 21;
+    const Kokkos::Impl::HostHugePageStatistics before =
+        Kokkos::Impl::host_huge_page_statistics();
+
+    // Allocations below the threshold keep using base pages.
+    Kokkos::View<char*, Kokkos::HostSpace> small("small", 1 << 20);
+    ASSERT_EQ(Kokkos::Impl::host_huge_page_statistics().allocation_count,
+              before.allocation_count);
+
+    const size_t n = 3 * huge_page + 100;
+    Kokkos::HostSpace space;
+    char* const ptr = static_cast<char*>(space.allocate(n));
+    std::memset(ptr, 1, n);
+    const Kokkos::Impl::HostHugePageStatistics after =
+        Kokkos::Impl::host_huge_page_statistics();
+#if defined(MADV_HUGEPAGE)
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % huge_page, 0u);
+    ASSERT_EQ(after.allocation_count, before.allocation_count + 1);
+    ASSERT_EQ(after.allocation_bytes, before.allocation_bytes + n);
+#else
+    ASSERT_EQ(after.allocation_count, before.allocation_count);
+#endif
+    space.deallocate(ptr, n);
+
+    // Large Views are usable as before.
+    const int m = 1 << 20;
+    Kokkos::View<double*, Kokkos::HostSpace> v("v", m);
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, m),
+        KOKKOS_LAMBDA(const int i) { v(i) = 1.0; });
+    double sum = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, m),
+        KOKKOS_LAMBDA(const int i, double& update) { update += v(i); }, sum);
+    ASSERT_EQ(sum, double(m));
+  }
+  Kokkos::finalize();
+  ASSERT_FALSE(Kokkos::Impl::host_huge_pages());
+  ASSERT_EQ(Kokkos::Impl::host_huge_page_threshold(), size_t(1) << 21);
+}
+#endif
+
+#ifdef KOKKOS_DEFAULTDEVICETYPE_INIT_TEST_20
+TEST(defaultdevicetypeinit, commandline_args_host_cache) {
+  char arg0[] = "--kokkos-host-cache=1048576";
+  char arg1[] = "--other";
+  char* args[] = {arg0, arg1};
+  int nargs    = 2;
+
+  Kokkos::initialize(nargs, args);
+  ASSERT_EQ(nargs, 1);
+  ASSERT_EQ(std::string(args[0]), std::string("--other"));
+  ASSERT_EQ(Kokkos::Impl::host_cache_capacity(), size_t(1048576));
+  {
+    using view_type = Kokkos::View<double*, Kokkos::HostSpace>;
+
+    // A freed View allocation is reused by the next one of its size.
+    const Kokkos::Impl::HostCacheStatistics before =
+        Kokkos::Impl::host_cache_statistics();
+    double* ptr = nullptr;
+    {
+      view_type a("A", 1000);
+      ptr = a.data();
+    }
+    {
+      view_type b("B", 1000);
+      ASSERT_EQ(b.data(), ptr);
+      ASSERT_EQ(b(0), 0.0);
+      ASSERT_EQ(b(999), 0.0);
+    }
+    const Kokkos::Impl::HostCacheStatistics after =
+        Kokkos::Impl::host_cache_statistics();
+    ASSERT_EQ(after.hit_count, before.hit_count + 1);
+    ASSERT_GT(after.cached_bytes, 0u);
+
+    // The cache never holds more than its capacity.
+    {
+      std::vector<view_type> views;
+      for (int i = 0; i < 64; ++i) {
+        views.push_back(view_type("V", 4096 + i));
+      }
+    }
+    ASSERT_LE(Kokkos::Impl::host_cache_statistics().cached_bytes,
+              Kokkos::Impl::host_cache_capacity());
+
+    // Concurrent allocations from the host threads.
+    const int n = 1000;
+    int errors  = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, n),
+        KOKKOS_LAMBDA(const int i, int& update) {
+          Kokkos::HostSpace space;
+          const size_t size = 64 * (i % 7 + 1) + i % 13;
+          char* const p     = static_cast<char*>(space.allocate(size));
+          for (size_t j = 0; j < size; ++j) p[j] = char(i);
+          for (size_t j = 0; j < size; ++j) update += (p[j] != char(i));
+          space.deallocate(p, size);
+        },
+        errors);
+    ASSERT_EQ(errors, 0);
+
+    Kokkos::Impl::host_cache_release();
+    ASSERT_EQ(Kokkos::Impl::host_cache_statistics().cached_bytes, 0u);
+
+    // A zero capacity disables the cache: allocations no longer look up a
+    // block, and a block handed out before is still freed by its class.
+    view_type live("live", 1000);
+    Kokkos::Impl::set_host_cache_capacity(0);
+    const size_t misses = Kokkos::Impl::host_cache_statistics().miss_count;
+    {
+      view_type c("C", 1000);
+      c(999) = 1.0;
+    }
+    live = view_type();
+    ASSERT_EQ(Kokkos::Impl::host_cache_statistics().miss_count, misses);
+    ASSERT_EQ(Kokkos::Impl::host_cache_statistics().cached_bytes, 0u);
+
+    // An allocation made while the cache is disabled is not a block of the
+    // cache once it is enabled, so it is freed instead of cached.
+    view_type exact("exact", 1000);
+    Kokkos::Impl::set_host_cache_capacity(1048576);
+    exact = view_type();
+    ASSERT_EQ(Kokkos::Impl::host_cache_statistics().cached_bytes, 0u);
+    {
+      view_type d("D", 1000);
+      d(999) = 1.0;
+    }
+    ASSERT_GT(Kokkos::Impl::host_cache_statistics().cached_bytes, 0u);
+  }
+  Kokkos::finalize();
+  ASSERT_EQ(Kokkos::Impl::host_cache_capacity(), 0u);
+  ASSERT_EQ(Kokkos::Impl::host_cache_statistics().cached_bytes, 0u);
+
+  // The same once no block of the cache is live.
+  Kokkos::HostSpace space;
+  void* const ptr = space.allocate(1000);
+  Kokkos::Impl::set_host_cache_capacity(1048576);
+  space.deallocate(ptr, 1000);
+  ASSERT_EQ(Kokkos::Impl::host_cache_statistics().cached_bytes, 0u);
+  Kokkos::Impl::set_host_cache_capacity(0);
+}
+#endif
+
+#ifdef KOKKOS_DEFAULTDEVICETYPE_INIT_TEST_21
+TEST(defaultdevicetypeinit, commandline_args_memory_usage) {
+  char arg0[] = "--kokkos-memory-usage";
+  char arg1[] = "--other";
+  char* args[] = {arg0, arg1};
+  int nargs    = 2;
+
+  Kokkos::initialize(nargs, args);
+  ASSERT_EQ(nargs, 1);
+  ASSERT_EQ(std::string(args[0]), std::string("--other"));
+  ASSERT_TRUE(Kokkos::Impl::memory_usage_print());
+  {
+    using memory_space = Kokkos::DefaultExecutionSpace::memory_space;
+    using Kokkos::Experimental::memory_usage;
+    using Kokkos::Experimental::MemoryUsage;
+
+    Kokkos::Experimental::track_memory_usage("usage:");
+    Kokkos::Experimental::track_memory_usage("usage:b");
+
+    const MemoryUsage before = memory_usage<memory_space>();
+    {
+      Kokkos::View<double*, memory_space> a("usage:a", 1000);
+      Kokkos::View<double*, memory_space> b("usage:b", 3000);
+      Kokkos::View<int*, memory_space> c("other", 500);
+
+      const MemoryUsage all = memory_usage<memory_space>();
+      ASSERT_EQ(all.live_bytes, before.live_bytes + a.span() * sizeof(double) +
+                                    b.span() * sizeof(double) +
+                                    c.span() * sizeof(int));
+      ASSERT_EQ(all.live_count, before.live_count + 3);
+      ASSERT_GE(all.peak_bytes, all.live_bytes);
+
+      const MemoryUsage prefix = memory_usage<memory_space>("usage:");
+      ASSERT_EQ(prefix.live_bytes, 4000 * sizeof(double));
+      ASSERT_EQ(prefix.peak_bytes, 4000 * sizeof(double));
+      ASSERT_EQ(prefix.live_count, 2u);
+      ASSERT_EQ(prefix.allocation_count, 2u);
+      ASSERT_EQ(memory_usage<memory_space>("usage:b").live_bytes,
+                3000 * sizeof(double));
+
+      // Copies share the allocation.
+      Kokkos::View<double*, memory_space> d = a;
+      ASSERT_EQ(memory_usage<memory_space>("usage:").live_count, 2u);
+    }
+    MemoryUsage prefix = memory_usage<memory_space>("usage:");
+    ASSERT_EQ(prefix.live_bytes, 0u);
+    ASSERT_EQ(prefix.live_count, 0u);
+    ASSERT_EQ(prefix.peak_bytes, 4000 * sizeof(double));
+    ASSERT_EQ(memory_usage<memory_space>().live_bytes, before.live_bytes);
+
+    // A new phase begins with the peak at the live bytes.
+    Kokkos::View<double*, memory_space> e("usage:e", 100);
+    Kokkos::Experimental::reset_memory_usage();
+    prefix = memory_usage<memory_space>("usage:");
+    ASSERT_EQ(prefix.peak_bytes, 100 * sizeof(double));
+    ASSERT_EQ(prefix.allocation_count, 0u);
+    {
+      Kokkos::View<double*, memory_space> f("usage:f", 200);
+    }
+    prefix = memory_usage<memory_space>("usage:");
+    ASSERT_EQ(prefix.live_bytes, 100 * sizeof(double));
+    ASSERT_EQ(prefix.peak_bytes, 300 * sizeof(double));
+    ASSERT_EQ(prefix.allocation_count, 1u);
+
+    // Concurrent allocations from the host threads.
+    const int n = 200;
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, n),
+        [](const int i) {
+          Kokkos::View<char*, Kokkos::HostSpace> v(
+              Kokkos::view_alloc(Kokkos::WithoutInitializing, "usage:host"),
+              1 + i);
+        });
+    const size_t host_live =
+        std::is_same<memory_space, Kokkos::HostSpace>::value
+            ? 100 * sizeof(double)
+            : 0;
+    prefix = memory_usage<Kokkos::HostSpace>("usage:");
+    ASSERT_EQ(prefix.live_bytes, host_live);
+    ASSERT_GE(prefix.allocation_count, size_t(n));
+
+    ASSERT_EQ(memory_usage("NoSuchSpace").live_bytes, 0u);
+    ASSERT_THROW(memory_usage<memory_space>("untracked"), std::runtime_error);
+  }
+  Kokkos::finalize();
+  ASSERT_FALSE(Kokkos::Impl::memory_usage_print());
+}
+#endif
+
 }  // namespace Test
 
 #endif
@@ -0,0 +1,157 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <Kokkos_Core.hpp>
+
+namespace Test {
+
+namespace {
+
+template <class ExecSpace>
+struct TestHostGraphFunctor {
+  struct TagReverse {};
+
+  Kokkos::View<long*, ExecSpace> m_src;
+  Kokkos::View<long*, ExecSpace> m_dst;
+
+  // Reads an entry written by a different thread of execution
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagReverse&, const int i) const {
+    m_dst(i) = m_src(m_src.extent(0) - 1 - i);
+  }
+};
+
+}  // namespace
+
+TEST(TEST_CATEGORY, host_graph) {
+  using ExecSpace = TEST_EXECSPACE;
+  using Graph     = Kokkos::Experimental::HostGraph<ExecSpace>;
+  using Functor   = TestHostGraphFunctor<ExecSpace>;
+
+  const int N       = 1000;
+  const int repeats = 10;
+
+  Kokkos::View<long*, ExecSpace> a("a", N);
+  Kokkos::View<long*, ExecSpace> b("b", N);
+  Kokkos::View<long*, ExecSpace> c("c", N);
+  Kokkos::View<long*, ExecSpace> d("d", N);
+
+  Graph graph;
+
+  const int n0 =
+      graph.add_parallel_for("a", N, KOKKOS_LAMBDA(const int i) { a(i) += 1; });
+  const int n1 = graph.add_parallel_for(
+      "b", Kokkos::RangePolicy<ExecSpace>(0, N),
+      KOKKOS_LAMBDA(const int i) { b(i) = i; });
+  const int n2 = graph.add_parallel_for(
+      "c", N,
+      KOKKOS_LAMBDA(const int i) { c(i) += a(N - 1 - i) + b(N - 1 - i); },
+      {n0, n1});
+  graph.add_parallel_for(
+      "reverse",
+      Kokkos::RangePolicy<ExecSpace, typename Functor::TagReverse>(0, N),
+      Functor{c, d}, {n2});
+
+  ASSERT_EQ(graph.size(), 4);
+  ASSERT_EQ(graph.num_levels(), 3);
+
+  for (int r = 0; r < repeats; ++r) {
+    graph.submit();
+  }
+  Kokkos::fence();
+
+  auto h_a = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), a);
+  auto h_c = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), c);
+  auto h_d = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), d);
+
+  // After r submissions: a(i) = r, c(i) = r(r+1)/2 + r(N-1-i), d(i) = c(N-1-i)
+  const long r = repeats;
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(h_a(i), r);
+    ASSERT_EQ(h_c(i), r * (r + 1) / 2 + r * (N - 1 - i));
+    ASSERT_EQ(h_d(i), r * (r + 1) / 2 + r * i);
+  }
+}
+
+TEST(TEST_CATEGORY, host_graph_schedule) {
+  using ExecSpace = TEST_EXECSPACE;
+  using Graph     = Kokkos::Experimental::HostGraph<ExecSpace>;
+
+  const int N       = 1000;
+  const int repeats = 10;
+
+  Kokkos::View<long*, ExecSpace> a("a", N);
+  Kokkos::View<long*, ExecSpace> b("b", N);
+
+  Graph graph;
+
+  // Every index must be executed exactly once per submission whatever the
+  // schedule and chunk size.
+  const int n0 = graph.add_parallel_for(
+      "static",
+      Kokkos::RangePolicy<ExecSpace, Kokkos::Schedule<Kokkos::Static> >(0, N)
+          .set_chunk_size(7),
+      KOKKOS_LAMBDA(const int i) { Kokkos::atomic_add(&a(i), 1L); });
+  graph.add_parallel_for(
+      "dynamic",
+      Kokkos::RangePolicy<ExecSpace, Kokkos::Schedule<Kokkos::Dynamic> >(0, N)
+          .set_chunk_size(3),
+      KOKKOS_LAMBDA(const int i) { Kokkos::atomic_add(&b(i), a(i)); }, {n0});
+
+  for (int r = 0; r < repeats; ++r) {
+    graph.submit();
+  }
+  Kokkos::fence();
+
+  auto h_a = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), a);
+  auto h_b = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), b);
+
+  const long r = repeats;
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(h_a(i), r);
+    ASSERT_EQ(h_b(i), r * (r + 1) / 2);
+  }
+}
+
+}  // namespace Test
@@ -0,0 +1,160 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <Kokkos_Core.hpp>
+
+#include <vector>
+
+namespace Test {
+
+namespace {
+
+// Exclusive scan of ones, recording the position of each point in the
+// scan order
+template <class ExecSpace>
+struct TestMDRangeScan2D {
+  Kokkos::View<long**, Kokkos::LayoutRight, ExecSpace> m_pos;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, const int j, long& update,
+                  const bool final) const {
+    if (final) m_pos(i, j) = update;
+    update += 1;
+  }
+};
+
+template <class ExecSpace>
+struct TestMDRangeScan3D {
+  struct TagSquare {};
+
+  using value_type = long;
+
+  Kokkos::View<long***, Kokkos::LayoutLeft, ExecSpace> m_pos;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagSquare&, const int i, const int j, const int k,
+                  value_type& update, const bool final) const {
+    update += 1;
+    if (final) m_pos(i, j, k) = update * update;
+  }
+};
+
+}  // namespace
+
+TEST(TEST_CATEGORY, mdrange_scan_2d) {
+  using ExecSpace = TEST_EXECSPACE;
+  using policy_type =
+      Kokkos::MDRangePolicy<ExecSpace, Kokkos::Rank<2, Kokkos::Iterate::Right,
+                                                    Kokkos::Iterate::Right>>;
+
+  const long N0 = 123, N1 = 45;
+
+  TestMDRangeScan2D<ExecSpace> f{
+      Kokkos::View<long**, Kokkos::LayoutRight, ExecSpace>("pos", N0, N1)};
+
+  // Tiles spanning the inner dimension scan in row major order
+  long total = 0;
+  Kokkos::parallel_scan("mdrange_scan_2d",
+                        policy_type({0, 0}, {N0, N1}, {7, N1}), f, total);
+  ASSERT_EQ(total, N0 * N1);
+
+  auto h_pos =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), f.m_pos);
+  for (long i = 0; i < N0; ++i) {
+    for (long j = 0; j < N1; ++j) {
+      ASSERT_EQ(h_pos(i, j), i * N1 + j);
+    }
+  }
+
+  // Any tiling visits every point exactly once
+  Kokkos::parallel_scan(policy_type({0, 0}, {N0, N1}, {4, 5}), f);
+  Kokkos::fence();
+
+  Kokkos::deep_copy(h_pos, f.m_pos);
+  std::vector<int> seen(N0 * N1, 0);
+  for (long i = 0; i < N0; ++i) {
+    for (long j = 0; j < N1; ++j) {
+      ASSERT_GE(h_pos(i, j), 0);
+      ASSERT_LT(h_pos(i, j), N0 * N1);
+      ++seen[h_pos(i, j)];
+    }
+  }
+  for (long n = 0; n < N0 * N1; ++n) {
+    ASSERT_EQ(seen[n], 1);
+  }
+}
+
+TEST(TEST_CATEGORY, mdrange_scan_3d) {
+  using ExecSpace = TEST_EXECSPACE;
+  using Functor   = TestMDRangeScan3D<ExecSpace>;
+  using policy_type =
+      Kokkos::MDRangePolicy<ExecSpace,
+                            Kokkos::Rank<3, Kokkos::Iterate::Left,
+                                         Kokkos::Iterate::Left>,
+                            typename Functor::TagSquare>;
+
+  const long N0 = 11, N1 = 13, N2 = 17;
+
+  Functor f{Kokkos::View<long***, Kokkos::LayoutLeft, ExecSpace>("pos", N0, N1,
+                                                                 N2)};
+
+  // Tiles spanning the inner dimensions scan in column major order
+  long total = 0;
+  Kokkos::parallel_scan(policy_type({0, 0, 0}, {N0, N1, N2}, {N0, N1, 3}), f,
+                        total);
+  ASSERT_EQ(total, N0 * N1 * N2);
+
+  auto h_pos =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), f.m_pos);
+  for (long k = 0; k < N2; ++k) {
+    for (long j = 0; j < N1; ++j) {
+      for (long i = 0; i < N0; ++i) {
+        const long n = 1 + i + N0 * (j + N1 * k);
+        ASSERT_EQ(h_pos(i, j, k), n * n);
+      }
+    }
+  }
+}
+
+}  // namespace Test
@@ -54,4 +54,65 @@ TEST(TEST_CATEGORY, mdrange_4d) {
   TestMDRange_4D<TEST_EXECSPACE>::test_for4(100, 10, 10, 10);
 }
 
+namespace {
+
+struct MDRangeAutoTileFill {
+  Kokkos::View<int***, TEST_EXECSPACE> a;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, const int j, const int k) const {
+    a(i, j, k) = 1;
+  }
+};
+
+struct MDRangeAutoTileSum {
+  Kokkos::View<int***, TEST_EXECSPACE> a;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, const int j, const int k, long& sum) const {
+    sum += a(i, j, k);
+  }
+};
+
+}  // namespace
+
+TEST(TEST_CATEGORY, mdrange_auto_tile) {
+  using policy_type = Kokkos::MDRangePolicy<TEST_EXECSPACE, Kokkos::Rank<3>>;
+
+  const long N0 = 100, N1 = 200, N2 = 300;
+
+  policy_type policy({0, 0, 0}, {N0, N1, N2});
+
+  // Only the host backends choose tiles from the cache hierarchy
+  if (policy.m_tune_tile) {
+    long num_tiles = 1;
+    for (int i = 0; i < 3; ++i) {
+      const long span = policy.m_upper[i] - policy.m_lower[i];
+      ASSERT_GE(policy.m_tile[i], 1);
+      ASSERT_LE(policy.m_tile[i], span);
+      ASSERT_EQ(policy.m_tile_end[i],
+                (span + policy.m_tile[i] - 1) / policy.m_tile[i]);
+      num_tiles *= policy.m_tile_end[i];
+    }
+    ASSERT_EQ(policy.m_num_tiles, num_tiles);
+    ASSERT_GE(policy.m_num_tiles, 2 * TEST_EXECSPACE::concurrency());
+  }
+
+  // Tiles given by the user are kept as they are
+  policy_type given({0, 0, 0}, {N0, N1, N2}, {3, 5, 7});
+  ASSERT_FALSE(given.m_tune_tile);
+  ASSERT_EQ(given.m_tile[0], 3);
+  ASSERT_EQ(given.m_tile[1], 5);
+  ASSERT_EQ(given.m_tile[2], 7);
+
+  MDRangeAutoTileFill f{
+      Kokkos::View<int***, TEST_EXECSPACE>("a", N0, N1, N2)};
+  Kokkos::parallel_for("mdrange_auto_tile", policy, f);
+
+  long sum = 0;
+  Kokkos::parallel_reduce("mdrange_auto_tile", policy,
+                          MDRangeAutoTileSum{f.a}, sum);
+  ASSERT_EQ(sum, N0 * N1 * N2);
+}
+
 }  // namespace Test
@@ -49,6 +49,7 @@
 #include <iostream>
 #include <cmath>
 #include <algorithm>
+#include <vector>
 
 #include <impl/Kokkos_Timer.hpp>
 
@@ -173,6 +174,71 @@ void test_host_memory_pool_stats() {
   pool.deallocate(p1024, 1024);
 }
 
+template <typename MemSpace = Kokkos::HostSpace>
+void test_host_memory_pool_growth(const MemSpace& space = MemSpace()) {
+  using Space   = typename MemSpace::execution_space;
+  using MemPool = typename Kokkos::MemoryPool<Space>;
+
+  const size_t MemoryCapacity    = 8192;
+  const size_t MaxMemoryCapacity = 65536;
+  const size_t MinBlockSize      = 64;
+  const size_t MaxBlockSize      = 1024;
+  const size_t SuperBlockSize    = 4096;
+
+  MemPool pool(space, MemoryCapacity, MinBlockSize, MaxBlockSize,
+               SuperBlockSize, 0 /* magazine count */, 0 /* magazine capacity */,
+               MaxMemoryCapacity);
+
+  ASSERT_EQ(MemoryCapacity, pool.capacity());
+  ASSERT_EQ(MaxMemoryCapacity, pool.max_capacity());
+
+  const Kokkos::Experimental::MemoryUsage usage =
+      Kokkos::Experimental::memory_usage<MemSpace>();
+
+  // Fill the pool, which doubles in size from 2 to 16 superblocks
+
+  std::vector<void*> ptrs;
+
+  for (void* p = pool.allocate(MaxBlockSize); p;
+       p = pool.allocate(MaxBlockSize)) {
+    ptrs.push_back(p);
+  }
+
+  ASSERT_EQ(MaxMemoryCapacity / MaxBlockSize, ptrs.size());
+
+  typename MemPool::usage_statistics stats;
+
+  pool.get_usage_statistics(stats);
+
+  ASSERT_EQ(MaxMemoryCapacity, stats.capacity_bytes);
+  ASSERT_EQ(3u, stats.slab_count);
+  ASSERT_EQ(ptrs.size(), stats.consumed_blocks);
+
+  // The slabs are counted in the memory usage of the space
+
+  ASSERT_EQ(usage.live_bytes + MaxMemoryCapacity - MemoryCapacity,
+            Kokkos::Experimental::memory_usage<MemSpace>().live_bytes);
+  ASSERT_EQ(usage.live_count + 3,
+            Kokkos::Experimental::memory_usage<MemSpace>().live_count);
+
+  for (void* p : ptrs) pool.deallocate(p, MaxBlockSize);
+
+  pool.get_usage_statistics(stats);
+
+  ASSERT_EQ(0u, stats.consumed_blocks);
+
+  // Blocks of other sizes reuse the superblocks added by growth
+
+  void* p0064 = pool.allocate(64);
+  void* p0256 = pool.allocate(256);
+
+  ASSERT_NE(p0064, nullptr);
+  ASSERT_NE(p0256, nullptr);
+
+  pool.deallocate(p0064, 64);
+  pool.deallocate(p0256, 256);
+}
+
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
 
@@ -557,6 +623,87 @@ void test_memory_pool_huge() {
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
 
+template <class DeviceType>
+struct TestMemoryPoolMagazines {
+  using execution_space = typename DeviceType::execution_space;
+  using pool_type       = Kokkos::MemoryPool<DeviceType>;
+  using token_type      = Kokkos::Experimental::UniqueToken<execution_space>;
+  using value_type      = long;
+
+  pool_type pool;
+  token_type token;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int i, long& err) const noexcept {
+    const int32_t id          = token.acquire();
+    const unsigned alloc_size = 32 * (1 + (i % 5));
+
+    void* p = pool.allocate_cached(id, alloc_size);
+
+    if (p) {
+      pool.deallocate_cached(id, p, alloc_size);
+
+      // The block just deallocated is cached and reused
+      if (p != pool.allocate_cached(id, alloc_size)) ++err;
+
+      pool.deallocate_cached(id, p, alloc_size);
+    } else {
+      ++err;
+    }
+
+    token.release(id);
+  }
+};
+
+template <class DeviceType>
+void test_memory_pool_magazines() {
+  using execution_space = typename DeviceType::execution_space;
+  using functor_type    = TestMemoryPoolMagazines<DeviceType>;
+  using pool_type       = typename functor_type::pool_type;
+  using policy_type     = Kokkos::RangePolicy<execution_space>;
+
+  functor_type f;
+
+  const size_t magazine_count = f.token.size();
+
+  // At least a superblock per block size plus room for the cached blocks
+  f.pool = pool_type(typename DeviceType::memory_space(),
+                     8 * 4096 + magazine_count * 2048 /* total alloc size */,
+                     32 /* min block size */, 1024 /* max block size */,
+                     4096 /* superblock size */, magazine_count,
+                     2 /* magazine capacity */);
+
+  long err = 0;
+
+  Kokkos::parallel_reduce(policy_type(0, 1000), f, err);
+
+  ASSERT_EQ(err, 0);
+
+  typename pool_type::usage_statistics stats;
+
+  // Deallocated blocks stay consumed while they are cached
+
+  f.pool.get_usage_statistics(stats);
+
+  ASSERT_LT(0u, stats.cached_blocks);
+  ASSERT_EQ(stats.consumed_blocks, stats.cached_blocks);
+
+  f.pool.flush_magazines();
+
+  f.pool.get_usage_statistics(stats);
+
+  ASSERT_EQ(0u, stats.cached_blocks);
+  ASSERT_EQ(0u, stats.consumed_blocks);
+
+  // Magazine counts that do not fit the pool's 32 bit header are rejected
+
+  ASSERT_ANY_THROW(pool_type(typename DeviceType::memory_space(), 8 * 4096,
+                             32, 1024, 4096, size_t(1) << 32, 2));
+}
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
 }  // namespace TestMemoryPool
 
 namespace Test {
@@ -564,8 +711,26 @@ namespace Test {
 TEST(TEST_CATEGORY, memory_pool) {
   TestMemoryPool::test_host_memory_pool_defaults<>();
   TestMemoryPool::test_host_memory_pool_stats<>();
+  {
+    // The state and slabs of the pool are released together
+    using Kokkos::Experimental::memory_usage;
+    const size_t live_bytes = memory_usage<Kokkos::HostSpace>().live_bytes;
+    TestMemoryPool::test_host_memory_pool_growth<>();
+    ASSERT_EQ(live_bytes, memory_usage<Kokkos::HostSpace>().live_bytes);
+  }
+#if defined(__linux__)
+  {
+    // Slabs are allocated by the pool's space instance; with a NUMA policy
+    // each allocation is counted, the state and three slabs
+    const size_t count = Kokkos::Impl::host_numa_statistics().allocation_count;
+    TestMemoryPool::test_host_memory_pool_growth<>(
+        Kokkos::HostSpace(Kokkos::HostSpace::NumaPolicy::INTERLEAVE));
+    ASSERT_EQ(count + 4, Kokkos::Impl::host_numa_statistics().allocation_count);
+  }
+#endif
   TestMemoryPool::test_memory_pool_v2<TEST_EXECSPACE>(false, false);
   TestMemoryPool::test_memory_pool_corners<TEST_EXECSPACE>(false, false);
+  TestMemoryPool::test_memory_pool_magazines<TEST_EXECSPACE>();
 #ifdef KOKKOS_ENABLE_LARGE_MEM_TESTS
   TestMemoryPool::test_memory_pool_huge<TEST_EXECSPACE>();
 #endif
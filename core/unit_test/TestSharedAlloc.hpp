@@ -99,6 +99,10 @@ void test_shared_alloc() {
       h[i] = Header::get_header(r[i]->data());
 
       ASSERT_EQ(r[i]->use_count(), 0);
+      ASSERT_EQ(r[i]->get_label(), std::string(name));
+      ASSERT_EQ(reinterpret_cast<uintptr_t>(r[i]->data()) %
+                    Kokkos::Impl::MEMORY_ALIGNMENT,
+                0u);
 
       for (size_t j = 0; j < (i / 10) + 1; ++j) RecordBase::increment(r[i]);
 
@@ -224,6 +228,17 @@ void test_shared_alloc() {
     ASSERT_EQ(destroy_count, 1);
   }
 
+  {
+    // The header must preserve the alignment of the user's memory.
+    Kokkos::View<char*, MemorySpace, Kokkos::MemoryTraits<Kokkos::Aligned> >
+        aligned(Kokkos::view_alloc(Kokkos::WithoutInitializing, "aligned"),
+                size);
+
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(aligned.data()) %
+                  Kokkos::Impl::MEMORY_ALIGNMENT,
+              0u);
+  }
+
 #endif /* #if defined( KOKKOS_ACTIVE_EXECUTION_MEMORY_SPACE_HOST ) */
 }
 
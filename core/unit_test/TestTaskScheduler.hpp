@@ -816,6 +816,224 @@ struct TestMultipleDependence {
 
 //----------------------------------------------------------------------------
 
+namespace TestTaskScheduler {
+
+template <class Scheduler>
+struct TestPriorityInheritance {
+  using sched_type      = Scheduler;
+  using future_type     = Kokkos::BasicFuture<void, sched_type>;
+  using execution_space = typename sched_type::execution_space;
+  using value_type      = void;
+
+  // Task ids; 'Root' spawns the others
+  enum {
+    Gate,
+    Chain1,
+    Chain2,
+    Chain3,
+    ChainHigh,
+    WhenAllGate,
+    WhenAll1,
+    WhenAllMid,
+    WhenAll2,
+    WhenAllHigh,
+    Other,
+    NumTasks,
+    Root = -1
+  };
+
+  // Entry 0 counts the tasks that ran, entry 1 + id is the position of id
+  using order_type = Kokkos::View<int[NumTasks + 1], execution_space>;
+
+  order_type m_order;
+  int m_id;
+
+  KOKKOS_INLINE_FUNCTION
+  TestPriorityInheritance(const order_type& arg_order, int arg_id)
+      : m_order(arg_order), m_id(arg_id) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(typename sched_type::member_type& member) {
+    if (Root != m_id) {
+      m_order(1 + m_id) = Kokkos::atomic_fetch_add(&m_order(0), 1);
+      return;
+    }
+
+    auto& sched = member.scheduler();
+
+    const auto low  = Kokkos::TaskPriority::Low;
+    const auto high = Kokkos::TaskPriority::High;
+
+    // A chain of low priority tasks that a high priority task waits on.
+    // The high priority task is spawned last, so it only waits on the end
+    // of the chain, yet the whole chain must run ahead of 'Other'.
+    future_type gate =
+        Kokkos::task_spawn(Kokkos::TaskSingle(sched, high),
+                           TestPriorityInheritance(m_order, Gate));
+    future_type c1 = sched.spawn(Kokkos::TaskSingle(gate, low),
+                                 TestPriorityInheritance(m_order, Chain1));
+    future_type c2 = sched.spawn(Kokkos::TaskSingle(c1, low),
+                                 TestPriorityInheritance(m_order, Chain2));
+    future_type c3 = sched.spawn(Kokkos::TaskSingle(c2, low),
+                                 TestPriorityInheritance(m_order, Chain3));
+    sched.spawn(Kokkos::TaskSingle(c3, high),
+                TestPriorityInheritance(m_order, ChainHigh));
+
+    // A high priority task waits on a when_all of two low priority tasks,
+    // the second of which runs after the first, so the when_all has to pass
+    // the priority on to it.
+    future_type wgate = Kokkos::task_spawn(
+        Kokkos::TaskSingle(sched, high),
+        TestPriorityInheritance(m_order, WhenAllGate));
+    future_type w[2];
+    w[0] = sched.spawn(Kokkos::TaskSingle(wgate, low),
+                       TestPriorityInheritance(m_order, WhenAll1));
+
+    future_type wm = sched.spawn(Kokkos::TaskSingle(w[0], low),
+                                 TestPriorityInheritance(m_order, WhenAllMid));
+    w[1] = sched.spawn(Kokkos::TaskSingle(wm, low),
+                       TestPriorityInheritance(m_order, WhenAll2));
+
+    future_type all = sched.when_all(w, 2);
+    sched.spawn(Kokkos::TaskSingle(all, high),
+                TestPriorityInheritance(m_order, WhenAllHigh));
+
+    Kokkos::task_spawn(Kokkos::TaskSingle(sched, Kokkos::TaskPriority::Regular),
+                       TestPriorityInheritance(m_order, Other));
+  }
+
+  static void run() {
+    using memory_space = typename sched_type::memory_space;
+
+    enum { MemoryCapacity = 16000 };
+    enum { MinBlockSize = 64 };
+    enum { MaxBlockSize = 1024 };
+    enum { SuperBlockSize = 4096 };
+
+    sched_type sched(memory_space(), MemoryCapacity, MinBlockSize, MaxBlockSize,
+                     SuperBlockSize);
+
+    order_type order("order");
+
+    Kokkos::host_spawn(Kokkos::TaskSingle(sched),
+                       TestPriorityInheritance(order, Root));
+
+    Kokkos::wait(sched);
+
+    typename order_type::HostMirror host_order =
+        Kokkos::create_mirror_view(order);
+    Kokkos::deep_copy(host_order, order);
+
+    ASSERT_EQ(host_order(0), int(NumTasks));
+
+    auto position = [&](int id) { return host_order(1 + id); };
+
+    ASSERT_LT(position(Gate), position(Chain1));
+    ASSERT_LT(position(Chain1), position(Chain2));
+    ASSERT_LT(position(Chain2), position(Chain3));
+    ASSERT_LT(position(Chain3), position(ChainHigh));
+    ASSERT_LT(position(WhenAllGate), position(WhenAll1));
+    ASSERT_LT(position(WhenAll1), position(WhenAllMid));
+    ASSERT_LT(position(WhenAllMid), position(WhenAll2));
+    ASSERT_LT(position(WhenAll2), position(WhenAllHigh));
+
+    // The order of execution is only deterministic with a single thread:
+    // every task on a path to a high priority task runs before 'Other'.
+    if (1 == execution_space::concurrency()) {
+      ASSERT_EQ(position(Other), NumTasks - 1);
+    }
+  }
+};
+
+}  // namespace TestTaskScheduler
+
+//----------------------------------------------------------------------------
+
+namespace TestTaskScheduler {
+
+template <class Scheduler>
+struct TestTaskSpawnBatch {
+  using sched_type  = Scheduler;
+  using future_type = Kokkos::BasicFuture<void, Scheduler>;
+  using accum_type  = Kokkos::View<long, typename sched_type::execution_space>;
+  using value_type  = void;
+
+  accum_type m_accum;
+  long m_count;
+
+  KOKKOS_INLINE_FUNCTION
+  TestTaskSpawnBatch(long n, const accum_type& arg_accum)
+      : m_accum(arg_accum), m_count(n) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(typename sched_type::member_type& member) {
+    auto& sched = member.scheduler();
+    enum { CHUNK = 16 };
+    const int n = CHUNK < m_count ? CHUNK : m_count;
+
+    if (1 < m_count) {
+      const long increment   = (m_count + n - 1) / n;
+      const long count       = m_count;
+      const accum_type accum = m_accum;
+
+      future_type f = Kokkos::task_spawn_batch(
+          Kokkos::TaskSingle(sched), n, [=](int i) {
+            const long begin = i * increment;
+            const long end =
+                begin + increment < count ? begin + increment : count;
+            return TestTaskSpawnBatch(begin < end ? end - begin : 0, accum);
+          });
+
+      m_count = 0;
+
+      Kokkos::respawn(this, f);
+    } else if (1 == m_count) {
+      Kokkos::atomic_increment(&m_accum());
+    }
+  }
+
+  static void run(int n) {
+    using memory_space = typename sched_type::memory_space;
+
+    enum { MemoryCapacity = 32000 };
+    enum { MinBlockSize = 64 };
+    enum { MaxBlockSize = 1024 };
+    enum { SuperBlockSize = 4096 };
+
+    sched_type sched(memory_space(), MemoryCapacity, MinBlockSize, MaxBlockSize,
+                     SuperBlockSize);
+
+    accum_type accum("accum");
+
+    typename accum_type::HostMirror host_accum =
+        Kokkos::create_mirror_view(accum);
+
+    Kokkos::host_spawn(Kokkos::TaskSingle(sched), TestTaskSpawnBatch(n, accum));
+
+    Kokkos::wait(sched);
+
+    Kokkos::deep_copy(host_accum, accum);
+
+    ASSERT_EQ(host_accum(), n);
+
+    // Steals are counted across executions and queryable after a wait
+    const auto steals = sched.steal_counts();
+    if (1 == sched_type::execution_space::concurrency()) {
+      ASSERT_EQ(steals.local + steals.remote, 0u);
+    }
+
+    Kokkos::host_spawn(Kokkos::TaskSingle(sched), TestTaskSpawnBatch(n, accum));
+    Kokkos::wait(sched);
+
+    ASSERT_LE(steals.local, sched.steal_counts().local);
+    ASSERT_LE(steals.remote, sched.steal_counts().remote);
+  }
+};
+
+}  // namespace TestTaskScheduler
+
+//----------------------------------------------------------------------------
+
 #define KOKKOS_PP_CAT_IMPL(x, y) x##y
 #define KOKKOS_TEST_WITH_SUFFIX(x, y) KOKKOS_PP_CAT_IMPL(x, y)
 
@@ -77,6 +77,19 @@ TEST(TEST_CATEGORY,
   }
 }
 
+TEST(TEST_CATEGORY, KOKKOS_TEST_WITH_SUFFIX(task_priority_inheritance,
+                                            TEST_SCHEDULER_SUFFIX)) {
+  TestTaskScheduler::TestPriorityInheritance<TEST_SCHEDULER>::run();
+}
+
+TEST(TEST_CATEGORY,
+     KOKKOS_TEST_WITH_SUFFIX(task_spawn_batch, TEST_SCHEDULER_SUFFIX)) {
+  for (int i = 0; i < 25; ++i) {
+    TestTaskScheduler::TestTaskSpawnBatch<TEST_SCHEDULER>::run(i);
+  }
+  TestTaskScheduler::TestTaskSpawnBatch<TEST_SCHEDULER>::run(1000);
+}
+
 TEST(TEST_CATEGORY,
      KOKKOS_TEST_WITH_SUFFIX(task_scheduler_ctors, TEST_SCHEDULER_SUFFIX)) {
   TEST_SCHEDULER sched;
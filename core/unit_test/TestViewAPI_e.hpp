@@ -239,6 +239,58 @@ struct TestViewOverloadResolution {
 TEST(TEST_CATEGORY, view_overload_resolution) {
   TestViewOverloadResolution<TEST_EXECSPACE>::test_function_overload();
 }
+
+template <class ExecSpace,
+          bool = Kokkos::Impl::SpaceAccessibility<ExecSpace,
+                                                  Kokkos::HostSpace>::accessible>
+struct TestViewFirstTouch {
+  static void run() {}
+};
+
+template <class ExecSpace>
+struct TestViewFirstTouch<ExecSpace, true> {
+  using view_type =
+      Kokkos::View<double*, Kokkos::Device<ExecSpace, Kokkos::HostSpace>>;
+
+  static void fill_and_check(view_type a) {
+    const int64_t n = a.extent(0);
+    for (int64_t i = 0; i < n; ++i) a(i) = i;
+    int64_t sum = 0;
+    for (int64_t i = 0; i < n; ++i) sum += static_cast<int64_t>(a(i));
+    ASSERT_EQ(sum, n * (n - 1) / 2);
+  }
+
+  static void run() {
+    // Spans many pages and does not end on a page boundary.
+    const int64_t n = 100003;
+
+    view_type a(Kokkos::view_alloc("A", Kokkos::WithoutInitializing,
+                                   Kokkos::FirstTouch),
+                n);
+    fill_and_check(a);
+
+    // An initialized view is constructed regardless of first touch.
+    view_type b(Kokkos::view_alloc("B", Kokkos::FirstTouch), n);
+    ASSERT_EQ(b(0), 0.0);
+    ASSERT_EQ(b(n - 1), 0.0);
+
+    // Empty allocations are not touched.
+    view_type c(Kokkos::view_alloc("C", Kokkos::WithoutInitializing,
+                                   Kokkos::FirstTouch),
+                0);
+    ASSERT_EQ(c.extent(0), 0u);
+
+    const bool first_touch = Kokkos::Impl::host_first_touch();
+    Kokkos::Impl::set_host_first_touch(true);
+    view_type d(Kokkos::view_alloc("D", Kokkos::WithoutInitializing), n);
+    Kokkos::Impl::set_host_first_touch(first_touch);
+    fill_and_check(d);
+  }
+};
+
+TEST(TEST_CATEGORY, view_first_touch) {
+  TestViewFirstTouch<TEST_EXECSPACE>::run();
+}
 }  // namespace Test
 
 #include <TestViewIsAssignable.hpp>
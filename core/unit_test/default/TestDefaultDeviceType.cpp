@@ -47,6 +47,11 @@
 #include <Kokkos_Core.hpp>
 #include <default/TestDefaultDeviceType_Category.hpp>
 
+#ifdef KOKKOS_ENABLE_MMAPSPACE
+#include <cstdlib>
+#include <unistd.h>
+#endif
+
 #if !defined(KOKKOS_ENABLE_CUDA) || defined(__CUDACC__)
 
 namespace Test {
@@ -70,6 +75,130 @@ TEST(TEST_CATEGORY, host_space_access) {
                 "");
 }
 
+#if defined(__linux__)
+TEST(TEST_CATEGORY, host_space_numa) {
+  using host_exec_space = Kokkos::HostSpace::execution_space;
+  using range_policy    = Kokkos::RangePolicy<host_exec_space>;
+  using view_type       = Kokkos::View<double*, Kokkos::HostSpace>;
+  using numa_policy     = Kokkos::HostSpace::NumaPolicy;
+
+  const unsigned numa_count = Kokkos::hwloc::get_memory_numa_count();
+  ASSERT_LE(1u, numa_count);
+  ASSERT_LE(0, Kokkos::hwloc::get_memory_numa_id(numa_count - 1));
+  ASSERT_EQ(-1, Kokkos::hwloc::get_memory_numa_id(numa_count));
+
+  ASSERT_THROW(Kokkos::HostSpace(numa_policy::BIND, numa_count),
+               std::runtime_error);
+
+  const Kokkos::Impl::HostNumaStatistics before =
+      Kokkos::Impl::host_numa_statistics();
+
+  const int N = 100000;
+
+  view_type table(Kokkos::view_alloc("table",
+                                     Kokkos::HostSpace(numa_policy::INTERLEAVE)),
+                  N);
+  view_type local(
+      Kokkos::view_alloc("local",
+                         Kokkos::HostSpace(numa_policy::BIND, numa_count - 1)),
+      N);
+
+  ASSERT_EQ(before.allocation_count + 2,
+            Kokkos::Impl::host_numa_statistics().allocation_count);
+
+  Kokkos::parallel_for(
+      range_policy(0, N), KOKKOS_LAMBDA(const int i) { table(i) = 2 * i; });
+  Kokkos::deep_copy(local, table);
+
+  auto mirror = Kokkos::create_mirror_view(local);
+  ASSERT_EQ(mirror.data(), local.data());
+
+  int errors = 0;
+  for (int i = 0; i < N; ++i) {
+    if (mirror(i) != 2 * i) ++errors;
+  }
+  ASSERT_EQ(errors, 0);
+}
+#endif
+
+#ifdef KOKKOS_ENABLE_MMAPSPACE
+TEST(TEST_CATEGORY, mmap_space) {
+  using host_exec_space = Kokkos::HostSpace::execution_space;
+  using mmap_space      = Kokkos::Experimental::MmapSpace;
+  using range_policy    = Kokkos::RangePolicy<host_exec_space>;
+  using view_type       = Kokkos::View<int*, mmap_space>;
+
+  static_assert(
+      Kokkos::Impl::SpaceAccessibility<host_exec_space, mmap_space>::accessible,
+      "");
+  static_assert(Kokkos::Impl::MemorySpaceAccess<Kokkos::HostSpace,
+                                                mmap_space>::assignable,
+                "");
+
+  char path[] = "/tmp/kokkos_mmap_space_XXXXXX";
+  const int fd = mkstemp(path);
+  ASSERT_LE(0, fd);
+  close(fd);
+
+  const int N = 3000;  // Not a multiple of the page size
+
+  {
+    // ReadWrite extends the empty file and writes through to it.
+    view_type v(Kokkos::view_alloc(Kokkos::WithoutInitializing, "rw",
+                                   mmap_space(path, mmap_space::Mode::ReadWrite)),
+                N);
+    Kokkos::parallel_for(
+        range_policy(0, N), KOKKOS_LAMBDA(const int i) { v(i) = 3 * i; });
+    Kokkos::fence();
+  }
+
+  {
+    view_type v(Kokkos::view_alloc(Kokkos::WithoutInitializing, "cow",
+                                   mmap_space(path,
+                                              mmap_space::Mode::CopyOnWrite,
+                                              mmap_space::Advice::Random)),
+                N);
+    Kokkos::parallel_for(
+        range_policy(0, N), KOKKOS_LAMBDA(const int i) { v(i) = -i; });
+    Kokkos::fence();
+  }
+
+  {
+    view_type v(Kokkos::view_alloc(
+                    Kokkos::WithoutInitializing, "ro",
+                    mmap_space(path, mmap_space::Mode::ReadOnly,
+                               mmap_space::Advice::Sequential)),
+                N);
+    Kokkos::View<int*, Kokkos::HostSpace> h("h", N);
+    Kokkos::deep_copy(h, v);
+
+    int errors = 0;
+    for (int i = 0; i < N; ++i) {
+      if (v(i) != 3 * i || h(i) != 3 * i) ++errors;
+    }
+    ASSERT_EQ(errors, 0);
+
+    // The file is too short for a larger read only mapping.
+    ASSERT_THROW(view_type(Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                              "ro", mmap_space(path)),
+                           4 * N),
+                 std::runtime_error);
+  }
+
+  {
+    // The default space maps anonymous memory.
+    view_type v("anon", N);
+    int sum = 1;
+    Kokkos::parallel_reduce(
+        range_policy(0, N),
+        KOKKOS_LAMBDA(const int i, int& update) { update += v(i); }, sum);
+    ASSERT_EQ(sum, 0);
+  }
+
+  unlink(path);
+}
+#endif
+
 }  // namespace Test
 
 #endif
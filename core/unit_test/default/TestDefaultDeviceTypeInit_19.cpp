@@ -0,0 +1,2 @@
+#define KOKKOS_DEFAULTDEVICETYPE_INIT_TEST_19
+#include <TestDefaultDeviceTypeInit.hpp>
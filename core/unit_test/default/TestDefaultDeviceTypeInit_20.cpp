@@ -0,0 +1,2 @@
+#define KOKKOS_DEFAULTDEVICETYPE_INIT_TEST_20
+#include <TestDefaultDeviceTypeInit.hpp>
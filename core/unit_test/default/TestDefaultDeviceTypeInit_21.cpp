@@ -0,0 +1,2 @@
+#define KOKKOS_DEFAULTDEVICETYPE_INIT_TEST_21
+#include <TestDefaultDeviceTypeInit.hpp>
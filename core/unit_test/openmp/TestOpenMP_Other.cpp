@@ -52,7 +52,9 @@
 #include <TestViewCtorPropEmbeddedDim.hpp>
 #include <TestViewLayoutTiled.hpp>
 
+#include <chrono>
 #include <mutex>
+#include <thread>
 
 namespace Test {
 
@@ -135,4 +137,181 @@ TEST(openmp, partition_master) {
   ASSERT_EQ(errors, 0);
 }
 
+TEST(openmp, partition) {
+  auto check = [](int requested_num_partitions, int requested_partition_size) {
+    std::vector<Kokkos::OpenMP> instances = Kokkos::OpenMP::partition(
+        requested_num_partitions, requested_partition_size);
+
+    const int num_partitions = instances.size();
+    const int n              = 1000;
+
+    ASSERT_GE(num_partitions, 1);
+
+    Kokkos::View<int**, Kokkos::OpenMP> count("count", num_partitions, n);
+    Kokkos::View<int*, Kokkos::HostSpace> sum("sum", num_partitions);
+    Kokkos::View<int*, Kokkos::HostSpace> errors("errors", num_partitions);
+
+    for (int p = 0; p < num_partitions; ++p) {
+      const int pool_size = instances[p].impl_instance_pool_size();
+
+      ASSERT_TRUE(Kokkos::OpenMP::is_asynchronous(instances[p]));
+      for (int q = 0; q < p; ++q) {
+        ASSERT_NE(instances[p].impl_instance_id(),
+                  instances[q].impl_instance_id());
+      }
+
+      Kokkos::parallel_for(
+          Kokkos::RangePolicy<Kokkos::OpenMP>(instances[p], 0, n),
+          [=](const int i) { count(p, i) += p + 1; });
+
+      Kokkos::parallel_for(
+          Kokkos::TeamPolicy<Kokkos::OpenMP>(instances[p], n, Kokkos::AUTO),
+          [=](const Kokkos::TeamPolicy<Kokkos::OpenMP>::member_type& team) {
+            Kokkos::single(Kokkos::PerTeam(team),
+                           [&]() { count(p, team.league_rank()) += p + 1; });
+          });
+
+      Kokkos::parallel_reduce(
+          Kokkos::RangePolicy<Kokkos::OpenMP>(instances[p], 0, n),
+          [=](const int i, int& update) { update += count(p, i); },
+          Kokkos::subview(sum, p));
+
+      Kokkos::parallel_reduce(
+          Kokkos::RangePolicy<Kokkos::OpenMP>(instances[p], 0, n),
+          [=](const int, int& errs) {
+            if (Kokkos::OpenMP::impl_thread_pool_size() != pool_size) {
+              ++errs;
+            }
+          },
+          Kokkos::subview(errors, p));
+    }
+
+    for (int p = 0; p < num_partitions; ++p) {
+      instances[p].fence();
+      ASSERT_EQ(sum(p), 2 * n * (p + 1));
+      ASSERT_EQ(errors(p), 0);
+    }
+  };
+
+  check(0, 0);
+  check(2, 0);
+  check(0, 2);
+  check(4, 1);
+  check(8, 8);
+
+  // The default instance is not asynchronous
+  ASSERT_FALSE(Kokkos::OpenMP::is_asynchronous(Kokkos::OpenMP()));
+}
+
+TEST(openmp, partition_release_while_queued) {
+  const int n = 1000;
+  Kokkos::View<int*, Kokkos::HostSpace> count("count", n);
+
+  for (int iter = 0; iter < 10; ++iter) {
+    {
+      Kokkos::OpenMP instance = Kokkos::OpenMP::partition(1)[0];
+      Kokkos::parallel_for(
+          Kokkos::RangePolicy<Kokkos::OpenMP>(instance, 0, n),
+          [=](const int i) { count(i) += 1; });
+      // The queued kernel holds the last copy of the instance
+    }
+    Kokkos::fence();
+  }
+
+  int errors = 0;
+  for (int i = 0; i < n; ++i) errors += (count(i) != 10);
+  ASSERT_EQ(errors, 0);
+}
+
+TEST(openmp, partition_owns_threads) {
+  const int pool_size = Kokkos::OpenMP::impl_thread_pool_size();
+
+  {
+    // Live partitions own their threads of the default pool
+    std::vector<Kokkos::OpenMP> all = Kokkos::OpenMP::partition(1);
+    ASSERT_EQ(all[0].impl_instance_pool_size(), pool_size);
+    ASSERT_THROW(Kokkos::OpenMP::partition(1), std::runtime_error);
+  }
+
+  // Released partitions hand their threads back
+  std::vector<Kokkos::OpenMP> first = Kokkos::OpenMP::partition(1, 1);
+  if (pool_size == 1) return;
+
+  std::vector<Kokkos::OpenMP> rest = Kokkos::OpenMP::partition(0, 0);
+  int threads = first[0].impl_instance_pool_size();
+  for (auto const& instance : rest) {
+    threads += instance.impl_instance_pool_size();
+  }
+  ASSERT_LE(threads, pool_size);
+}
+
+struct TestOpenMPReleaseInstance {
+  Kokkos::OpenMP other;
+
+  void operator()(const int) const {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  }
+};
+
+TEST(openmp, partition_fence_releases_instance) {
+  std::vector<Kokkos::OpenMP> instances = Kokkos::OpenMP::partition(2);
+  if (instances.size() < 2) return;
+
+  // The functor holds the last copy of the second instance, which is
+  // released by the first instance's master thread while the default
+  // instance fences all partitions.
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<Kokkos::OpenMP>(instances[0], 0, 1),
+      TestOpenMPReleaseInstance{instances[1]});
+  instances.pop_back();
+  Kokkos::fence();
+
+  ASSERT_EQ(Kokkos::OpenMP::partition(1).size(), 1u);
+}
+
+TEST(openmp, two_level_reduction) {
+  // Pools are organized into locality domains when their threads are
+  // first used, so the override applies to the pool of a new instance.
+  Kokkos::Impl::HostThreadTeamData::set_pool_domain_size(2);
+
+  {
+    Kokkos::OpenMP instance = Kokkos::OpenMP::partition(1)[0];
+
+    using range_policy = Kokkos::RangePolicy<Kokkos::OpenMP>;
+    using mdrange_policy =
+        Kokkos::MDRangePolicy<Kokkos::OpenMP, Kokkos::Rank<2>>;
+    using team_policy    = Kokkos::TeamPolicy<Kokkos::OpenMP>;
+    using member_type    = team_policy::member_type;
+
+    const int n = 1000;
+    Kokkos::View<long*, Kokkos::HostSpace> sum("sum", 3);
+
+    Kokkos::parallel_reduce(
+        range_policy(instance, 0, n),
+        [=](const int i, long& update) { update += i; },
+        Kokkos::subview(sum, 0));
+
+    Kokkos::parallel_reduce(
+        mdrange_policy(instance, {0, 0}, {n, 3}),
+        [=](const int i, const int, long& update) { update += i; },
+        Kokkos::subview(sum, 1));
+
+    Kokkos::parallel_reduce(
+        team_policy(instance, n, 1),
+        [=](const member_type& team, long& update) {
+          update += team.league_rank();
+        },
+        Kokkos::subview(sum, 2));
+
+    instance.fence();
+
+    const long expected = long(n) * (n - 1) / 2;
+    ASSERT_EQ(sum(0), expected);
+    ASSERT_EQ(sum(1), 3 * expected);
+    ASSERT_EQ(sum(2), expected);
+  }
+
+  Kokkos::Impl::HostThreadTeamData::set_pool_domain_size(0);
+}
+
 }  // namespace Test
@@ -100,6 +100,76 @@ TEST(TEST_CATEGORY, team_broadcast) {
   TestTeamBroadcast<TEST_EXECSPACE, Kokkos::Schedule<Kokkos::Dynamic>,
                     long>::test_teambroadcast(1000, 1);
 }
+
+// Leagues whose ranks carry very different amounts of work, executed with
+// the team work stealing scheduler.  Each member of the team records every
+// league rank it executes, and the team agrees on the league rank through
+// team_broadcast and team_reduce.
+struct TestTeamDynamicImbalance {
+  using policy_type =
+      Kokkos::TeamPolicy<TEST_EXECSPACE, Kokkos::Schedule<Kokkos::Dynamic> >;
+  using member_type = policy_type::member_type;
+
+  Kokkos::View<int*, TEST_EXECSPACE> count;
+  Kokkos::View<int*, TEST_EXECSPACE> error;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_type& member, long& sum) const {
+    const int r = member.league_rank();
+
+    // Ten times more work on every eighth league rank
+    const int n = (r % 8 ? 1 : 10) * 100;
+    long work   = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::TeamThreadRange(member, n),
+        [&](const int i, long& val) { val += i % 7; }, work);
+
+    int leader_rank = r;
+    member.team_broadcast(leader_rank, 0);
+    if (leader_rank != r) Kokkos::atomic_increment(&error(0));
+
+    Kokkos::atomic_increment(&count(r));
+    if (0 == member.team_rank()) sum += work;
+  }
+};
+
+TEST(TEST_CATEGORY, team_dynamic_imbalance) {
+  const int league_size = 2000;
+
+  // A chunk size of zero keeps the policy's default chunk size
+  for (const int chunk : {0, 2}) {
+    TestTeamDynamicImbalance f;
+    f.count = Kokkos::View<int*, TEST_EXECSPACE>("count", league_size);
+    f.error = Kokkos::View<int*, TEST_EXECSPACE>("error", 1);
+
+    TestTeamDynamicImbalance::policy_type policy(league_size, Kokkos::AUTO);
+    if (chunk) policy.set_chunk_size(chunk);
+
+    const int team_size =
+        policy.team_size_recommended(f, Kokkos::ParallelReduceTag());
+    policy = TestTeamDynamicImbalance::policy_type(league_size, team_size);
+    if (chunk) policy.set_chunk_size(chunk);
+
+    long sum = 0;
+    Kokkos::parallel_reduce(policy, f, sum);
+
+    long expected = 0;
+    for (int r = 0; r < league_size; ++r) {
+      const int n = (r % 8 ? 1 : 10) * 100;
+      for (int i = 0; i < n; ++i) expected += i % 7;
+    }
+    ASSERT_EQ(sum, expected);
+
+    auto count =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), f.count);
+    auto error =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), f.error);
+    ASSERT_EQ(error(0), 0);
+    for (int r = 0; r < league_size; ++r) {
+      ASSERT_EQ(count(r), team_size);
+    }
+  }
+}
 }  // namespace Test
 
 #include <TestTeamVector.hpp>
@@ -51,3 +51,42 @@
 
 #include <TestViewCtorPropEmbeddedDim.hpp>
 #include <TestViewLayoutTiled.hpp>
+
+#include <thread>
+#include <vector>
+
+namespace Test {
+
+TEST(threads, concurrent_dispatchers) {
+  // Host threads other than the master may dispatch kernels concurrently,
+  // each owning the pool until it has read the result of its reduction.
+  const int n             = 1000;
+  const int n_dispatchers = 4;
+  const int repeat        = 50;
+
+  std::vector<int> errors(n_dispatchers, 0);
+  std::vector<std::thread> dispatchers;
+
+  for (int d = 0; d < n_dispatchers; ++d) {
+    dispatchers.emplace_back([=, &errors]() {
+      Kokkos::View<long*, Kokkos::Threads> v("v", n);
+      for (int r = 0; r < repeat; ++r) {
+        Kokkos::parallel_for(
+            Kokkos::RangePolicy<Kokkos::Threads>(0, n),
+            KOKKOS_LAMBDA(const int i) { v(i) += d + 1; });
+        long sum = 0;
+        Kokkos::parallel_reduce(
+            Kokkos::RangePolicy<Kokkos::Threads>(0, n),
+            KOKKOS_LAMBDA(const int i, long& update) { update += v(i); }, sum);
+        if (sum != long(n) * (d + 1) * (r + 1)) ++errors[d];
+      }
+    });
+  }
+  for (std::thread& t : dispatchers) t.join();
+
+  for (int d = 0; d < n_dispatchers; ++d) {
+    ASSERT_EQ(errors[d], 0);
+  }
+}
+
+}  // namespace Test
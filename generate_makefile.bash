@@ -149,6 +149,7 @@ display_help_text() {
       echo "                                compiler_warnings"
       echo "                                aggressive_vectorization = add ivdep on loops"
       echo "                                disable_profiling = do not compile with profiling hooks"
+      echo "                                compact_allocation_header = intern labels of tracked allocations"
       echo "                                "
       echo "--with-cuda-options=[OPT]:    Additional options to CUDA:"
       echo "                                force_uvm, use_ldg, enable_lambda, rdc"